@@ -308,6 +308,27 @@
  * as memory will be freed more often, at the cost of decreased performance. */
 // #define FLECS_USE_OS_ALLOC
 
+/** @def FLECS_COLUMN_ALIGNMENT
+ * Alignment in bytes of table column storage. The first element of each table
+ * column is aligned to this value, and column storage is padded to a multiple
+ * of it. This allows systems to use aligned vector loads for fields at table 
+ * offset 0 and to process the last elements of a column with a full vector
+ * width. The default of 64 matches the cache line size and AVX-512 registers.
+ * Must be a power of 2 that is at least the size of a pointer. */
+#ifndef FLECS_COLUMN_ALIGNMENT
+#define FLECS_COLUMN_ALIGNMENT 64
+#endif
+
+/** @def FLECS_CHANGE_CHUNK_BITS
+ * Number of bits of a table row that determine the chunk used for change 
+ * detection. Tables track changes per chunk of (1 << bits) rows, which allows
+ * ecs_iter_changed_rows() to only return the rows of a result that changed.
+ * Lower values increase change detection precision, at the cost of more 
+ * memory and more work when marking large ranges of rows dirty. */
+#ifndef FLECS_CHANGE_CHUNK_BITS
+#define FLECS_CHANGE_CHUNK_BITS 10
+#endif
+
 /** @def FLECS_ID_DESC_MAX
  * Maximum number of IDs to add in ecs_entity_desc_t / ecs_bulk_desc_t. */
 #ifndef FLECS_ID_DESC_MAX
@@ -1316,7 +1337,11 @@ typedef struct ecs_query_desc_t {
 
     /** Callback used for ordering query results. If order_by is 0, the
      * pointer provided to the callback will be NULL. If the callback is not
-     * set, results will not be ordered. */
+     * set and order_by is a component or member with a primitive type, 
+     * results are ordered by value in ascending order. Otherwise results 
+     * will not be ordered. When the query is used by a system, tables are
+     * sorted before the pipeline runs the system, and the callback may be
+     * called from worker threads. */
     ecs_order_by_action_t order_by_callback;
 
     /** Callback used for ordering query results. Same as order_by_callback,
@@ -1324,7 +1349,8 @@ typedef struct ecs_query_desc_t {
     ecs_sort_table_action_t order_by_table_callback;
 
     /** Component to sort on, used together with order_by_callback or
-     * order_by_table_callback. */
+     * order_by_table_callback. When no callback is provided this can also be
+     * a member of a component (requires the FLECS_META addon). */
     ecs_entity_t order_by;
 
     /** Component ID to be used for grouping. Used together with the
@@ -1394,6 +1420,16 @@ typedef struct ecs_observer_desc_t {
      * ecs_observer_init() will not return an entity handle. */
     bool global_observer;
 
+    /** Batched observers don't invoke the callback for each event. Instead the
+     * entities for which an event was emitted are buffered, and delivered as
+     * contiguous table ranges when the observers are flushed. Observers are
+     * flushed when deferred commands are merged into the world, at the end of
+     * a frame and when calling ecs_flush_observers(). Batched observers can 
+     * only observe OnAdd and OnSet events, and must match $this. The observer
+     * query is evaluated when the events are delivered, so the callback sees 
+     * the component values of the flush point. */
+    bool batched;
+
     /** Callback to invoke on an event, invoked when the observer matches. */
     ecs_iter_action_t callback;
 
@@ -3073,10 +3109,16 @@ const ecs_entity_t* ecs_bulk_init(
  * This operation is the same as ecs_new_w_id(), but creates N entities
  * instead of one.
  *
+ * Entities can't be created from a multithreaded system, unless the component
+ * is an (IsA, prefab) pair. In that case the operation enqueues a command 
+ * that creates the entities when the worker stage is merged, and returns NULL
+ * (see ecs_bulk_instantiate()).
+ *
  * @param world The world.
  * @param component The component to create the entities with.
  * @param count The number of entities to create.
- * @return An array with the entity IDs of the newly created entities.
+ * @return An array with the entity IDs of the newly created entities, or NULL
+ *         if prefab instances are created when the stage is merged.
  */
 FLECS_API
 const ecs_entity_t* ecs_bulk_new_w_id(
@@ -3084,6 +3126,36 @@ const ecs_entity_t* ecs_bulk_new_w_id(
     ecs_id_t component,
     int32_t count);
 
+/** Create N instances of a prefab.
+ * This operation is the same as calling ecs_bulk_new_w_id() with an 
+ * (IsA, prefab) pair, but instantiates the prefab hierarchy for all instances
+ * at once. If the prefab children are stored with the Parent component, each
+ * prefab child table is populated for all instances with a single append, and
+ * OnAdd/OnSet events are emitted once per table range instead of once per 
+ * instance child. Other prefab hierarchies are instantiated for each instance.
+ *
+ * When the world is deferred, the instances are created when the bulk command
+ * is merged, and are instantiated together in the same way. This makes it safe
+ * to call the operation from multithreaded systems: each worker enqueues a 
+ * single command, and the entity IDs of the instances are only created when
+ * the worker stage is merged. In that case the operation returns NULL.
+ *
+ * The returned array points to an internal data structure. If observers that
+ * are invoked by the operation delete or move the instances, the returned
+ * array may be incorrect (see ecs_bulk_init()).
+ *
+ * @param world The world.
+ * @param prefab The prefab to instantiate.
+ * @param count The number of instances to create.
+ * @return An array with the entity IDs of the instances, or NULL if the 
+ *         instances are created when the stage is merged.
+ */
+FLECS_API
+const ecs_entity_t* ecs_bulk_instantiate(
+    ecs_world_t *world,
+    ecs_entity_t prefab,
+    int32_t count);
+
 /** Clone an entity.
  * This operation clones the components of one entity into another entity. If
  * no destination entity is provided, a new entity will be created. Component
@@ -5210,6 +5282,43 @@ void ecs_iter_set_group(
     ecs_iter_t *it,
     uint64_t group_id);
 
+/** Iterate a partition of the query results.
+ * This operation splits the results of a query into partitions, and limits an
+ * iterator to a single partition. It can be used to iterate an (uncached)
+ * query in parallel, by creating an iterator for each stage that iterates a
+ * different partition.
+ *
+ * For queries that are evaluated by the query engine, the tables found by the
+ * first (driver) term of the query are distributed across partitions. The
+ * remaining terms of the query are only evaluated for the tables of the
+ * iterated partition. For other queries the results are distributed across
+ * partitions. Each result is returned by exactly one partition, as long as
+ * the world is not modified while the partitions are iterated.
+ *
+ * Unlike ecs_worker_iter(), which splits the entities of each result, this
+ * operation splits the work of evaluating the query.
+ *
+ * The partition must be set before the first call to ecs_query_next().
+ *
+ * @code
+ * // For each stage:
+ * ecs_iter_t it = ecs_query_iter(stage, q);
+ * ecs_iter_set_partition(&it, stage_index, stage_count);
+ * while (ecs_query_next(&it)) {
+ *   // Iterate as usual
+ * }
+ * @endcode
+ *
+ * @param it The query iterator.
+ * @param index The partition to iterate.
+ * @param count The total number of partitions.
+ */
+FLECS_API
+void ecs_iter_set_partition(
+    ecs_iter_t *it,
+    int32_t index,
+    int32_t count);
+
 /** Return the map with query groups.
  * This map can be used to iterate the active group identifiers of a query. The
  * payload of the map is opaque. The map can be used as follows:
@@ -5353,6 +5462,26 @@ void ecs_enqueue(
     ecs_world_t *world,
     ecs_event_desc_t *desc);
 
+/** Deliver buffered events to batched observers.
+ * Batched observers buffer the entities for which they received events. This
+ * operation invokes batched observers for the buffered entities, grouped by
+ * table, where each invocation receives a contiguous range of entities. 
+ * Operations done by the observers are deferred until all events have been
+ * delivered.
+ *
+ * This operation is called automatically when deferred commands are merged 
+ * into the world, and at the end of a frame. Applications only have to call
+ * it to deliver events for operations that weren't deferred. This operation
+ * must be called on the world, and not while the world is deferred.
+ *
+ * @param world The world.
+ *
+ * @see ecs_observer_desc_t::batched
+ */
+FLECS_API
+void ecs_flush_observers(
+    ecs_world_t *world);
+
 /** Create an observer.
  * Observers can subscribe for one or more terms. An observer only triggers
  * when the source of the event meets all terms.
@@ -5682,7 +5811,8 @@ uint64_t ecs_iter_get_group(
  * iterated result has changed since the last time it was iterated by the query.
  * 
  * Change detection works on a per-table basis. Changes to individual entities
- * cannot be detected this way.
+ * cannot be detected this way. To find the rows in a result that changed, use
+ * ecs_iter_changed_rows().
  * 
  * @param it The iterator.
  * @return True if the result changed, false if it didn't.
@@ -5691,6 +5821,43 @@ FLECS_API
 bool ecs_iter_changed(
     ecs_iter_t *it);
 
+/** Find the next range of changed rows in the current iterator result.
+ * This operation is like ecs_iter_changed(), but returns the rows of the 
+ * result that changed. Changes are tracked per chunk of 
+ * (1 << FLECS_CHANGE_CHUNK_BITS) table rows, so the returned range may include
+ * rows that did not change, but only if they share a chunk with a row that did.
+ * 
+ * The operation searches for changed rows starting at the row passed in through
+ * the row parameter. Rows are relative to the current result, so the first 
+ * element of a field is at row 0. If a changed row is found, the row parameter
+ * is set to the first changed row, and the number of subsequent changed rows 
+ * is returned. If no more changed rows are found, the operation returns 0.
+ * 
+ * Changes that affect all rows of a result, such as adding or removing 
+ * entities, or changes to shared components, cause the operation to return 
+ * all remaining rows.
+ * 
+ * @code
+ * while (ecs_query_next(&it)) {
+ *   int32_t row = 0, count;
+ *   while ((count = ecs_iter_changed_rows(&it, &row))) {
+ *     for (int32_t i = row; i < row + count; i ++) {
+ *       // ...
+ *     }
+ *     row += count;
+ *   }
+ * }
+ * @endcode
+ * 
+ * @param it The iterator.
+ * @param row The row to start searching from, set to the first changed row.
+ * @return The number of changed rows, or 0 if no more rows changed.
+ */
+FLECS_API
+int32_t ecs_iter_changed_rows(
+    ecs_iter_t *it,
+    int32_t *row);
+
 /** Convert an iterator to a string.
  * Prints the contents of an iterator to a string. Useful for debugging and/or
  * testing the output of an iterator.
@@ -5773,6 +5940,48 @@ FLECS_API
 bool ecs_worker_next(
     ecs_iter_t *it);
 
+/** Create a chunked worker iterator.
+ * Chunked worker iterators divide matched entities across N resources (usually 
+ * threads) by letting each resource claim fixed size chunks of rows from a 
+ * shared cursor. Rows are numbered across all results of the source iterator, 
+ * which means that a chunk can span multiple tables, and that a single large 
+ * table is divided across all resources.
+ *
+ * Unlike ecs_worker_iter(), the distribution of entities across resources is
+ * not stable. This makes chunked iterators better at balancing work when 
+ * matched tables have very different sizes.
+ *
+ * All resources that iterate the same source iterator must use the same cursor
+ * and chunk size. The cursor must be set to 0 before any of the resources 
+ * starts iterating, and must remain valid until all resources are done.
+ *
+ * The iterator must be iterated with ecs_worker_chunk_next().
+ *
+ * @param it The source iterator.
+ * @param index The index of the current resource.
+ * @param count The total number of resources to divide entities between.
+ * @param cursor Cursor shared between resources.
+ * @param chunk_size The number of rows in a chunk.
+ * @return A chunked worker iterator.
+ */
+FLECS_API
+ecs_iter_t ecs_worker_chunk_iter(
+    const ecs_iter_t *it,
+    int32_t index,
+    int32_t count,
+    int32_t *cursor,
+    int32_t chunk_size);
+
+/** Progress a chunked worker iterator.
+ * Progress an iterator created by ecs_worker_chunk_iter().
+ *
+ * @param it The iterator.
+ * @return True if the iterator has more results, false if not.
+ */
+FLECS_API
+bool ecs_worker_chunk_next(
+    ecs_iter_t *it);
+
 /** Get data for a field.
  * This operation retrieves a pointer to an array of data that belongs to the
  * term in the query. The index refers to the location of the term in the query,
@@ -5795,6 +6004,10 @@ bool ecs_worker_next(
  * The provided size must be either 0 or must match the size of the type
  * of the returned array. If the size does not match, the operation may assert.
  * The size can be dynamically obtained with ecs_field_size().
+ *
+ * When the iterator returns a table from offset 0 (it->offset is 0), owned 
+ * component fields are aligned to FLECS_COLUMN_ALIGNMENT bytes, and the storage
+ * is padded to a multiple of FLECS_COLUMN_ALIGNMENT bytes.
  * 
  * An example:
  * 
@@ -6109,6 +6322,27 @@ FLECS_API
 int32_t ecs_table_size(
     const ecs_table_t *table);
 
+/** Reserve storage for a table.
+ * This operation ensures that the table can store at least the specified 
+ * number of entities without reallocating its columns. Growing a table 
+ * reallocates all its columns, and moves every existing element for components
+ * that have a move hook, which can take a long time for tables with many
+ * entities. Reserving storage upfront moves this cost to a point where the 
+ * application can afford it, such as while loading a level.
+ *
+ * If the table already has enough storage, this operation does nothing. Table
+ * storage is rounded up to the next power of 2.
+ *
+ * @param world The world.
+ * @param table The table.
+ * @param size The number of entities to reserve storage for.
+ */
+FLECS_API
+void ecs_table_reserve(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t size);
+
 /** Return the array with entity IDs for the table.
  * The size of the returned array is the result of ecs_table_count().
  * 
@@ -393,6 +393,17 @@ public:
         return ecs_iter_changed(iter_);
     }
 
+    /** Find the next range of changed rows in the current table.
+     * Can only be used when iterating queries and/or systems.
+     *
+     * @param row The row to start searching from, set to the first changed row.
+     * @return The number of changed rows, or 0 if no more rows changed.
+     * @see ecs_iter_changed_rows()
+     */
+    int32_t changed_rows(int32_t& row) {
+        return ecs_iter_changed_rows(iter_, &row);
+    }
+
     /** Skip current table.
      * This indicates to the query that the data in the current table is not
      * modified. By default, iterating a table with a query will mark the
@@ -44,6 +44,7 @@ using Enum = EcsEnum;
 using Bitmask = EcsBitmask;
 using Member = EcsMember;
 using MemberRanges = EcsMemberRanges;
+using MemberIndex = EcsMemberIndex;
 using Struct = EcsStruct;
 using Array = EcsArray;
 using Vector = EcsVector;
@@ -73,6 +74,7 @@ static const flecs::entity_t F64 = ecs_id(ecs_f64_t);
 static const flecs::entity_t String = ecs_id(ecs_string_t);
 static const flecs::entity_t Entity = ecs_id(ecs_entity_t);
 static const flecs::entity_t Quantity = EcsQuantity;
+static const flecs::entity_t Indexed = EcsIndexed;
 
 namespace meta {
 
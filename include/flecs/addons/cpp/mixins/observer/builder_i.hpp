@@ -51,6 +51,13 @@ struct observer_builder_i : query_builder_i<Base, Components ...> {
         return *this;
     }
 
+    /** Buffer events and deliver them as table ranges when observers are
+     * flushed. See ecs_observer_desc_t::batched. */
+    Base& batched(bool value = true) {
+        desc_->batched = value;
+        return *this;
+    }
+
     /** Set the observer flags. */
     Base& observer_flags(ecs_flags32_t flags) {
         desc_->flags_ |= flags;
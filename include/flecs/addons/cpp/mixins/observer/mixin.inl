@@ -28,4 +28,12 @@ flecs::observer observer(flecs::entity e) const;
 template <typename... Components, typename... Args>
 flecs::observer_builder<Components...> observer(Args &&... args) const;
 
+/** Deliver buffered events to batched observers.
+ * 
+ * @see ecs_flush_observers()
+ */
+void flush_observers() const {
+    ecs_flush_observers(world_);
+}
+
 /** @} */
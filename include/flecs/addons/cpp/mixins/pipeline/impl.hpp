@@ -85,4 +85,12 @@ inline bool world::using_task_threads() const {
     return ecs_using_task_threads(world_);
 }
 
+inline void world::set_work_stealing(bool enable) const {
+    ecs_set_work_stealing(world_, enable);
+}
+
+inline void world::set_concurrent_systems(bool enable) const {
+    ecs_set_concurrent_systems(world_, enable);
+}
+
 }
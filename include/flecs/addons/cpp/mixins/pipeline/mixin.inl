@@ -92,4 +92,14 @@ void set_task_threads(int32_t task_threads) const;
  */
 bool using_task_threads() const;
 
+/** Enable or disable work stealing for multi-threaded systems.
+ * @see ecs_set_work_stealing()
+ */
+void set_work_stealing(bool enable = true) const;
+
+/** Enable or disable running single-threaded systems concurrently.
+ * @see ecs_set_concurrent_systems()
+ */
+void set_concurrent_systems(bool enable = true) const;
+
 /** @} */
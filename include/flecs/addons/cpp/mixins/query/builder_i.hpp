@@ -348,6 +348,28 @@ struct query_builder_i : term_builder_i<Base> {
         return *this;
     }
 
+    /** Sort the output of a query by a primitive value.
+     * The component or member must have a primitive type that is known 
+     * through reflection. Results are sorted in ascending order.
+     *
+     * @param component The component or member used to sort.
+     */
+    Base& order_by(flecs::entity_t component) {
+        desc_->order_by_callback = nullptr;
+        desc_->order_by = component;
+        return *this;
+    }
+
+    /** Sort the output of a query by a primitive value.
+     * Same as order_by(flecs::entity_t), but with a component type.
+     *
+     * @tparam T The component used to sort.
+     */
+    template <typename T>
+    Base& order_by() {
+        return this->order_by(_::type<T>::id(this->world_v()));
+    }
+
     /** Group and sort matched tables.
      * Similar to ecs_query_order_by(), but instead of sorting individual entities, this
      * operation only sorts matched tables. This can be useful if a query needs to
@@ -72,6 +72,39 @@ public:
         return *this;
     }
 
+    /** Specify whether the system can run concurrently with other systems.
+     *
+     * @param value If true, the system can run on a worker thread at the same
+     *              time as other concurrent systems.
+     * @see ecs_set_concurrent_systems()
+     */
+    Base& concurrent(bool value = true) {
+        desc_->concurrent = value;
+        return *this;
+    }
+
+    /** Specify the number of rows threads of a multithreaded system claim at 
+     * a time. When set, rows are distributed dynamically across threads. Not
+     * used when the system is run with run_worker().
+     *
+     * @param value The number of rows in a chunk.
+     */
+    Base& chunk_size(int32_t value) {
+        desc_->chunk_size = value;
+        return *this;
+    }
+
+    /** Specify whether threads of a multithreaded system run the groups of a
+     * grouped (for example cascade) query one at a time, and wait for each
+     * other before starting the next group.
+     *
+     * @param value If true, groups are run one at a time.
+     */
+    Base& parallel_levels(bool value = true) {
+        desc_->parallel_levels = value ? 1 : -1;
+        return *this;
+    }
+
     /** Specify whether the system should be run in an immediate (non-staged) context.
      *
      * @param value If false, the system will always run staged.
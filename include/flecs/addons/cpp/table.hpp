@@ -56,6 +56,11 @@ struct table {
         return ecs_table_size(table_);
     }
 
+    /** Reserve storage for the specified number of entities. */
+    void reserve(int32_t size) const {
+        ecs_table_reserve(world_, table_, size);
+    }
+
     /** Get the array of entity IDs. */
     const flecs::entity_t* entities() const {
         return ecs_table_entities(table_);
@@ -160,6 +160,11 @@ struct iterable {
         return this->iter().template set_group<Group>();
     }
 
+    /** Limit results to a partition of the query results. */
+    iter_iterable<Components...> set_partition(int32_t index, int32_t count) const {
+        return this->iter().set_partition(index, count);
+    }
+
     /** Virtual destructor. */
     virtual ~iterable() { }
 protected:
@@ -270,6 +275,12 @@ struct iter_iterable final : iterable<Components...> {
         return *this;
     }
 
+    /** Limit results to a partition of the query results. */
+    iter_iterable<Components...>& set_partition(int32_t index, int32_t count) {
+        ecs_iter_set_partition(&it_, index, count);
+        return *this;
+    }
+
 protected:
     ecs_iter_t get_iter(flecs::world_t *world) const override {
         if (world) {
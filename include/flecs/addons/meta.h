@@ -118,6 +118,7 @@ FLECS_API extern const ecs_entity_t ecs_id(EcsBitmask);         /**< ID for comp
 FLECS_API extern const ecs_entity_t ecs_id(EcsConstants);       /**< ID for component that stores reflection data for constants. */
 FLECS_API extern const ecs_entity_t ecs_id(EcsMember);          /**< ID for component that stores reflection data for struct members. */
 FLECS_API extern const ecs_entity_t ecs_id(EcsMemberRanges);    /**< ID for component that stores min and max ranges for member values. */
+FLECS_API extern const ecs_entity_t ecs_id(EcsMemberIndex);     /**< ID for component that stores a value index for a member. */
 FLECS_API extern const ecs_entity_t ecs_id(EcsStruct);          /**< ID for component that stores reflection data for a struct type. */
 FLECS_API extern const ecs_entity_t ecs_id(EcsArray);           /**< ID for component that stores reflection data for an array type. */
 FLECS_API extern const ecs_entity_t ecs_id(EcsVector);          /**< ID for component that stores reflection data for a vector type. */
@@ -125,6 +126,7 @@ FLECS_API extern const ecs_entity_t ecs_id(EcsOpaque);          /**< ID for comp
 FLECS_API extern const ecs_entity_t ecs_id(EcsUnit);            /**< ID for component that stores unit data. */
 FLECS_API extern const ecs_entity_t ecs_id(EcsUnitPrefix);      /**< ID for component that stores unit prefix data. */
 FLECS_API extern const ecs_entity_t EcsQuantity;                /**< Tag added to unit quantities. */
+FLECS_API extern const ecs_entity_t EcsIndexed;                 /**< Trait that enables a value index for a member. */
 
 /* Primitive type component IDs */
 
@@ -216,6 +218,38 @@ typedef struct EcsMemberRanges {
     ecs_member_value_range_t error;                /**< Member value error range. */
 } EcsMemberRanges;
 
+/** Component added to member entities with the Indexed trait.
+ * Maps member values to the entities that have the value. The index is kept up
+ * to date when the component is added (OnAdd), set (OnSet) or removed 
+ * (OnRemove), and is used by queries to evaluate (Member, Value) terms without
+ * scanning all rows of a table. 
+ * 
+ * Values can also be written without an OnSet event, for example through
+ * ecs_get_mut(), ecs_ensure() or by a system that writes the component. Such
+ * writes mark the rows of the component dirty in the table, and the dirty rows
+ * are indexed again before the index is used. In multithreaded mode the index 
+ * is not modified by lookups, and queries evaluate tables with dirty rows 
+ * without the index, so that they return the same results as a scan.
+ * 
+ * Values are stored as keys that have the same order as the member values. The
+ * sorted arrays used by ecs_member_index_range() are created on first use, and
+ * are updated with changed entities on the next range lookup. */
+typedef struct EcsMemberIndex {
+    ecs_entity_t component;                        /**< Component that contains the member. */
+    ecs_entity_t observer;                         /**< Observer that keeps the index up to date. */
+    ecs_entity_t table_observer;                   /**< Observer that tracks changes for new tables. */
+    ecs_primitive_kind_t kind;                     /**< Kind of member value. */
+    int32_t offset;                                /**< Member offset. */
+    ecs_map_t values;                              /**< map<key, vector<entity>> */
+    ecs_map_t entities;                            /**< map<entity, key> */
+    ecs_vec_t sorted_keys;                         /**< vector<key>, sorted */
+    ecs_vec_t sorted_entities;                     /**< vector<entity>, in key order */
+    ecs_map_t changed;                             /**< Entities changed since last range lookup */
+    ecs_map_t synced;                              /**< map<table id, dirty state when indexed> */
+    ecs_os_mutex_t lock;                           /**< Protects range lookups in multithreaded mode */
+    bool sorted;                                   /**< Whether sorted arrays are created */
+} EcsMemberIndex;
+
 /** Element type of members vector in EcsStruct. */
 typedef struct ecs_member_t {
     /** Must be set when used with ecs_struct_desc_t. */
@@ -1022,6 +1056,100 @@ ecs_size_t ecs_meta_op_get_elem_count(
     const ecs_meta_op_t *op,
     const void *ptr);
 
+/** Strided view of a struct member in a query field.
+ * Returned by ecs_field_member(). */
+typedef struct ecs_member_field_t {
+    void *ptr;                 /**< Member of the first element, NULL if not found. */
+    ecs_entity_t type;         /**< Type of the member. */
+    ecs_size_t stride;         /**< Bytes between members of subsequent elements. */
+} ecs_member_field_t;
+
+/** Get strided view of a member in a query field.
+ * This operation returns a pointer to the specified member of the first element
+ * in the field, together with the distance in bytes between the member values
+ * of subsequent elements. This allows systems that only access a subset of the
+ * members of a component to work with member arrays directly:
+ * 
+ * @code
+ * ecs_member_field_t vx = ecs_field_member(&it, 1, "x");
+ * for (int32_t i = 0; i < it.count; i ++) {
+ *   float *x = ecs_member_at(vx, float, i);
+ * }
+ * @endcode
+ * 
+ * The member name may refer to a nested member, for example "position.x". The
+ * field type must be a struct registered with the meta addon. If the field is
+ * not owned by the iterated entities (ecs_field_is_self() returns false), the 
+ * stride is 0, as all entities share the same value.
+ * 
+ * Components are stored as arrays of structs, so the stride is the size of the
+ * component. This operation looks up the member by name each time it is 
+ * called. Code that runs for every iterated table should look up the member
+ * once with ecs_member_ref_init(), and use ecs_field_member_ref() instead.
+ * 
+ * @param it The iterator.
+ * @param index The field index.
+ * @param member The member name.
+ * @return The member view. The ptr member is NULL if the field or member does
+ *         not exist.
+ */
+FLECS_API
+ecs_member_field_t ecs_field_member(
+    const ecs_iter_t *it,
+    int8_t index,
+    const char *member);
+
+/** Member of a struct type, resolved by ecs_member_ref_init(). */
+typedef struct ecs_member_ref_t {
+    ecs_entity_t component;    /**< Struct type the member was resolved for. */
+    ecs_entity_t type;         /**< Type of the member, 0 if not found. */
+    ecs_size_t offset;         /**< Offset of the member in the struct. */
+} ecs_member_ref_t;
+
+/** Look up a member of a struct type for use with ecs_field_member_ref().
+ * The member name may refer to a nested member, for example "position.x".
+ * 
+ * @param world The world.
+ * @param component The struct type.
+ * @param member The member name.
+ * @return The member. The type member is 0 if the member does not exist.
+ */
+FLECS_API
+ecs_member_ref_t ecs_member_ref_init(
+    const ecs_world_t *world,
+    ecs_entity_t component,
+    const char *member);
+
+/** Same as ecs_field_member(), but with a member that was looked up in advance.
+ * The member must have been resolved for the type of the field.
+ * 
+ * @code
+ * ecs_member_ref_t ref = ecs_member_ref_init(world, ecs_id(Position), "x");
+ * 
+ * while (ecs_query_next(&it)) {
+ *   ecs_member_field_t vx = ecs_field_member_ref(&it, 0, &ref);
+ *   for (int32_t i = 0; i < it.count; i ++) {
+ *     float *x = ecs_member_at(vx, float, i);
+ *   }
+ * }
+ * @endcode
+ * 
+ * @param it The iterator.
+ * @param index The field index.
+ * @param member The member.
+ * @return The member view. The ptr member is NULL if the field has no data or
+ *         the member does not exist.
+ */
+FLECS_API
+ecs_member_field_t ecs_field_member_ref(
+    const ecs_iter_t *it,
+    int8_t index,
+    const ecs_member_ref_t *member);
+
+/** Get member value for element in member field. */
+#define ecs_member_at(field, T, index)\
+    ((T*)ECS_OFFSET((field).ptr, (field).stride * (index)))
+
 /* API functions for creating meta types */
 
 /** Used with ecs_primitive_init(). */
@@ -1161,6 +1289,85 @@ ecs_member_t* ecs_struct_get_member(
     ecs_entity_t type,
     const char *name);
 
+/** Find entities with an indexed member value.
+ * This operation returns the entities for which a member is set to the provided
+ * value. The member must have the Indexed trait, which can be added to numeric,
+ * enum and entity members. This operation does not support floating point 
+ * members, use ecs_member_index_range() instead.
+ * 
+ * @code
+ * ecs_entity_t member = ecs_lookup(world, "Player.id");
+ * ecs_add_id(world, member, EcsIndexed);
+ * 
+ * int32_t count;
+ * const ecs_entity_t *players = ecs_member_index_find(world, member, 10, &count);
+ * @endcode
+ * 
+ * Signed values are sign extended to 64 bits. Rows that were written since the
+ * previous lookup are indexed again first, except in multithreaded mode. The 
+ * returned array is valid until the next time the indexed component is set, 
+ * written or removed.
+ * 
+ * @param world The world.
+ * @param member The member entity.
+ * @param value The member value.
+ * @param count Output parameter for the number of returned entities.
+ * @return The entities with the value, or NULL if no entities have the value
+ *         or the member is not indexed.
+ */
+FLECS_API
+const ecs_entity_t* ecs_member_index_find(
+    const ecs_world_t *world,
+    ecs_entity_t member,
+    uint64_t value,
+    int32_t *count);
+
+/** Value range used with ecs_member_index_range(). 
+ * Bounds point to a value of the member type. */
+typedef struct ecs_member_range_t {
+    const void *min;      /**< Lower bound, or NULL for no lower bound. */
+    const void *max;      /**< Upper bound, or NULL for no upper bound. */
+    bool min_exclusive;   /**< Exclude entities with a value equal to min (>). */
+    bool max_exclusive;   /**< Exclude entities with a value equal to max (<). */
+} ecs_member_range_t;
+
+/** Find entities with an indexed member value in a range.
+ * This operation returns the entities for which a member value is within the
+ * provided range, ordered by value. The member must have the Indexed trait.
+ * 
+ * @code
+ * float max = 20;
+ * int32_t count;
+ * const ecs_entity_t *entities = ecs_member_index_range(world, member, 
+ *   &(ecs_member_range_t){ .max = &max, .max_exclusive = true }, &count);
+ * @endcode
+ * 
+ * The first range lookup creates a sorted array for the index. Lookups find the
+ * bounds in the sorted array in O(log N) time, where N is the number of indexed
+ * entities. Entities of which the value changed after the previous lookup are
+ * merged into the sorted array by the next lookup. This rebuilds the array, 
+ * which is O(N + K log K) for K changed entities. The returned array is valid
+ * until the next time the indexed component is set, written or removed. 
+ * 
+ * The operation can be called from systems, including multithreaded systems.
+ * In multithreaded mode the merge is protected by a mutex of the index, and 
+ * rows written since the previous lookup are not indexed again until the next
+ * lookup outside of multithreaded mode.
+ * 
+ * @param world The world.
+ * @param member The member entity.
+ * @param range The value range.
+ * @param count Output parameter for the number of returned entities.
+ * @return The entities in the range, or NULL if no entities are in the range or
+ *         the member is not indexed.
+ */
+FLECS_API
+const ecs_entity_t* ecs_member_index_range(
+    const ecs_world_t *world,
+    ecs_entity_t member,
+    const ecs_member_range_t *range,
+    int32_t *count);
+
 /** Get member by index from struct.
  * 
  * @param world The world.
@@ -281,6 +281,59 @@ FLECS_API
 bool ecs_using_task_threads(
     ecs_world_t *world);
 
+/** Enable or disable work stealing for multi-threaded systems.
+ * By default the entities matched by a multi-threaded system are divided evenly
+ * across workers. When work stealing is enabled, each worker gets a queue of
+ * row ranges per matched table, and workers that run out of work claim ranges
+ * from the queues of other workers. This balances the load when tables are of
+ * very different sizes. 
+ * 
+ * When work stealing is enabled, workers and the main thread also spin for a
+ * short while before blocking on a sync point, which reduces the overhead of
+ * waking up threads for pipelines with many (short) sync points.
+ * 
+ * Work stealing requires the OS API to provide atomic compare and swap. The
+ * operation must not be called while running a system or pipeline.
+ *
+ * @param world The world.
+ * @param enable Whether to enable work stealing.
+ */
+FLECS_API
+void ecs_set_work_stealing(
+    ecs_world_t *world,
+    bool enable);
+
+/** Enable or disable running single-threaded systems concurrently.
+ * By default systems that are not multi-threaded run one after another on the
+ * main thread. When this setting is enabled, single-threaded systems between 
+ * two sync points that have ecs_system_desc_t::concurrent set are divided into
+ * groups of systems that read or write the same components. Groups that don't have components in common are run at the
+ * same time on different workers. Systems in the same group run on the same
+ * worker, in pipeline order.
+ * 
+ * Which components a system accesses is derived from the terms of the system
+ * query, taking into account inout annotations. Systems that access components
+ * that are not in the query (for example with ecs_get()) should annotate those
+ * components with terms that don't match entities, like `[in] Position()`.
+ * Systems without terms are never run concurrently with other systems.
+ * 
+ * Systems that run concurrently have the same restrictions as multi-threaded
+ * systems. Operations that create entities, like ecs_new(), ecs_entity_init(),
+ * ecs_make_alive() and ecs_bulk_new(), are not allowed, which is why systems
+ * have to opt in. If a system between two sync points did not opt in, all
+ * systems between those sync points run on the main thread.
+ * 
+ * The setting only has effect when the world has multiple threads. The 
+ * operation must not be called while running a system or pipeline.
+ *
+ * @param world The world.
+ * @param enable Whether to run single-threaded systems concurrently.
+ */
+FLECS_API
+void ecs_set_concurrent_systems(
+    ecs_world_t *world,
+    bool enable);
+
 ////////////////////////////////////////////////////////////////////////////////
 //// Module
 ////////////////////////////////////////////////////////////////////////////////
@@ -195,7 +195,9 @@ typedef struct ecs_system_stats_t {
 typedef struct ecs_sync_stats_t {
     int64_t first_;                /**< Used for field iteration. Do not set. */
     ecs_metric_t time_spent;       /**< Time spent in sync point. */
+    ecs_metric_t wait_time;        /**< Time spent waiting for workers to reach sync point. */
     ecs_metric_t commands_enqueued; /**< Number of commands enqueued. */
+    ecs_metric_t tasks_stolen;     /**< Number of tasks stolen between workers. */
     int64_t last_;                 /**< Used for field iteration. Do not set. */
 
     int32_t system_count;          /**< Number of systems before sync point. */
@@ -207,6 +209,11 @@ typedef struct ecs_sync_stats_t {
 typedef struct ecs_pipeline_stats_t {
     int8_t canary_;                /**< Allow for initializing struct with {0}. Do not set. */
 
+    int64_t first_;                /**< Used for field iteration. Do not set. */
+    ecs_metric_t frame_time;       /**< Time spent running the pipeline. */
+    ecs_metric_t sync_time;        /**< Time spent in sync points (waiting for workers and merging). */
+    int64_t last_;                 /**< Used for field iteration. Do not set. */
+
     /** Vector with system IDs of all systems in the pipeline. The systems are
      * stored in the order they are executed. Merges are represented by a 0. */
     ecs_vec_t systems;
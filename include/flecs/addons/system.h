@@ -96,6 +96,29 @@ typedef struct ecs_system_desc_t {
     /** If true, the system will be run on multiple threads. */
     bool multi_threaded;
 
+    /** If true, the system may run at the same time as other concurrent 
+     * systems on a worker thread, when enabled with 
+     * ecs_set_concurrent_systems(). Concurrent systems have the same 
+     * restrictions as multi-threaded systems, and cannot create entities. */
+    bool concurrent;
+
+    /** If set, threads of a multithreaded system claim chunks of this many 
+     * rows from a shared cursor, instead of each thread getting an equal part
+     * of each matched table. See ecs_worker_chunk_iter(). Only used when the
+     * system is run by a pipeline, ecs_run_worker() divides each table equally.
+     * A negative value resets the chunk size to 0 with ecs_system_update(). */
+    int32_t chunk_size;
+
+    /** If true, a multithreaded system with a query that uses group_by (such as
+     * a cascade query) runs the query groups one at a time, and divides the 
+     * entities of each group across the threads. Threads wait for each other
+     * before they start the next group, so for cascade queries parents are
+     * always processed before their children. When the system is run with
+     * ecs_run_worker(), it must be run for every stage index. Set to a
+     * positive value to enable. A negative value disables the feature, which
+     * can be used to turn it off with ecs_system_update(). */
+    int8_t parallel_levels;
+
     /** If true, the system will have access to the actual world. Cannot be true at the
      * same time as multi_threaded. */
     bool immediate;
@@ -160,6 +183,25 @@ typedef struct ecs_system_t {
     /** Whether the system is multithreaded. */
     bool multi_threaded;
 
+    /** Whether the system can run concurrently with other systems. */
+    bool concurrent;
+
+    /** Number of rows claimed at a time by threads of a multithreaded system. */
+    int32_t chunk_size;
+
+    /** Whether threads run query groups one at a time. */
+    bool parallel_levels;
+
+    /** Number of threads that finished the current query group. */
+    int32_t level_waiting;
+
+    /** Incremented when all threads finished the current query group. */
+    int32_t level_gen;
+
+    /** Mutex and condition variable for threads waiting on a query group. */
+    ecs_os_mutex_t level_mutex;
+    ecs_os_cond_t level_cond;
+
     /** Whether the system is run in immediate mode. */
     bool immediate;
 
@@ -324,6 +366,8 @@ ecs_entity_t ecs_run(
     void *param);
 
 /** Same as ecs_run(), but subdivides entities across a number of provided stages.
+ * Each stage gets an equal part of each matched table. The chunk_size of the
+ * system is not used, as there is no cursor shared between calls.
  *
  * @param world The world.
  * @param system The system to run.
@@ -144,6 +144,23 @@ typedef
 int64_t (*ecs_os_api_lainc_t)(
     int64_t *value);
 
+/** Atomic compare and swap. */
+/** OS API acas function type.
+ * Replaces value with desired if it is equal to expected. Returns the value
+ * before the operation. */
+typedef
+int32_t (*ecs_os_api_acas_t)(
+    int32_t *value,
+    int32_t expected,
+    int32_t desired);
+
+/** OS API lacas function type. */
+typedef
+int64_t (*ecs_os_api_lacas_t)(
+    int64_t *value,
+    int64_t expected,
+    int64_t desired);
+
 /** Mutex. */
 /** OS API mutex_new function type. */
 typedef
@@ -307,6 +324,10 @@ typedef struct ecs_os_api_t {
     ecs_os_api_lainc_t lainc_;                     /**< lainc callback. */
     ecs_os_api_lainc_t ladec_;                     /**< ladec callback. */
 
+    /* Atomic compare and swap */
+    ecs_os_api_acas_t acas_;                       /**< acas callback. */
+    ecs_os_api_lacas_t lacas_;                     /**< lacas callback. */
+
     /* Mutex */
     ecs_os_api_mutex_new_t mutex_new_;             /**< mutex_new callback. */
     ecs_os_api_mutex_free_t mutex_free_;           /**< mutex_free callback. */
@@ -525,6 +546,10 @@ void ecs_os_set_api_defaults(void);
 #define ecs_os_lainc(value) ecs_os_api.lainc_(value)
 #define ecs_os_ladec(value) ecs_os_api.ladec_(value)
 
+/* Atomic compare and swap */
+#define ecs_os_acas(value, expected, desired) ecs_os_api.acas_(value, expected, desired)
+#define ecs_os_lacas(value, expected, desired) ecs_os_api.lacas_(value, expected, desired)
+
 /* Mutex */
 #define ecs_os_mutex_new() ecs_os_api.mutex_new_()
 #define ecs_os_mutex_free(mutex) ecs_os_api.mutex_free_(mutex)
@@ -773,6 +798,10 @@ bool ecs_os_has_threading(void);
 FLECS_API
 bool ecs_os_has_task_support(void);
 
+/** Are atomic compare and swap functions available? */
+FLECS_API
+bool ecs_os_has_atomic_cas(void);
+
 /** Are time functions available? */
 FLECS_API
 bool ecs_os_has_time(void);
@@ -24,6 +24,8 @@ extern "C" {
 #define EcsWorldMeasureSystemTime     (1u << 6)
 #define EcsWorldMultiThreaded         (1u << 7)
 #define EcsWorldFrameInProgress       (1u << 8)
+#define EcsWorldWorkStealing          (1u << 9)
+#define EcsWorldConcurrentSystems     (1u << 10)
 
 ////////////////////////////////////////////////////////////////////////////////
 //// OS API flags
@@ -92,6 +94,7 @@ extern "C" {
         EcsIdHasOnTableCreate|EcsIdHasOnTableDelete|EcsIdSparse|\
         EcsIdOrderedChildren)
 #define EcsIdPrefabChildren            (1u << 26)
+#define EcsIdIndexed                   (1u << 27)
 
 #define EcsIdMarkedForDelete           (1u << 30)
 
@@ -117,6 +120,7 @@ extern "C" {
 #define EcsNonTrivialIdSparse          (1u << 0)
 #define EcsNonTrivialIdNonFragmenting  (1u << 1)
 #define EcsNonTrivialIdInherit         (1u << 2)
+#define EcsNonTrivialIdIndexed         (1u << 3)
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -214,6 +218,7 @@ extern "C" {
 #define EcsObserverBypassQuery         (1u << 7u)  /* Don't evaluate query for multi-component observer. */
 #define EcsObserverYieldOnCreate       (1u << 8u)  /* Yield matching entities when creating observer. */
 #define EcsObserverYieldOnDelete       (1u << 9u)  /* Yield matching entities when deleting observer. */
+#define EcsObserverBatched             (1u << 10u) /* Buffer events and deliver them as table ranges on flush. */
 #define EcsObserverKeepAlive           (1u << 11u) /* Observer keeps component alive (same value as EcsTermKeepAlive). */
 
 ////////////////////////////////////////////////////////////////////////////////
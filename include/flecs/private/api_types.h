@@ -49,7 +49,9 @@ struct ecs_observable_t {
     ecs_event_record_t on_wildcard;
     ecs_sparse_t events;  /* sparse<event, ecs_event_record_t> */
     ecs_vec_t global_observers; /* vector<ecs_observable_t> */
+    ecs_vec_t batched_observers; /* vector<ecs_observer_t*> with pending events */
     uint64_t last_observer_id;
+    uint32_t dispatch_generation; /* Incremented when observed ids change */
 };
 
 /** Range in a table. */
@@ -93,6 +95,19 @@ typedef struct ecs_page_iter_t {
 typedef struct ecs_worker_iter_t {
     int32_t index;
     int32_t count;
+
+    /* Work stealing */
+    struct ecs_worker_steal_t *steal; /* Shared state of stages running the same iterator. */
+    int32_t result;               /* Index of current result. */
+    int32_t task_count;           /* Number of tasks in current result. */
+    int32_t victim;               /* Stage from which tasks are being claimed. */
+
+    /* Chunked iteration */
+    int32_t *cursor;              /* Shared cursor with index of next chunk. */
+    int32_t chunk_size;           /* Number of rows per chunk. */
+    int32_t row;                  /* Next row to iterate in current chunk. */
+    int32_t row_end;              /* End of current chunk. */
+    int32_t base;                 /* Row number of first row in current result. */
 } ecs_worker_iter_t;
 
 /* Convenience struct to iterate a table array for an ID. */
@@ -137,6 +152,12 @@ typedef struct ecs_query_iter_t {
 
     int16_t op;                               /* Currently iterated query plan operation (index into ops). */
     bool iter_single_group;
+
+    /* Partitioned iteration. */
+    int32_t partition_index, partition_count; /* Partition of results yielded by iterator. */
+    int32_t partition_cur;                    /* Number of results seen by the partition filter. */
+    int16_t partition_op;                     /* Driver operation that is filtered, -1 if results are filtered. */
+    uint8_t partition_kind;                   /* Instruction kind of driver operation. */
 } ecs_query_iter_t;
 
 /* Private iterator data. Used by iterator implementations to keep track of
@@ -2424,4 +2424,111 @@ double ecs_meta_ptr_to_float(
     return flecs_meta_to_float(kind, ptr);
 }
 
+ecs_member_ref_t ecs_member_ref_init(
+    const ecs_world_t *world,
+    ecs_entity_t component,
+    const char *member)
+{
+    ecs_member_ref_t result = {0};
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(component != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(member != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    world = ecs_get_world(world);
+
+    ecs_entity_t type = component;
+    ecs_size_t offset = 0;
+    const char *name = member;
+
+    do {
+        const EcsStruct *st = ecs_get(world, type, EcsStruct);
+        if (!st) {
+            return result;
+        }
+
+        const char *sep = strchr(name, '.');
+        ecs_size_t len = sep ? flecs_ito(ecs_size_t, sep - name) : 
+            ecs_os_strlen(name);
+
+        int32_t i, count = ecs_vec_count(&st->members);
+        ecs_member_t *members = ecs_vec_first_t(&st->members, ecs_member_t);
+        for (i = 0; i < count; i ++) {
+            if (!ecs_os_strncmp(members[i].name, name, len) && 
+                !members[i].name[len]) 
+            {
+                break;
+            }
+        }
+
+        if (i == count) {
+            return result;
+        }
+
+        type = members[i].type;
+        offset += members[i].offset;
+        name = sep ? sep + 1 : NULL;
+    } while (name);
+
+    result.component = component;
+    result.type = type;
+    result.offset = offset;
+error:
+    return result;
+}
+
+ecs_member_field_t ecs_field_member_ref(
+    const ecs_iter_t *it,
+    int8_t index,
+    const ecs_member_ref_t *member)
+{
+    ecs_member_field_t result = {0};
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(member != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(index >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(index < it->field_count, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!member->type || member->component == 
+        ecs_get_typeid(it->real_world, ecs_field_id(it, index)),
+            ECS_INVALID_PARAMETER, 
+            "member was not resolved for the type of the field");
+
+    if (!member->type) {
+        return result;
+    }
+
+    size_t size = ecs_field_size(it, index);
+    void *ptr = ecs_field_w_size(it, size, index);
+    if (!ptr) {
+        return result;
+    }
+
+    result.ptr = ECS_OFFSET(ptr, member->offset);
+    result.type = member->type;
+    if (ecs_field_is_self(it, index)) {
+        result.stride = flecs_uto(ecs_size_t, size);
+    }
+
+error:
+    return result;
+}
+
+ecs_member_field_t ecs_field_member(
+    const ecs_iter_t *it,
+    int8_t index,
+    const char *member)
+{
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(index >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(index < it->field_count, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_entity_t type = ecs_get_typeid(it->real_world, ecs_field_id(it, index));
+    if (!type) {
+        return (ecs_member_field_t){0};
+    }
+
+    ecs_member_ref_t ref = ecs_member_ref_init(it->real_world, type, member);
+    return ecs_field_member_ref(it, index, &ref);
+error:
+    return (ecs_member_field_t){0};
+}
+
 #endif
@@ -0,0 +1,833 @@
+/**
+ * @file addons/meta/member_index.c
+ * @brief Value index for struct members.
+ *
+ * Members with the Indexed trait get an EcsMemberIndex component, which maps
+ * member values to the entities that have the value. The index is kept up to
+ * date by an observer for the component that contains the member, which is
+ * created as child of the member entity. Entities are indexed when the 
+ * component is added, so that entities that never get an OnSet event are
+ * indexed with their initial value.
+ *
+ * Values that are written without an OnSet event are found with the dirty
+ * state of the component column, which is enabled for all tables with the
+ * component. Before the index is used, rows in chunks that were written since
+ * a table was last indexed are indexed again.
+ *
+ * Values are stored as unsigned keys that have the same order as the member
+ * values, so that the index can also be used for range lookups. The sorted
+ * arrays for range lookups are created on first use. After that, changed 
+ * entities are collected and merged into the sorted arrays on the next lookup,
+ * so that setting a value doesn't have to move elements in the arrays. Values
+ * only change while the world is not multithreaded, so a mutex that serializes
+ * the merge is enough to make lookups from worker threads safe.
+ */
+
+#include "meta.h"
+
+#ifdef FLECS_META
+
+static
+void flecs_member_index_fini(
+    EcsMemberIndex *ptr)
+{
+    ecs_map_iter_t it = ecs_map_iter(&ptr->values);
+    while (ecs_map_next(&it)) {
+        ecs_vec_t *entities = ecs_map_ptr(&it);
+        ecs_vec_fini_t(NULL, entities, ecs_entity_t);
+        ecs_os_free(entities);
+    }
+
+    ecs_map_fini(&ptr->values);
+    ecs_map_fini(&ptr->entities);
+    ecs_map_fini(&ptr->changed);
+    ecs_map_fini(&ptr->synced);
+    ecs_vec_fini_t(NULL, &ptr->sorted_keys, uint64_t);
+    ecs_vec_fini_t(NULL, &ptr->sorted_entities, ecs_entity_t);
+    if (ptr->lock) {
+        ecs_os_mutex_free(ptr->lock);
+    }
+}
+
+static ECS_CTOR(EcsMemberIndex, ptr, {
+    ecs_os_zeromem(ptr);
+    ecs_map_init(&ptr->values, NULL);
+    ecs_map_init(&ptr->entities, NULL);
+    ecs_map_init(&ptr->changed, NULL);
+    ecs_map_init(&ptr->synced, NULL);
+    if (ecs_os_has_threading()) {
+        ptr->lock = ecs_os_mutex_new();
+    }
+})
+
+static ECS_MOVE(EcsMemberIndex, dst, src, {
+    flecs_member_index_fini(dst);
+    *dst = *src;
+    ecs_os_zeromem(src);
+})
+
+static ECS_DTOR(EcsMemberIndex, ptr, {
+    flecs_member_index_fini(ptr);
+})
+
+static
+uint64_t flecs_member_index_signed(
+    int64_t value)
+{
+    return (uint64_t)value ^ (1ull << 63);
+}
+
+static
+uint64_t flecs_member_index_float(
+    double value)
+{
+    uint64_t bits;
+    ecs_os_memcpy(&bits, &value, ECS_SIZEOF(uint64_t));
+    if (bits & (1ull << 63)) {
+        return ~bits;
+    } else {
+        return bits | (1ull << 63);
+    }
+}
+
+static
+uint64_t flecs_member_index_key(
+    ecs_primitive_kind_t kind,
+    const void *ptr)
+{
+    switch(kind) {
+    case EcsBool: return *(const bool*)ptr;
+    case EcsChar: return flecs_member_index_signed(*(const char*)ptr);
+    case EcsByte: return *(const ecs_byte_t*)ptr;
+    case EcsU8: return *(const uint8_t*)ptr;
+    case EcsU16: return *(const uint16_t*)ptr;
+    case EcsU32: return *(const uint32_t*)ptr;
+    case EcsU64: return *(const uint64_t*)ptr;
+    case EcsUPtr: return *(const uintptr_t*)ptr;
+    case EcsI8: return flecs_member_index_signed(*(const int8_t*)ptr);
+    case EcsI16: return flecs_member_index_signed(*(const int16_t*)ptr);
+    case EcsI32: return flecs_member_index_signed(*(const int32_t*)ptr);
+    case EcsI64: return flecs_member_index_signed(*(const int64_t*)ptr);
+    case EcsIPtr: return flecs_member_index_signed(*(const intptr_t*)ptr);
+    case EcsF32: return flecs_member_index_float(*(const float*)ptr);
+    case EcsF64: return flecs_member_index_float(*(const double*)ptr);
+    case EcsEntity: return *(const ecs_entity_t*)ptr;
+    case EcsId: return *(const ecs_id_t*)ptr;
+    case EcsString:
+    default:
+        ecs_abort(ECS_INTERNAL_ERROR, NULL);
+    }
+}
+
+static
+ecs_primitive_kind_t flecs_member_index_kind(
+    const ecs_world_t *world,
+    ecs_entity_t type)
+{
+    const EcsEnum *enum_type = ecs_get(world, type, EcsEnum);
+    if (enum_type) {
+        type = enum_type->underlying_type;
+    }
+
+    const EcsPrimitive *prim = ecs_get(world, type, EcsPrimitive);
+    if (!prim) {
+        return 0;
+    }
+
+    if (prim->kind == EcsString) {
+        return 0;
+    }
+
+    return prim->kind;
+}
+
+static
+void flecs_member_index_remove(
+    EcsMemberIndex *index,
+    ecs_entity_t e)
+{
+    ecs_map_val_t *value = ecs_map_get(&index->entities, e);
+    if (!value) {
+        return;
+    }
+
+    ecs_vec_t *entities = ecs_map_get_deref(&index->values, ecs_vec_t, *value);
+    ecs_assert(entities != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_entity_t *array = ecs_vec_first_t(entities, ecs_entity_t);
+    int32_t i, count = ecs_vec_count(entities);
+    for (i = 0; i < count; i ++) {
+        if (array[i] == e) {
+            ecs_vec_remove_t(entities, ecs_entity_t, i);
+            break;
+        }
+    }
+
+    ecs_assert(i != count, ECS_INTERNAL_ERROR, NULL);
+
+    if (!ecs_vec_count(entities)) {
+        ecs_vec_fini_t(NULL, entities, ecs_entity_t);
+        ecs_map_remove_free(&index->values, *value);
+    }
+
+    ecs_map_remove(&index->entities, e);
+
+    if (index->sorted) {
+        ecs_map_ensure(&index->changed, e);
+    }
+}
+
+static
+void flecs_member_index_set(
+    EcsMemberIndex *index,
+    ecs_entity_t e,
+    uint64_t value)
+{
+    ecs_map_val_t *cur = ecs_map_get(&index->entities, e);
+    if (cur) {
+        if (*cur == value) {
+            return;
+        }
+        flecs_member_index_remove(index, e);
+    }
+
+    ecs_vec_t *entities = ecs_map_ensure_alloc_t(
+        &index->values, ecs_vec_t, value);
+    ecs_vec_append_t(NULL, entities, ecs_entity_t)[0] = e;
+    ecs_map_insert(&index->entities, e, value);
+
+    if (index->sorted) {
+        ecs_map_ensure(&index->changed, e);
+    }
+}
+
+/* Dirty states of a table column and of the table structure when the table
+ * was last indexed, stored as a single map value. */
+static
+uint64_t flecs_member_index_state(
+    const ecs_table_t *table,
+    int32_t column)
+{
+    return ((uint64_t)(uint32_t)table->dirty_state[0] << 32) | 
+        (uint32_t)table->dirty_state[column + 1];
+}
+
+static
+uint64_t flecs_member_index_synced_state(
+    const EcsMemberIndex *index,
+    const ecs_table_t *table)
+{
+    /* Tables created after the index start with the initial dirty state */
+    ecs_map_val_t *synced = ecs_map_get(&index->synced, table->id);
+    return synced ? *synced : ((1ull << 32) | 1);
+}
+
+/* Index rows again that are in chunks written after the synced state */
+static
+void flecs_member_index_reindex(
+    EcsMemberIndex *index,
+    ecs_table_t *table,
+    int32_t column,
+    int32_t synced,
+    bool all)
+{
+    int32_t count = ecs_table_count(table);
+    if (!count) {
+        return;
+    }
+
+    const ecs_entity_t *entities = ecs_table_entities(table);
+    ecs_column_t *c = &table->data.columns[column];
+    ecs_size_t size = c->ti->size;
+    int32_t chunk, chunk_count = ((count - 1) >> FLECS_CHANGE_CHUNK_BITS) + 1;
+
+    for (chunk = 0; chunk < chunk_count; chunk ++) {
+        if (!all) {
+            int32_t state = flecs_table_get_chunk_dirty_state(
+                table, column + 1, chunk);
+            if ((int32_t)((uint32_t)state - (uint32_t)synced) <= 0) {
+                continue;
+            }
+        }
+
+        int32_t row = chunk << FLECS_CHANGE_CHUNK_BITS;
+        int32_t end = (chunk + 1) << FLECS_CHANGE_CHUNK_BITS;
+        if (end > count) {
+            end = count;
+        }
+
+        for (; row < end; row ++) {
+            void *value = ECS_OFFSET(
+                ECS_ELEM(c->data, size, row), index->offset);
+            flecs_member_index_set(index, entities[row], 
+                flecs_member_index_key(index->kind, value));
+        }
+    }
+}
+
+/* Index rows again that were written since the previous sync. A row written 
+ * in a table that also changed structure may have moved to another row or 
+ * table before it was indexed again, so in that case all tables that changed
+ * structure are indexed again. Returns whether any table was indexed. */
+static
+bool flecs_member_index_sync(
+    const ecs_world_t *world,
+    EcsMemberIndex *index)
+{
+    world = ecs_get_world(world);
+    if (world->flags & EcsWorldMultiThreaded) {
+        return false;
+    }
+
+    ecs_component_record_t *cr = flecs_components_get(world, index->component);
+    if (!cr) {
+        return false;
+    }
+
+    ecs_table_cache_iter_t it;
+    const ecs_table_record_t *tr;
+    bool moved = false, changed = false;
+
+    if (flecs_table_cache_all_iter(&cr->cache, &it)) {
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            ecs_table_t *table = tr->hdr.table;
+            ecs_assert(table->dirty_state != NULL, ECS_INTERNAL_ERROR, NULL);
+            uint64_t state = flecs_member_index_state(table, tr->column);
+            uint64_t synced = flecs_member_index_synced_state(index, table);
+            if ((uint32_t)state != (uint32_t)synced && 
+                (state >> 32) != (synced >> 32)) 
+            {
+                moved = true;
+                break;
+            }
+        }
+    }
+
+    if (flecs_table_cache_all_iter(&cr->cache, &it)) {
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            ecs_table_t *table = tr->hdr.table;
+            uint64_t state = flecs_member_index_state(table, tr->column);
+            uint64_t synced = flecs_member_index_synced_state(index, table);
+            if (state == synced) {
+                continue;
+            }
+
+            if (moved && (state >> 32) != (synced >> 32)) {
+                flecs_member_index_reindex(index, table, tr->column, 0, true);
+            } else if ((uint32_t)state != (uint32_t)synced) {
+                flecs_member_index_reindex(index, table, tr->column, 
+                    (int32_t)(uint32_t)synced, false);
+            }
+
+            ecs_map_ensure(&index->synced, table->id)[0] = state;
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+int flecs_member_index_sync_table(
+    const ecs_world_t *world,
+    EcsMemberIndex *index,
+    const ecs_table_t *table,
+    const ecs_table_record_t *tr)
+{
+    if (tr->column == -1 || !table->dirty_state) {
+        return -1;
+    }
+
+    if (flecs_member_index_state(table, tr->column) == 
+        flecs_member_index_synced_state(index, table))
+    {
+        return 0;
+    }
+
+    /* Lookups from worker threads don't modify the index */
+    if (ecs_get_world(world)->flags & EcsWorldMultiThreaded) {
+        return -1;
+    }
+
+    return flecs_member_index_sync(world, index);
+}
+
+typedef struct {
+    uint64_t key;
+    ecs_entity_t entity;
+} flecs_member_index_elem_t;
+
+static
+int flecs_member_index_elem_cmp(
+    const void *ptr_a,
+    const void *ptr_b)
+{
+    const flecs_member_index_elem_t *a = ptr_a;
+    const flecs_member_index_elem_t *b = ptr_b;
+    if (a->key != b->key) {
+        return (a->key > b->key) - (a->key < b->key);
+    }
+    return (a->entity > b->entity) - (a->entity < b->entity);
+}
+
+/* Merge changed entities into the sorted arrays used for range lookups */
+static
+void flecs_member_index_sort(
+    EcsMemberIndex *index)
+{
+    ecs_map_t *changed = &index->changed;
+    if (index->sorted && !ecs_map_count(changed)) {
+        return;
+    }
+
+    /* Collect current values of changed entities, or of all entities if the 
+     * sorted arrays don't exist yet. */
+    ecs_vec_t elems;
+    ecs_vec_init_t(NULL, &elems, flecs_member_index_elem_t, 
+        index->sorted ? ecs_map_count(changed) : ecs_map_count(&index->entities));
+
+    ecs_map_iter_t it = ecs_map_iter(
+        index->sorted ? changed : &index->entities);
+    while (ecs_map_next(&it)) {
+        ecs_entity_t e = ecs_map_key(&it);
+        ecs_map_val_t *value = ecs_map_get(&index->entities, e);
+        if (value) {
+            flecs_member_index_elem_t *elem = ecs_vec_append_t(
+                NULL, &elems, flecs_member_index_elem_t);
+            elem->key = *value;
+            elem->entity = e;
+        }
+    }
+
+    int32_t new_count = ecs_vec_count(&elems);
+    flecs_member_index_elem_t *new_elems = ecs_vec_first(&elems);
+    qsort(new_elems, flecs_itosize(new_count), 
+        sizeof(flecs_member_index_elem_t), flecs_member_index_elem_cmp);
+
+    /* Merge with existing elements, skipping changed entities */
+    int32_t old_count = ecs_vec_count(&index->sorted_keys);
+    uint64_t *old_keys = ecs_vec_first(&index->sorted_keys);
+    ecs_entity_t *old_entities = ecs_vec_first(&index->sorted_entities);
+
+    ecs_vec_t keys, entities;
+    int32_t size = ecs_map_count(&index->entities);
+    ecs_vec_init_t(NULL, &keys, uint64_t, size);
+    ecs_vec_init_t(NULL, &entities, ecs_entity_t, size);
+
+    int32_t o = 0, n = 0;
+    while (o < old_count || n < new_count) {
+        if (o < old_count && ecs_map_get(changed, old_entities[o])) {
+            o ++;
+            continue;
+        }
+
+        bool take_new;
+        if (o == old_count) {
+            take_new = true;
+        } else if (n == new_count) {
+            take_new = false;
+        } else {
+            flecs_member_index_elem_t old_elem = {
+                old_keys[o], old_entities[o] };
+            take_new = flecs_member_index_elem_cmp(
+                &new_elems[n], &old_elem) < 0;
+        }
+
+        if (take_new) {
+            ecs_vec_append_t(NULL, &keys, uint64_t)[0] = new_elems[n].key;
+            ecs_vec_append_t(NULL, &entities, ecs_entity_t)[0] = 
+                new_elems[n].entity;
+            n ++;
+        } else {
+            ecs_vec_append_t(NULL, &keys, uint64_t)[0] = old_keys[o];
+            ecs_vec_append_t(NULL, &entities, ecs_entity_t)[0] = 
+                old_entities[o];
+            o ++;
+        }
+    }
+
+    ecs_vec_fini_t(NULL, &elems, flecs_member_index_elem_t);
+    ecs_vec_fini_t(NULL, &index->sorted_keys, uint64_t);
+    ecs_vec_fini_t(NULL, &index->sorted_entities, ecs_entity_t);
+    index->sorted_keys = keys;
+    index->sorted_entities = entities;
+    index->sorted = true;
+    ecs_map_clear(changed);
+}
+
+/* Return index of first element with key >= value (or > value if upper) */
+static
+int32_t flecs_member_index_bound(
+    const EcsMemberIndex *index,
+    uint64_t value,
+    bool upper)
+{
+    const uint64_t *keys = ecs_vec_first(&index->sorted_keys);
+    int32_t lo = 0, hi = ecs_vec_count(&index->sorted_keys);
+    while (lo < hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        if (keys[mid] < value || (upper && keys[mid] == value)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static
+void flecs_member_index_on_event(
+    ecs_iter_t *it)
+{
+    ecs_world_t *world = it->real_world;
+    ecs_entity_t member = (ecs_entity_t)(uintptr_t)it->ctx;
+    EcsMemberIndex *index = ecs_get_mut(world, member, EcsMemberIndex);
+    if (!index) {
+        /* Index is being removed */
+        return;
+    }
+
+    int32_t i, count = it->count;
+    if (it->event == EcsOnRemove) {
+        for (i = 0; i < count; i ++) {
+            flecs_member_index_remove(index, it->entities[i]);
+        }
+        return;
+    }
+
+    ecs_size_t size = it->sizes[0];
+    void *ptr = ecs_field_w_size(it, flecs_itosize(size), 0);
+    for (i = 0; i < count; i ++) {
+        void *value = ECS_OFFSET(ECS_ELEM(ptr, size, i), index->offset);
+        flecs_member_index_set(index, it->entities[i],
+            flecs_member_index_key(index->kind, value));
+    }
+}
+
+/* Track changes for tables created after the index */
+static
+void flecs_member_index_on_table(
+    ecs_iter_t *it)
+{
+    ecs_world_t *world = it->real_world;
+    ecs_entity_t member = (ecs_entity_t)(uintptr_t)it->ctx;
+    ecs_table_t *table = it->table;
+
+    if (it->event == EcsOnTableCreate) {
+        flecs_table_get_dirty_state(world, table);
+        return;
+    }
+
+    EcsMemberIndex *index = ecs_get_mut(world, member, EcsMemberIndex);
+    if (index) {
+        ecs_map_remove(&index->synced, table->id);
+    }
+}
+
+/* Enable change tracking for the component, so that values written without
+ * an OnSet event are indexed again. */
+static
+void flecs_member_index_track(
+    ecs_world_t *world,
+    EcsMemberIndex *index)
+{
+    ecs_entity_t component = index->component;
+    ecs_component_record_t *cr = flecs_components_ensure(world, component);
+    cr->flags |= EcsIdIndexed;
+    if (component < FLECS_HI_COMPONENT_ID) {
+        world->non_trivial_lookup[component] |= EcsNonTrivialIdIndexed;
+    }
+
+    ecs_table_cache_iter_t it;
+    if (flecs_table_cache_all_iter(&cr->cache, &it)) {
+        const ecs_table_record_t *tr;
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            ecs_table_t *table = tr->hdr.table;
+            flecs_table_get_dirty_state(world, table);
+            ecs_map_ensure(&index->synced, table->id)[0] = 
+                flecs_member_index_state(table, tr->column);
+        }
+    }
+}
+
+static
+void flecs_member_index_on_remove(
+    ecs_iter_t *it)
+{
+    ecs_world_t *world = it->world;
+    EcsMemberIndex *index = ecs_field(it, EcsMemberIndex, 0);
+
+    if (ecs_is_fini(world)) {
+        return;
+    }
+
+    int32_t i, count = it->count;
+    for (i = 0; i < count; i ++) {
+        if (index[i].observer) {
+            ecs_delete(world, index[i].observer);
+        }
+        if (index[i].table_observer) {
+            ecs_delete(world, index[i].table_observer);
+        }
+    }
+}
+
+static
+void flecs_indexed_on_add(
+    ecs_iter_t *it)
+{
+    ecs_world_t *world = it->world;
+    EcsMember *m = ecs_field(it, EcsMember, 1);
+
+    int32_t i, count = it->count;
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t member = it->entities[i];
+        ecs_entity_t component = ecs_get_parent(world, member);
+        ecs_primitive_kind_t kind = flecs_member_index_kind(world, m[i].type);
+        int32_t offset = m[i].offset;
+
+        /* Members of nested structs are indexed for the component that
+         * contains the outer struct. */
+        const EcsMember *parent;
+        while (component && (parent = ecs_get(world, component, EcsMember))) {
+            if (parent->count > 1) {
+                component = 0;
+                break;
+            }
+            offset += parent->offset;
+            component = ecs_get_parent(world, component);
+        }
+
+        if (component && !ecs_has(world, component, EcsComponent)) {
+            component = 0;
+        }
+
+        if (!kind || m[i].count > 1 || !component) {
+            char *path = ecs_get_path(world, member);
+            ecs_err("cannot index member '%s': member must be a number, "
+                "enum or entity", path);
+            ecs_os_free(path);
+            continue;
+        }
+
+        EcsMemberIndex *index = ecs_ensure(world, member, EcsMemberIndex);
+        index->component = component;
+        index->kind = kind;
+        index->offset = offset;
+        ecs_modified(world, member, EcsMemberIndex);
+    }
+}
+
+static
+void flecs_indexed_on_remove(
+    ecs_iter_t *it)
+{
+    ecs_world_t *world = it->world;
+
+    int32_t i, count = it->count;
+    for (i = 0; i < count; i ++) {
+        ecs_remove(world, it->entities[i], EcsMemberIndex);
+    }
+}
+
+static
+void flecs_member_index_on_set(
+    ecs_iter_t *it)
+{
+    ecs_world_t *world = it->world;
+    EcsMemberIndex *index = ecs_field(it, EcsMemberIndex, 0);
+
+    int32_t i, count = it->count;
+    for (i = 0; i < count; i ++) {
+        if (index[i].observer) {
+            continue;
+        }
+
+        ecs_entity_t member = it->entities[i];
+
+        ecs_entity_t table_observer = ecs_observer(world, {
+            .entity = ecs_entity(world, { .parent = member }),
+            .query.terms = {{ .id = index[i].component, .src.id = EcsSelf }},
+            .query.flags = EcsQueryTableOnly,
+            .events = { EcsOnTableCreate, EcsOnTableDelete },
+            .callback = flecs_member_index_on_table,
+            .ctx = (void*)(uintptr_t)member
+        });
+
+        /* Observer yields existing values, which populates the index */
+        ecs_entity_t observer = ecs_observer(world, {
+            .entity = ecs_entity(world, { .parent = member }),
+            .query.terms = {{
+                .id = index[i].component,
+                .src.id = EcsSelf,
+                .inout = EcsIn
+            }},
+            .events = { EcsOnAdd, EcsOnSet, EcsOnRemove },
+            .callback = flecs_member_index_on_event,
+            .ctx = (void*)(uintptr_t)member,
+            .yield_existing = true
+        });
+
+        EcsMemberIndex *ptr = ecs_get_mut(world, member, EcsMemberIndex);
+        ptr->observer = observer;
+        ptr->table_observer = table_observer;
+        flecs_member_index_track(world, ptr);
+    }
+}
+
+const ecs_entity_t* ecs_member_index_find(
+    const ecs_world_t *world,
+    ecs_entity_t member,
+    uint64_t value,
+    int32_t *count)
+{
+    ecs_check(count != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    *count = 0;
+
+    /* Const cast is safe, the index is only synced outside of multithreaded
+     * mode. */
+    EcsMemberIndex *index = ECS_CONST_CAST(EcsMemberIndex*, 
+        ecs_get(world, member, EcsMemberIndex));
+    if (!index) {
+        return NULL;
+    }
+
+    flecs_member_index_sync(world, index);
+
+    switch(index->kind) {
+    case EcsChar:
+    case EcsI8:
+    case EcsI16:
+    case EcsI32:
+    case EcsI64:
+    case EcsIPtr:
+        value = flecs_member_index_signed((int64_t)value);
+        break;
+    case EcsF32:
+    case EcsF64:
+        ecs_throw(ECS_INVALID_PARAMETER, 
+            "cannot find floating point values, use ecs_member_index_range()");
+    default:
+        break;
+    }
+
+    ecs_vec_t *entities = ecs_map_get_deref(&index->values, ecs_vec_t, value);
+    if (!entities) {
+        return NULL;
+    }
+
+    *count = ecs_vec_count(entities);
+    return ecs_vec_first_t(entities, ecs_entity_t);
+error:
+    return NULL;
+}
+
+const ecs_entity_t* ecs_member_index_range(
+    const ecs_world_t *world,
+    ecs_entity_t member,
+    const ecs_member_range_t *range,
+    int32_t *count)
+{
+    ecs_check(range != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(count != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    *count = 0;
+
+    /* Const cast is safe, the sorted arrays are a cache of the index that is
+     * only updated while holding the lock in multithreaded mode. */
+    EcsMemberIndex *index = ECS_CONST_CAST(EcsMemberIndex*, 
+        ecs_get(world, member, EcsMemberIndex));
+    if (!index) {
+        return NULL;
+    }
+
+    flecs_member_index_sync(world, index);
+
+    if (ecs_get_world(world)->flags & EcsWorldMultiThreaded) {
+        ecs_assert(index->lock != 0, ECS_MISSING_OS_API, NULL);
+        ecs_os_mutex_lock(index->lock);
+        flecs_member_index_sort(index);
+        ecs_os_mutex_unlock(index->lock);
+    } else {
+        flecs_member_index_sort(index);
+    }
+
+    int32_t start = 0, end = ecs_vec_count(&index->sorted_keys);
+    if (range->min) {
+        start = flecs_member_index_bound(index, 
+            flecs_member_index_key(index->kind, range->min), 
+            range->min_exclusive);
+    }
+    if (range->max) {
+        end = flecs_member_index_bound(index, 
+            flecs_member_index_key(index->kind, range->max), 
+            !range->max_exclusive);
+    }
+
+    if (start >= end) {
+        return NULL;
+    }
+
+    *count = end - start;
+    return ecs_vec_get_t(&index->sorted_entities, ecs_entity_t, start);
+error:
+    return NULL;
+}
+
+void flecs_meta_member_index_init(
+    ecs_world_t *world)
+{
+    ecs_component(world, {
+        .entity = ecs_entity(world, { .id = ecs_id(EcsMemberIndex),
+            .name = "member_index", .symbol = "EcsMemberIndex",
+            .add = ecs_ids(ecs_pair(EcsOnInstantiate, EcsDontInherit))
+        }),
+        .type.size = sizeof(EcsMemberIndex),
+        .type.alignment = ECS_ALIGNOF(EcsMemberIndex)
+    });
+
+    ecs_set_hooks(world, EcsMemberIndex, {
+        .ctor = ecs_ctor(EcsMemberIndex),
+        .move = ecs_move(EcsMemberIndex),
+        .dtor = ecs_dtor(EcsMemberIndex),
+        .flags = ECS_TYPE_HOOK_COPY_ILLEGAL
+    });
+
+    ecs_entity(world, { .id = EcsIndexed,
+        .name = "indexed", .symbol = "EcsIndexed",
+        .add = ecs_ids(EcsTrait)
+    });
+
+    ecs_observer(world, {
+        .query.terms = {
+            { .id = EcsIndexed },
+            { .id = ecs_id(EcsMember), .inout = EcsIn }
+        },
+        .events = {EcsOnAdd},
+        .callback = flecs_indexed_on_add,
+        .global_observer = true
+    });
+
+    ecs_observer(world, {
+        .query.terms[0] = { .id = EcsIndexed },
+        .events = {EcsOnRemove},
+        .callback = flecs_indexed_on_remove,
+        .global_observer = true
+    });
+
+    ecs_observer(world, {
+        .query.terms[0] = { .id = ecs_id(EcsMemberIndex) },
+        .events = {EcsOnSet},
+        .callback = flecs_member_index_on_set,
+        .global_observer = true
+    });
+
+    ecs_observer(world, {
+        .query.terms[0] = { .id = ecs_id(EcsMemberIndex) },
+        .events = {EcsOnRemove},
+        .callback = flecs_member_index_on_remove,
+        .global_observer = true
+    });
+}
+
+#endif
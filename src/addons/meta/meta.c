@@ -304,6 +304,7 @@ void FlecsMetaImport(
     flecs_meta_array_init(world);
     flecs_meta_opaque_init(world);
     flecs_meta_units_init(world);
+    flecs_meta_member_index_init(world);
 
     /* Import reflection definitions for builtin types */
     flecs_meta_import_definitions(world);
@@ -32,6 +32,17 @@ int flecs_expr_ser_primitive(
 void flecs_rtt_init_default_hooks(
     ecs_iter_t *it);
 
+void flecs_meta_member_index_init(
+    ecs_world_t *world);
+
+/* Returns -1 if the index can't be used for the table, 1 if the index was
+ * updated and 0 if the index didn't change. */
+int flecs_member_index_sync_table(
+    const ecs_world_t *world,
+    EcsMemberIndex *index,
+    const ecs_table_t *table,
+    const ecs_table_record_t *tr);
+
 const char* flecs_meta_op_kind_str(
     ecs_meta_op_kind_t kind);
 
@@ -132,6 +132,56 @@ int64_t posix_ladec(
 #endif
 }
 
+static
+int32_t posix_acas(
+    int32_t *value,
+    int32_t expected,
+    int32_t desired)
+{
+    int32_t result;
+#ifdef __GNUC__
+    result = __sync_val_compare_and_swap(value, expected, desired);
+    return result;
+#else
+    if (pthread_mutex_lock(&atomic_mutex)) {
+        abort();
+    }
+    result = *value;
+    if (result == expected) {
+        *value = desired;
+    }
+    if (pthread_mutex_unlock(&atomic_mutex)) {
+        abort();
+    }
+    return result;
+#endif
+}
+
+static
+int64_t posix_lacas(
+    int64_t *value,
+    int64_t expected,
+    int64_t desired)
+{
+    int64_t result;
+#ifdef __GNUC__
+    result = __sync_val_compare_and_swap(value, expected, desired);
+    return result;
+#else
+    if (pthread_mutex_lock(&atomic_mutex)) {
+        abort();
+    }
+    result = *value;
+    if (result == expected) {
+        *value = desired;
+    }
+    if (pthread_mutex_unlock(&atomic_mutex)) {
+        abort();
+    }
+    return result;
+#endif
+}
+
 static
 ecs_os_mutex_t posix_mutex_new(void) {
     pthread_mutex_t *mutex = ecs_os_malloc(sizeof(pthread_mutex_t));
@@ -333,6 +383,8 @@ void ecs_set_os_api_impl(void) {
     api.adec_ = posix_adec;
     api.lainc_ = posix_lainc;
     api.ladec_ = posix_ladec;
+    api.acas_ = posix_acas;
+    api.lacas_ = posix_lacas;
     api.mutex_new_ = posix_mutex_new;
     api.mutex_free_ = posix_mutex_free;
     api.mutex_lock_ = posix_mutex_lock;
@@ -85,6 +85,25 @@ int64_t win_ladec(
     return InterlockedDecrement64(count);
 }
 
+static
+int32_t win_acas(
+    int32_t *value,
+    int32_t expected,
+    int32_t desired)
+{
+    return InterlockedCompareExchange(
+        (volatile long*)value, desired, expected);
+}
+
+static
+int64_t win_lacas(
+    int64_t *value,
+    int64_t expected,
+    int64_t desired)
+{
+    return InterlockedCompareExchange64(value, desired, expected);
+}
+
 static
 ecs_os_mutex_t win_mutex_new(void) {
     CRITICAL_SECTION *mutex = ecs_os_malloc_t(CRITICAL_SECTION);
@@ -290,6 +309,8 @@ void ecs_set_os_api_impl(void) {
     api.adec_ = win_adec;
     api.lainc_ = win_lainc;
     api.ladec_ = win_ladec;
+    api.acas_ = win_acas;
+    api.lacas_ = win_lacas;
     api.mutex_new_ = win_mutex_new;
     api.mutex_free_ = win_mutex_free;
     api.mutex_lock_ = win_mutex_lock;
@@ -162,6 +162,8 @@ void ecs_frame_end(
         "cannot end frame while frame is not in progress");
 
     world->info.frame_count_total ++;
+
+    flecs_observers_flush_batched(world);
     
     int32_t i, count = world->stage_count;
     for (i = 0; i < count; i ++) {
@@ -19,6 +19,10 @@ static void flecs_pipeline_state_free(
         ecs_allocator_t *a = &world->allocator;
         ecs_vec_fini_t(a, &p->ops, ecs_pipeline_op_t);
         ecs_vec_fini_t(a, &p->systems, ecs_system_t*);
+        ecs_vec_fini_t(a, &p->groups, int32_t);
+        ecs_vec_fini_t(a, &p->steal, ecs_worker_steal_t);
+        ecs_vec_fini_t(a, &p->steal_deques, int64_t);
+        ecs_vec_fini_t(a, &p->sort_queries, ecs_query_cache_t*);
         ecs_os_free(p->iters);
         ecs_os_free(p);
     }
@@ -53,6 +57,7 @@ typedef struct ecs_write_state_t {
     bool write_barrier;
     ecs_map_t ids;
     ecs_map_t wildcard_ids;
+    ecs_map_t this_ids;         /* Ids written to main storage in operation */
 } ecs_write_state_t;
 
 static
@@ -129,6 +134,7 @@ void flecs_pipeline_reset_write_state(
 {
     ecs_map_clear(&write_state->ids);
     ecs_map_clear(&write_state->wildcard_ids);
+    ecs_map_clear(&write_state->this_ids);
     write_state->write_barrier = false;
 }
 
@@ -183,6 +189,12 @@ bool flecs_pipeline_check_term(
         from_any = true;
     }
 
+    if (from_this && !from_any && is_active && 
+        (inout == EcsOut || inout == EcsInOut)) 
+    {
+        ecs_map_ensure(&write_state->this_ids, id)[0] = true;
+    }
+
     if (from_any) {
         switch(inout) {
         case EcsOut:
@@ -250,6 +262,240 @@ bool flecs_pipeline_check_terms(
     return needs_merge;
 }
 
+/* Queries with order_by are sorted before an operation runs. If a system in the
+ * operation writes the order_by component before a system that iterates the 
+ * sorted query, the system must run in the next operation. */
+static
+bool flecs_pipeline_check_order_by(
+    ecs_query_t *query,
+    ecs_write_state_t *ws)
+{
+    ecs_query_cache_t *cache = flecs_query_impl(query)->cache;
+    if (!cache || !cache->order_by_callback) {
+        return false;
+    }
+
+    ecs_entity_t order_by = cache->order_by;
+    if (!order_by) {
+        /* Sorted on entity id, which isn't written by systems */
+        return false;
+    }
+
+    ecs_map_iter_t it = ecs_map_iter(&ws->this_ids);
+    while (ecs_map_next(&it)) {
+        if (ecs_id_match(ecs_map_key(&it), order_by) ||
+            ecs_id_match(order_by, ecs_map_key(&it))) 
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+typedef struct ecs_pipeline_access_t {
+    ecs_id_t id;
+    int32_t system;             /* Index of system in operation */
+    bool write;
+} ecs_pipeline_access_t;
+
+/* Add components accessed by system to access vector. Returns false if it 
+ * can't be determined which components a system accesses. */
+static
+bool flecs_pipeline_system_access(
+    ecs_world_t *world,
+    ecs_query_t *query,
+    int32_t system,
+    ecs_vec_t *access)
+{
+    ecs_term_t *terms = query->terms;
+    int32_t t, term_count = query->term_count;
+
+    if (!term_count) {
+        /* Systems without terms can access anything */
+        return false;
+    }
+
+    for (t = 0; t < term_count; t ++) {
+        ecs_term_t *term = &terms[t];
+        ecs_id_t id = term->id;
+        int16_t inout = term->inout;
+        bool from_any = ecs_term_match_0(term);
+        bool is_shared = !from_any && 
+            (!ecs_term_match_this(term) || !(term->src.id & EcsSelf));
+
+        if (inout == EcsInOutFilter || inout == EcsInOutNone) {
+            continue;
+        }
+
+        if (inout == EcsInOutDefault) {
+            if (from_any) {
+                continue;
+            } else if (is_shared) {
+                inout = EcsIn;
+            } else {
+                inout = EcsInOut;
+            }
+        }
+
+        if (term->oper == EcsNot && inout != EcsOut) {
+            /* Not terms only test whether an entity has a component, and 
+             * changes to which components an entity has are deferred. */
+            continue;
+        }
+
+        if (!ecs_id_is_wildcard(id) && !ecs_get_typeid(world, id)) {
+            /* Tags don't have data that can be accessed */
+            continue;
+        }
+
+        ecs_pipeline_access_t *elem = ecs_vec_append_t(
+            &world->allocator, access, ecs_pipeline_access_t);
+        elem->id = id;
+        elem->system = system;
+        elem->write = inout != EcsIn;
+    }
+
+    return true;
+}
+
+static
+int32_t flecs_pipeline_group_root(
+    int32_t *parents,
+    int32_t system)
+{
+    while (parents[system] != system) {
+        parents[system] = parents[parents[system]];
+        system = parents[system];
+    }
+    return system;
+}
+
+/* Divide single-threaded systems of an operation into groups of systems that
+ * access the same components. Groups are numbered by decreasing size, so that
+ * assigning groups round-robin to stages spreads out the largest groups. */
+static
+void flecs_pipeline_build_op_groups(
+    ecs_world_t *world,
+    ecs_pipeline_state_t *pq,
+    ecs_pipeline_op_t *op,
+    ecs_vec_t *access,
+    ecs_vec_t *parents)
+{
+    ecs_allocator_t *a = &world->allocator;
+    int32_t i, j, count = op->count;
+
+    /* Systems are initially all in group 0 */
+    op->group_count = 1;
+
+    if (op->multi_threaded || op->immediate || count < 2) {
+        return;
+    }
+
+    int32_t *groups = ecs_vec_get_t(&pq->groups, int32_t, op->offset);
+    ecs_system_t **systems = ecs_vec_get_t(
+        &pq->systems, ecs_system_t*, op->offset);
+
+    ecs_vec_clear(access);
+    for (i = 0; i < count; i ++) {
+        /* Systems that didn't opt in to running concurrently can do things
+         * that aren't allowed on worker threads, like creating entities. */
+        if (!systems[i]->concurrent) {
+            return;
+        }
+
+        if (!flecs_pipeline_system_access(
+            world, systems[i]->query, i, access)) 
+        {
+            return;
+        }
+    }
+
+    ecs_vec_set_count_t(a, parents, int32_t, count);
+    int32_t *p = ecs_vec_first_t(parents, int32_t);
+    for (i = 0; i < count; i ++) {
+        p[i] = i;
+    }
+
+    /* Merge groups of systems with conflicting access */
+    int32_t access_count = ecs_vec_count(access);
+    ecs_pipeline_access_t *acc = ecs_vec_first_t(access, ecs_pipeline_access_t);
+    for (i = 0; i < access_count; i ++) {
+        for (j = i + 1; j < access_count; j ++) {
+            if (acc[i].system == acc[j].system) {
+                continue;
+            }
+            if (!acc[i].write && !acc[j].write) {
+                continue;
+            }
+            if (!ecs_id_match(acc[i].id, acc[j].id) && 
+                !ecs_id_match(acc[j].id, acc[i].id)) 
+            {
+                continue;
+            }
+
+            int32_t root_i = flecs_pipeline_group_root(p, acc[i].system);
+            int32_t root_j = flecs_pipeline_group_root(p, acc[j].system);
+            if (root_i < root_j) {
+                p[root_j] = root_i;
+            } else {
+                p[root_i] = root_j;
+            }
+        }
+    }
+
+    /* Count systems per group, using the group array as temporary storage. */
+    for (i = 0; i < count; i ++) {
+        p[i] = flecs_pipeline_group_root(p, i);
+        groups[p[i]] ++;
+    }
+
+    /* Number groups by decreasing size */
+    int32_t group_count = 0;
+    do {
+        int32_t largest = -1;
+        for (i = 0; i < count; i ++) {
+            if (groups[i] > 0 && (largest == -1 || groups[i] > groups[largest])) {
+                largest = i;
+            }
+        }
+        if (largest == -1) {
+            break;
+        }
+
+        /* Store group index as negative number so it's not mistaken for a
+         * system count. */
+        groups[largest] = -(++ group_count);
+    } while (true);
+
+    for (i = 0; i < count; i ++) {
+        p[i] = -groups[p[i]] - 1;
+    }
+
+    ecs_os_memcpy_n(groups, p, int32_t, count);
+    op->group_count = group_count;
+}
+
+static
+void flecs_pipeline_build_groups(
+    ecs_world_t *world,
+    ecs_pipeline_state_t *pq)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_t access, parents;
+    ecs_vec_init_t(a, &access, ecs_pipeline_access_t, 0);
+    ecs_vec_init_t(a, &parents, int32_t, 0);
+
+    int32_t i, count = ecs_vec_count(&pq->ops);
+    ecs_pipeline_op_t *ops = ecs_vec_first_t(&pq->ops, ecs_pipeline_op_t);
+    for (i = 0; i < count; i ++) {
+        flecs_pipeline_build_op_groups(world, pq, &ops[i], &access, &parents);
+    }
+
+    ecs_vec_fini_t(a, &access, ecs_pipeline_access_t);
+    ecs_vec_fini_t(a, &parents, int32_t);
+}
+
 static
 EcsPoly* flecs_pipeline_term_system(
     ecs_iter_t *it)
@@ -284,9 +530,11 @@ bool flecs_pipeline_build(
     ecs_write_state_t ws = {0};
     ecs_map_init(&ws.ids, a);
     ecs_map_init(&ws.wildcard_ids, a);
+    ecs_map_init(&ws.this_ids, a);
 
     ecs_vec_reset_t(a, &pq->ops, ecs_pipeline_op_t);
     ecs_vec_reset_t(a, &pq->systems, ecs_system_t*);
+    ecs_vec_reset_t(a, &pq->groups, int32_t);
 
     bool multi_threaded = false;
     bool immediate = false;
@@ -305,7 +553,11 @@ bool flecs_pipeline_build(
             ecs_query_t *q = sys->query;
 
             bool needs_merge = false;
-            needs_merge = flecs_pipeline_check_terms(
+            if (is_active) {
+                needs_merge = flecs_pipeline_check_order_by(q, &ws);
+            }
+
+            needs_merge |= flecs_pipeline_check_terms(
                 world, q, is_active, &ws);
 
             if (is_active) {
@@ -363,17 +615,26 @@ bool flecs_pipeline_build(
                 op->multi_threaded = false;
                 op->immediate = false;
                 op->time_spent = 0;
+                op->wait_time = 0;
                 op->commands_enqueued = 0;
+                op->tasks_stolen = 0;
+                op->group_count = 1;
+                op->order_by = false;
             }
 
             /* Don't increase count for inactive systems, as they are ignored by
              * the query used to run the pipeline. */
             if (is_active) {
                 ecs_vec_append_t(a, &pq->systems, ecs_system_t*)[0] = sys;
+                ecs_vec_append_t(a, &pq->groups, int32_t)[0] = 0;
                 if (!op->count) {
                     op->multi_threaded = multi_threaded;
                     op->immediate = immediate;
                 }
+                ecs_query_cache_t *cache = flecs_query_impl(q)->cache;
+                if (cache && cache->order_by_callback) {
+                    op->order_by = true;
+                }
                 op->count ++;
             }
         }
@@ -385,6 +646,10 @@ bool flecs_pipeline_build(
 
     ecs_map_fini(&ws.ids);
     ecs_map_fini(&ws.wildcard_ids);
+    ecs_map_fini(&ws.this_ids);
+
+    /* Find systems that can run concurrently */
+    flecs_pipeline_build_groups(world, pq);
 
     op = ecs_vec_first_t(&pq->ops, ecs_pipeline_op_t);
 
@@ -549,6 +814,34 @@ void ecs_run_pipeline(
     }
 }
 
+/* Initialize state shared between stages for the systems in the current 
+ * operation. Work stealing deques are only created if work stealing is on. */
+static
+void flecs_pipeline_steal_init(
+    ecs_world_t *world,
+    ecs_pipeline_state_t *pq,
+    int32_t stage_count)
+{
+    ecs_allocator_t *a = &world->allocator;
+    int32_t i, count = pq->cur_op->count;
+    int32_t deque_count = 0;
+    if (world->flags & EcsWorldWorkStealing) {
+        deque_count = FLECS_WORKER_STEAL_RING * stage_count;
+    }
+
+    ecs_vec_set_count_t(a, &pq->steal, ecs_worker_steal_t, count);
+    ecs_vec_set_count_t(a, &pq->steal_deques, int64_t, count * deque_count);
+
+    ecs_worker_steal_t *steal = ecs_vec_first_t(&pq->steal, ecs_worker_steal_t);
+    int64_t *deques = ecs_vec_first_t(&pq->steal_deques, int64_t);
+
+    for (i = 0; i < count; i ++) {
+        steal[i].deques = deque_count ? &deques[i * deque_count] : NULL;
+        steal[i].stage_count = stage_count;
+        flecs_worker_steal_reset(&steal[i]);
+    }
+}
+
 int32_t flecs_run_pipeline_ops(
     ecs_world_t* world,
     ecs_stage_t* stage,
@@ -560,12 +853,18 @@ int32_t flecs_run_pipeline_ops(
     ecs_pipeline_op_t* op = pq->cur_op;
     int32_t i = pq->cur_i;
 
-    ecs_assert(!stage_index || op->multi_threaded, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(!stage_index || op->multi_threaded || pq->concurrent, 
+        ECS_INTERNAL_ERROR, NULL);
 
     int32_t count = ecs_vec_count(&pq->systems);
     ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
+    int32_t *groups = NULL;
     int32_t ran_since_merge = i - op->offset;
 
+    if (pq->concurrent) {
+        groups = ecs_vec_first_t(&pq->groups, int32_t);
+    }
+
     for (; i < count; i++) {
         ecs_system_t* sys = systems[i];
 
@@ -576,17 +875,27 @@ int32_t flecs_run_pipeline_ops(
             sys->last_frame = world->info.frame_count_total + 1;
         }
 
-        ecs_stage_t* s = NULL;
-        if (!op->immediate) {
-            /* If system is immediate it operates on the actual world, not
-             * the stage. Only pass stage to system if it is not immediate. */
-            s = stage;
-        }
+        /* When systems run concurrently, each group is run by one stage */
+        if (!groups || ((groups[i] % stage_count) == stage_index)) {
+            ecs_stage_t* s = NULL;
+            if (!op->immediate) {
+                /* If system is immediate it operates on the actual world, not
+                 * the stage. Only pass stage to system if it is not immediate. */
+                s = stage;
+            }
+
+            ecs_worker_steal_t *steal = NULL;
+            if (ecs_vec_count(&pq->steal)) {
+                steal = ecs_vec_get_t(
+                    &pq->steal, ecs_worker_steal_t, i - op->offset);
+            }
+
+            flecs_run_system(world, s, sys->query->entity, sys, stage_index,
+                stage_count, delta_time, NULL, steal);
 
-        flecs_run_system(world, s, sys->query->entity, sys, stage_index,
-            stage_count, delta_time, NULL);
+            ecs_os_linc(&world->info.systems_ran_total);
+        }
 
-        ecs_os_linc(&world->info.systems_ran_total);
         ran_since_merge++;
 
         if (ran_since_merge == op->count) {
@@ -598,6 +907,109 @@ int32_t flecs_run_pipeline_ops(
     return i;
 }
 
+void flecs_run_pipeline_sort(
+    ecs_world_t *world,
+    int32_t stage_count)
+{
+    ecs_pipeline_state_t *pq = world->pq;
+    ecs_query_cache_t **caches = ecs_vec_first_t(
+        &pq->sort_queries, ecs_query_cache_t*);
+
+    if (pq->sorting == EcsPipelineSortTables) {
+        /* Queries can match the same tables, so tables are sorted for one 
+         * query at a time. */
+        flecs_query_cache_sort_run(world, caches[pq->sort_query], stage_count);
+    } else {
+        int32_t i, count = ecs_vec_count(&pq->sort_queries);
+        for (i = 0; i < count; i ++) {
+            flecs_query_cache_merge_run(caches[i], stage_count);
+        }
+    }
+}
+
+/* Run a sort phase on the main thread and, if there is enough work, on the
+ * workers. */
+static
+void flecs_pipeline_sort_phase(
+    ecs_world_t *world,
+    ecs_pipeline_state_t *pq,
+    ecs_pipeline_sort_phase_t phase,
+    int32_t job_count,
+    int32_t stage_count)
+{
+    pq->sorting = phase;
+
+    if (stage_count > 1 && job_count >= FLECS_PARALLEL_SORT_MIN_JOBS) {
+        flecs_signal_workers(world);
+        flecs_run_pipeline_sort(world, stage_count);
+        flecs_wait_for_sync(world);
+    } else {
+        flecs_run_pipeline_sort(world, 1);
+    }
+
+    pq->sorting = EcsPipelineSortNone;
+}
+
+/* Sort the order_by queries of systems in an operation before the systems run,
+ * so that sorting is distributed across workers instead of running on the 
+ * thread of the first system that iterates a query. Tables are sorted first,
+ * after which the sorted tables of each group are merged into slices. Workers
+ * are only signalled if a query has tables that changed since the last sort. */
+static
+void flecs_pipeline_sort_queries(
+    ecs_world_t *world,
+    ecs_pipeline_state_t *pq,
+    int32_t stage_count)
+{
+    ecs_pipeline_op_t *op = pq->cur_op;
+    ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
+    int32_t i, end = op->offset + op->count, merge_count = 0;
+
+    ecs_vec_clear(&pq->sort_queries);
+
+    for (i = pq->cur_i; i < end; i ++) {
+        ecs_query_cache_t *cache = flecs_query_impl(systems[i]->query)->cache;
+        if (!cache || !cache->order_by_callback) {
+            continue;
+        }
+
+        /* Tables can't change until the next merge, so iterators created by
+         * systems in the operation don't have to sort the query again. */
+        cache->sort_merge_count = world->info.merge_count_total;
+
+        if (!flecs_query_cache_sort_prepare(world, cache)) {
+            continue;
+        }
+
+        ecs_vec_append_t(&world->allocator, &pq->sort_queries, 
+            ecs_query_cache_t*)[0] = cache;
+    }
+
+    int32_t count = ecs_vec_count(&pq->sort_queries);
+    if (!count) {
+        return;
+    }
+
+    ecs_query_cache_t **caches = ecs_vec_first_t(
+        &pq->sort_queries, ecs_query_cache_t*);
+    for (i = 0; i < count; i ++) {
+        int32_t job_count = ecs_vec_count(&caches[i]->sort_jobs);
+        if (job_count) {
+            pq->sort_query = i;
+            flecs_pipeline_sort_phase(world, pq, EcsPipelineSortTables, 
+                job_count, stage_count);
+        }
+        merge_count += caches[i]->merge_job_count;
+    }
+
+    flecs_pipeline_sort_phase(
+        world, pq, EcsPipelineSortMerge, merge_count, stage_count);
+
+    for (i = 0; i < count; i ++) {
+        flecs_query_cache_sort_finish(caches[i]);
+    }
+}
+
 void flecs_run_pipeline(
     ecs_world_t *world,
     ecs_pipeline_state_t *pq,
@@ -616,6 +1028,12 @@ void flecs_run_pipeline(
     ecs_assert(!stage_index, ECS_INVALID_OPERATION, 
         "cannot run pipeline on stage");
 
+    bool measure_time = world->flags & EcsWorldMeasureSystemTime;
+    ecs_time_t ft = { 0 };
+    if (measure_time) {
+        ecs_time_measure(&ft);
+    }
+
     // Update the pipeline the workers will execute
     world->pq = pq;
 
@@ -632,8 +1050,18 @@ void flecs_run_pipeline(
 
         bool immediate = pq->cur_op->immediate;
         bool op_multi_threaded = multi_threaded && pq->cur_op->multi_threaded;
+        bool op_concurrent = multi_threaded && !op_multi_threaded && 
+            !immediate && (pq->cur_op->group_count > 1) &&
+            (world->flags & EcsWorldConcurrentSystems);
+        bool op_workers = op_multi_threaded || op_concurrent;
 
         pq->immediate = immediate;
+        pq->concurrent = op_concurrent;
+
+        if (pq->cur_op->order_by) {
+            flecs_pipeline_sort_queries(
+                world, pq, multi_threaded ? stage_count : 1);
+        }
 
         if (!immediate) {
             ecs_readonly_begin(world, multi_threaded);
@@ -641,15 +1069,15 @@ void flecs_run_pipeline(
             flecs_defer_begin(world, stage);
         }
 
-        ECS_BIT_COND(world->flags, EcsWorldMultiThreaded, op_multi_threaded);
+        ECS_BIT_COND(world->flags, EcsWorldMultiThreaded, op_workers);
         ecs_assert(world->workers_waiting == 0, ECS_INTERNAL_ERROR, NULL);
 
-        if (op_multi_threaded) {
+        if (op_workers) {
+            flecs_pipeline_steal_init(world, pq, stage_count);
             flecs_signal_workers(world);
         }
 
         ecs_time_t st = { 0 };
-        bool measure_time = world->flags & EcsWorldMeasureSystemTime;
         if (measure_time) {
             ecs_time_measure(&st);
         }
@@ -662,8 +1090,27 @@ void flecs_run_pipeline(
             world->info.system_time_total += (ecs_ftime_t)ecs_time_measure(&st);
         }
 
-        if (op_multi_threaded) {
+        if (op_workers) {
+            ecs_time_t wt = { 0 };
+            if (measure_time) {
+                ecs_time_measure(&wt);
+            }
+
             flecs_wait_for_sync(world);
+
+            if (measure_time) {
+                double wait_time = ecs_time_measure(&wt);
+                pq->cur_op->wait_time += wait_time;
+                pq->sync_time += wait_time;
+            }
+
+            int32_t si, steal_count = ecs_vec_count(&pq->steal);
+            ecs_worker_steal_t *steal = ecs_vec_first_t(
+                &pq->steal, ecs_worker_steal_t);
+            for (si = 0; si < steal_count; si ++) {
+                pq->cur_op->tasks_stolen += steal[si].stolen;
+            }
+            ecs_vec_clear(&pq->steal);
         }
 
         if (!immediate) {
@@ -680,10 +1127,13 @@ void flecs_run_pipeline(
 
             ecs_readonly_end(world);
             if (measure_time) {
-                pq->cur_op->time_spent += ecs_time_measure(&mt);
+                double merge_time = ecs_time_measure(&mt);
+                pq->cur_op->time_spent += merge_time;
+                pq->sync_time += merge_time;
             }
         } else {
             flecs_defer_end(world, stage);
+            flecs_observers_flush_batched(world);
         }
 
         /* Store the current state of the schedule after we synchronized the
@@ -692,6 +1142,10 @@ void flecs_run_pipeline(
 
         flecs_pipeline_update(world, pq, false);
     }
+
+    if (measure_time) {
+        pq->frame_time += ecs_time_measure(&ft);
+    }
 }
 
 static
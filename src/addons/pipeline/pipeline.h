@@ -14,15 +14,28 @@ typedef struct ecs_pipeline_op_t {
     int32_t offset;             /* Offset in systems vector */
     int32_t count;              /* Number of systems to run before next op */
     double time_spent;          /* Time spent merging commands for sync point */
+    double wait_time;           /* Time spent waiting for workers at sync point */
     int64_t commands_enqueued;  /* Number of commands enqueued for sync point */
+    int64_t tasks_stolen;       /* Number of tasks stolen between workers */
+    int32_t group_count;        /* Number of groups of systems that don't access
+                                 * the same components */
     bool multi_threaded;        /* Whether systems can be run multi-threaded */
     bool immediate;           /* Whether systems run in immediate mode */
+    bool order_by;              /* Whether a system query uses order_by */
 } ecs_pipeline_op_t;
 
+/* Sort phase that workers run before an operation */
+typedef enum ecs_pipeline_sort_phase_t {
+    EcsPipelineSortNone,
+    EcsPipelineSortTables,      /* Sort tables of queries */
+    EcsPipelineSortMerge        /* Merge sorted tables into slices */
+} ecs_pipeline_sort_phase_t;
+
 struct ecs_pipeline_state_t {
     ecs_query_t *query;         /* Pipeline query */
     ecs_vec_t ops;              /* Pipeline schedule */
     ecs_vec_t systems;          /* Vector with system ids */
+    ecs_vec_t groups;           /* Vector with group index per system */
 
     ecs_entity_t last_system;   /* Last system run by pipeline */
     int32_t match_count;        /* Used to track if rebuild is necessary */
@@ -30,11 +43,24 @@ struct ecs_pipeline_state_t {
     ecs_iter_t *iters;          /* Iterator for worker(s) */
     int32_t iter_count;
 
+    /* Work stealing state for systems in the current operation */
+    ecs_vec_t steal;            /* vec<ecs_worker_steal_t> */
+    ecs_vec_t steal_deques;     /* vec<int64_t> */
+
+    double frame_time;          /* Time spent running the pipeline */
+    double sync_time;           /* Time spent in sync points */
+
     /* Members for continuing pipeline iteration after pipeline rebuild */
     ecs_pipeline_op_t *cur_op;  /* Current pipeline op */
     int32_t cur_i;              /* Index in current result */
     int32_t ran_since_merge;    /* Index in current op */
     bool immediate;           /* Is pipeline in immediate mode */
+    bool concurrent;            /* Are systems in op distributed across stages */
+
+    /* Cached queries that are sorted before running the current operation */
+    ecs_vec_t sort_queries;     /* vec<ecs_query_cache_t*> */
+    int32_t sort_query;         /* Query for which tables are being sorted */
+    ecs_pipeline_sort_phase_t sorting; /* Sort phase run by workers */
 };
 
 typedef struct EcsPipeline {
@@ -58,10 +84,22 @@ int32_t flecs_run_pipeline_ops(
     int32_t stage_count,
     ecs_ftime_t delta_time);
 
+void flecs_run_pipeline_sort(
+    ecs_world_t *world,
+    int32_t stage_count);
+
 ////////////////////////////////////////////////////////////////////////////////
 //// Worker API
 ////////////////////////////////////////////////////////////////////////////////
 
+/* Number of times a worker or the main thread checks whether it can continue
+ * before blocking on a condition variable, when work stealing is enabled. */
+#define FLECS_WORKER_SPIN_COUNT (4096)
+
+/* Minimum number of tables or groups to sort before sorting queries of a 
+ * pipeline operation is distributed across workers. */
+#define FLECS_PARALLEL_SORT_MIN_JOBS (2)
+
 void flecs_workers_progress(
     ecs_world_t *world,
     ecs_pipeline_state_t *pq,
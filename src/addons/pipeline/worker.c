@@ -9,6 +9,47 @@
 #ifdef FLECS_PIPELINE
 #include "pipeline.h"
 
+/* Spin until value becomes equal (or not equal) to cmp. Returns false if the
+ * value didn't reach the expected state before the spin count ran out. */
+static
+bool flecs_worker_spin(
+    int32_t *value,
+    int32_t cmp,
+    bool equal)
+{
+    int32_t i;
+    for (i = 0; i < FLECS_WORKER_SPIN_COUNT; i ++) {
+        if ((*(volatile int32_t*)value == cmp) == equal) {
+            /* Synchronize with the thread that modified the value */
+            ecs_os_acas(value, 0, 0);
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Wait until main thread signals that workers can continue */
+static
+int32_t flecs_worker_wait(
+    ecs_world_t *world,
+    int32_t sync_gen)
+{
+    if (!(world->flags & EcsWorldWorkStealing) || 
+        !flecs_worker_spin(&world->workers_sync_gen, sync_gen, false)) 
+    {
+        ecs_os_mutex_lock(world->sync_mutex);
+        while (world->workers_sync_gen == sync_gen) {
+            world->workers_parked ++;
+            ecs_os_cond_wait(world->worker_cond, world->sync_mutex);
+            world->workers_parked --;
+        }
+        ecs_os_mutex_unlock(world->sync_mutex);
+    }
+
+    /* Main thread doesn't signal again before all workers are waiting */
+    return sync_gen + 1;
+}
+
 /* Synchronize workers */
 static
 void flecs_sync_worker(
@@ -19,16 +60,13 @@ void flecs_sync_worker(
         return;
     }
 
-    /* Signal that thread is waiting */
-    ecs_os_mutex_lock(world->sync_mutex);
-    if (++world->workers_waiting == (stage_count - 1)) {
-        /* Only signal main thread when all threads are waiting */
+    /* Signal that thread is waiting. Only signal main thread when all threads
+     * are waiting. */
+    if (ecs_os_ainc(&world->workers_waiting) == (stage_count - 1)) {
+        ecs_os_mutex_lock(world->sync_mutex);
         ecs_os_cond_signal(world->sync_cond);
+        ecs_os_mutex_unlock(world->sync_mutex);
     }
-
-    /* Wait until main thread signals that thread can continue */
-    ecs_os_cond_wait(world->worker_cond, world->sync_mutex);
-    ecs_os_mutex_unlock(world->sync_mutex);
 }
 
 /* Worker thread */
@@ -46,23 +84,27 @@ void* flecs_worker(void *arg) {
      * workers are ready */
     ecs_os_mutex_lock(world->sync_mutex);
     world->workers_running ++;
-
-    if (!(world->flags & EcsWorldQuitWorkers)) {
-        ecs_os_cond_wait(world->worker_cond, world->sync_mutex);
-    }
-
+    int32_t sync_gen = world->workers_sync_gen;
     ecs_os_mutex_unlock(world->sync_mutex);
 
+    sync_gen = flecs_worker_wait(world, sync_gen);
+
     while (!(world->flags & EcsWorldQuitWorkers)) {
         ecs_entity_t old_scope = ecs_set_scope((ecs_world_t*)stage, 0);
 
-        ecs_dbg_3("worker %d: run", stage->id);
-        flecs_run_pipeline_ops(world, stage, stage->id, world->stage_count, 
-            world->info.delta_time);
+        if (world->pq->sorting) {
+            ecs_dbg_3("worker %d: sort", stage->id);
+            flecs_run_pipeline_sort(world, world->stage_count);
+        } else {
+            ecs_dbg_3("worker %d: run", stage->id);
+            flecs_run_pipeline_ops(world, stage, stage->id, 
+                world->stage_count, world->info.delta_time);
+        }
 
         ecs_set_scope((ecs_world_t*)stage, old_scope);
 
         flecs_sync_worker(world);
+        sync_gen = flecs_worker_wait(world, sync_gen);
     }
 
     ecs_dbg_2("worker %d: finalizing", stage->id);
@@ -149,17 +191,19 @@ void flecs_wait_for_sync(
 
     ecs_dbg_3("#[bold]pipeline: waiting for worker sync");
 
-    ecs_os_mutex_lock(world->sync_mutex);
-    if (world->workers_waiting != (stage_count - 1)) {
-        ecs_os_cond_wait(world->sync_cond, world->sync_mutex);
+    int32_t worker_count = stage_count - 1;
+    if (!(world->flags & EcsWorldWorkStealing) || 
+        !flecs_worker_spin(&world->workers_waiting, worker_count, true))
+    {
+        ecs_os_mutex_lock(world->sync_mutex);
+        while (world->workers_waiting != worker_count) {
+            ecs_os_cond_wait(world->sync_cond, world->sync_mutex);
+        }
+        ecs_os_mutex_unlock(world->sync_mutex);
     }
 
-    /* We shouldn't have been signalled unless all workers are waiting on sync */
-    ecs_assert(world->workers_waiting == (stage_count - 1), 
-        ECS_INTERNAL_ERROR, NULL);
-
+    /* Workers don't touch the counter again until they are signalled */
     world->workers_waiting = 0;
-    ecs_os_mutex_unlock(world->sync_mutex);
 
     ecs_dbg_3("#[bold]pipeline: workers synced");
 }
@@ -174,8 +218,14 @@ void flecs_signal_workers(
     }
 
     ecs_dbg_3("#[bold]pipeline: signal workers");
+    ecs_os_ainc(&world->workers_sync_gen);
+
+    /* Workers that are still spinning will see the new generation, only wake
+     * up workers that are blocked on the condition variable. */
     ecs_os_mutex_lock(world->sync_mutex);
-    ecs_os_cond_broadcast(world->worker_cond);
+    if (world->workers_parked) {
+        ecs_os_cond_broadcast(world->worker_cond);
+    }
     ecs_os_mutex_unlock(world->sync_mutex);
 }
 
@@ -308,4 +358,24 @@ bool ecs_using_task_threads(
     return world->workers_use_task_api;
 }
 
+void ecs_set_work_stealing(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!enable || ecs_os_has_atomic_cas(), ECS_MISSING_OS_API, 
+        "work stealing requires atomic compare and swap");
+    ECS_BIT_COND(world->flags, EcsWorldWorkStealing, enable);
+error:
+    return;
+}
+
+void ecs_set_concurrent_systems(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ECS_BIT_COND(world->flags, EcsWorldConcurrentSystems, enable);
+}
+
 #endif
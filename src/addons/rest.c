@@ -1030,7 +1030,9 @@ void flecs_sync_stats_to_json(
     ecs_strbuf_appendbool(&reply->body, stats->immediate);
 
     ECS_GAUGE_APPEND_T(&reply->body, stats, time_spent, pstats->t, "");
+    ECS_GAUGE_APPEND_T(&reply->body, stats, wait_time, pstats->t, "");
     ECS_GAUGE_APPEND_T(&reply->body, stats, commands_enqueued, pstats->t, "");
+    ECS_GAUGE_APPEND_T(&reply->body, stats, tasks_stolen, pstats->t, "");
 
     ecs_strbuf_list_pop(&reply->body, "}");
 }
@@ -243,6 +243,7 @@ void ecs_component_record_memory_get(
     
     const ecs_map_t *map = &cache->index;
     result->bytes_table_cache += flecs_map_memory_get(map, 0);
+    result->bytes_table_cache += cache->table_ids.size / 8;
 
 #ifdef FLECS_DEBUG_INFO
     if (cr->str) {
@@ -327,6 +328,12 @@ void ecs_query_memory_get(
 
         result->cached_count++;
 
+        /* A cache that is shared by multiple queries is only counted for the
+         * query that owns it. */
+        if (cache->entity != query->entity) {
+            return;
+        }
+
         result->bytes_cache += ECS_SIZEOF(ecs_query_cache_t);
         result->bytes_cache += 
             flecs_map_memory_get(&cache->tables, 
@@ -579,6 +586,17 @@ void ecs_table_memory_get(
     if (table->dirty_state) {
         result->bytes_dirty_state += 
             (column_count + 1) * ECS_SIZEOF(int32_t);
+
+        const ecs_table_dirty_chunks_t *dcs = table->_->dirty_chunks;
+        if (dcs) {
+            result->bytes_dirty_state += 
+                column_count * ECS_SIZEOF(ecs_table_dirty_chunks_t);
+            int32_t i;
+            for (i = 0; i < column_count; i ++) {
+                result->bytes_dirty_state += 
+                    dcs[i].count * ECS_SIZEOF(int32_t);
+            }
+        }
     }
     
     flecs_table_graph_edges_memory_get(&table->node.add, result);
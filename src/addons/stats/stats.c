@@ -587,8 +587,10 @@ bool ecs_pipeline_stats_get(
                     ecs_sync_stats_t, i);
 
                 ECS_COUNTER_RECORD(&el->time_spent, s->t, cur->time_spent);
+                ECS_COUNTER_RECORD(&el->wait_time, s->t, cur->wait_time);
                 ECS_COUNTER_RECORD(&el->commands_enqueued, s->t, 
                     cur->commands_enqueued);
+                ECS_COUNTER_RECORD(&el->tasks_stolen, s->t, cur->tasks_stolen);
 
                 el->system_count = cur->count;
                 el->multi_threaded = cur->multi_threaded;
@@ -597,6 +599,9 @@ bool ecs_pipeline_stats_get(
         }
     }
 
+    ECS_COUNTER_RECORD(&s->frame_time, s->t, pq->frame_time);
+    ECS_COUNTER_RECORD(&s->sync_time, s->t, pq->sync_time);
+
     s->t = t_next(s->t);
 
     return true;
@@ -637,6 +642,9 @@ void ecs_pipeline_stats_reduce(
         dst_el->immediate = src_el->immediate;
     }
 
+    flecs_stats_reduce(ECS_METRIC_FIRST(dst), ECS_METRIC_LAST(dst),
+        ECS_METRIC_FIRST(src), dst->t, src->t);
+
     dst->t = t_next(dst->t);
 }
 
@@ -659,6 +667,9 @@ void ecs_pipeline_stats_reduce_last(
         dst_el->immediate = src_el->immediate;
     }
 
+    flecs_stats_reduce_last(ECS_METRIC_FIRST(dst), ECS_METRIC_LAST(dst),
+        ECS_METRIC_FIRST(src), dst->t, src->t, count);
+
     dst->t = t_prev(dst->t);
 }
 
@@ -674,6 +685,9 @@ void ecs_pipeline_stats_repeat_last(
             (stats->t));
     }
 
+    flecs_stats_repeat_last(ECS_METRIC_FIRST(stats), ECS_METRIC_LAST(stats),
+        (stats->t));
+
     stats->t = t_next(stats->t);
 }
 
@@ -696,6 +710,9 @@ void ecs_pipeline_stats_copy_last(
         dst_el->multi_threaded = src_el->multi_threaded;
         dst_el->immediate = src_el->immediate;
     }
+
+    flecs_stats_copy_last(ECS_METRIC_FIRST(dst), ECS_METRIC_LAST(dst),
+        ECS_METRIC_FIRST(src), dst->t, t_next(src->t));
 }
 
 #endif
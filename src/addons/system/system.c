@@ -17,6 +17,120 @@ ecs_mixins_t ecs_system_t_mixins = {
     }
 };
 
+/* Run system callbacks for an iterator */
+static
+void flecs_system_run_iter(
+    ecs_system_t *system_data,
+    ecs_iter_t *qit,
+    ecs_iter_t *it)
+{
+    ecs_iter_action_t action = system_data->action;
+    ecs_run_action_t run = system_data->run;
+    if (run) {
+        /* If system query matches nothing, the system run callback doesn't have
+         * anything to iterate, so the iterator resources don't get cleaned up
+         * automatically, so clean it up here. */
+        if (system_data->query->flags & EcsQueryMatchNothing) {
+            it->next = flecs_default_next_callback; /* Return once */
+            run(it);
+            ecs_iter_fini(qit);
+        } else {
+            if (it == qit && (qit->flags & EcsIterTrivialCached)) {
+                it->next = flecs_query_trivial_cached_next;
+            }
+            run(it);
+        }
+    } else {
+        if (system_data->query->term_count) {
+            if (it == qit) {
+                if (qit->flags & EcsIterTrivialCached) {
+                    while (flecs_query_trivial_cached_next(qit)) {
+                        action(qit);
+                    }
+                } else {
+                    while (ecs_query_next(qit)) {
+                        action(qit);
+                    }
+                }
+            } else {
+                while (ecs_iter_next(it)) {
+                    action(it);
+                }
+            }
+        } else {
+            action(qit);
+            ecs_iter_fini(qit);
+        }
+    }
+}
+
+/* Wait until all threads running a system have finished the current query 
+ * group. The last thread to arrive starts the next generation. If the OS API
+ * provides compare-and-swap, threads spin for a while before blocking on the
+ * condition variable of the system, so a thread that waits for a long time 
+ * (for example because another thread is preempted) doesn't keep a core busy.
+ * The mutex also synchronizes memory with the thread that started the next
+ * generation when there is no compare-and-swap. */
+static
+void flecs_system_level_barrier(
+    ecs_system_t *system_data,
+    int32_t stage_count)
+{
+    int32_t gen = system_data->level_gen;
+    if (ecs_os_ainc(&system_data->level_waiting) == stage_count) {
+        system_data->level_waiting = 0;
+        if (system_data->level_mutex) {
+            ecs_os_mutex_lock(system_data->level_mutex);
+            ecs_os_ainc(&system_data->level_gen);
+            ecs_os_cond_broadcast(system_data->level_cond);
+            ecs_os_mutex_unlock(system_data->level_mutex);
+        } else {
+            ecs_os_ainc(&system_data->level_gen);
+        }
+        return;
+    }
+
+    bool has_cas = ecs_os_has_atomic_cas();
+    if (has_cas) {
+        int32_t i;
+        for (i = 0; i < FLECS_SYSTEM_LEVEL_SPIN_COUNT; i ++) {
+            if (*(volatile int32_t*)&system_data->level_gen != gen) {
+                /* Synchronize with thread that started the next generation */
+                ecs_os_acas(&system_data->level_gen, 0, 0);
+                return;
+            }
+        }
+    }
+
+    if (system_data->level_mutex) {
+        ecs_os_mutex_lock(system_data->level_mutex);
+        while (system_data->level_gen == gen) {
+            ecs_os_cond_wait(system_data->level_cond, system_data->level_mutex);
+        }
+        ecs_os_mutex_unlock(system_data->level_mutex);
+    } else {
+        ecs_assert(has_cas, ECS_MISSING_OS_API, 
+            "parallel_levels requires threading or atomic compare-and-swap");
+        while (*(volatile int32_t*)&system_data->level_gen == gen) {
+            ecs_os_sleep(0, 0);
+        }
+        ecs_os_acas(&system_data->level_gen, 0, 0);
+    }
+}
+
+/* Create the synchronization primitives for the query group barrier. */
+static
+void flecs_system_init_levels(
+    ecs_system_t *system)
+{
+    if (system->parallel_levels && !system->level_mutex && 
+        ecs_os_has_threading()) 
+    {
+        system->level_mutex = ecs_os_mutex_new();
+        system->level_cond = ecs_os_cond_new();
+    }
+}
+
 /* -- Public API -- */
 
 ecs_entity_t flecs_run_system(
@@ -27,7 +141,8 @@ ecs_entity_t flecs_run_system(
     int32_t stage_index,
     int32_t stage_count,    
     ecs_ftime_t delta_time,
-    void *param) 
+    void *param,
+    ecs_worker_steal_t *steal) 
 {
     flecs_poly_assert(world, ecs_world_t);
     ecs_ftime_t time_elapsed = delta_time;
@@ -81,68 +196,72 @@ ecs_entity_t flecs_run_system(
 
     flecs_poly_assert(stage, ecs_stage_t);
 
-    /* Prepare the query iterator */
-    ecs_iter_t wit, qit = ecs_query_iter(thread_ctx, system_data->query);
-    ecs_iter_t *it = &qit;
-
-    qit.system = system;
-    qit.delta_time = delta_time;
-    qit.delta_system_time = time_elapsed;
-    qit.param = param;
-    qit.ctx = system_data->ctx;
-    qit.callback_ctx = system_data->callback_ctx;
-    qit.run_ctx = system_data->run_ctx;
-
-    if (system_data->group_id_set) {
-        ecs_iter_set_group(&qit, system_data->group_id);
-    }
-
-    if (stage_count > 1 && system_data->multi_threaded) {
-        wit = ecs_worker_iter(it, stage_index, stage_count);
-        it = &wit;
+    /* When the query groups of a multithreaded system are run one at a time,
+     * iterate each group on all threads before moving to the next group. */
+    ecs_query_cache_group_t *level = NULL;
+    if (stage_count > 1 && system_data->multi_threaded && 
+        system_data->parallel_levels && !system_data->group_id_set) 
+    {
+        ecs_query_cache_t *cache = flecs_query_impl(system_data->query)->cache;
+        if (cache && cache->group_by_callback && !cache->order_by_callback) {
+            level = cache->first_group;
+        }
     }
 
     ecs_entity_t old_system = flecs_stage_set_system(stage, system);
-    ecs_iter_action_t action = system_data->action;
-    it->callback = action;
-
-    ecs_run_action_t run = system_data->run;
-    if (run) {
-        /* If system query matches nothing, the system run callback doesn't have
-         * anything to iterate, so the iterator resources don't get cleaned up
-         * automatically, so clean it up here. */
-        if (system_data->query->flags & EcsQueryMatchNothing) {
-            it->next = flecs_default_next_callback; /* Return once */
-            run(it);
-            ecs_iter_fini(&qit);
+    ecs_entity_t interrupted_by;
+
+    do {
+        /* Prepare the query iterator */
+        ecs_iter_t wit, qit = ecs_query_iter(thread_ctx, system_data->query);
+        ecs_iter_t *it = &qit;
+
+        qit.system = system;
+        qit.delta_time = delta_time;
+        qit.delta_system_time = time_elapsed;
+        qit.param = param;
+        qit.ctx = system_data->ctx;
+        qit.callback_ctx = system_data->callback_ctx;
+        qit.run_ctx = system_data->run_ctx;
+
+        if (level) {
+            ecs_iter_set_group(&qit, level->info.id);
+            wit = ecs_worker_iter(it, stage_index, stage_count);
+            it = &wit;
         } else {
-            if (it == &qit && (qit.flags & EcsIterTrivialCached)) {
-                it->next = flecs_query_trivial_cached_next;
+            if (system_data->group_id_set) {
+                ecs_iter_set_group(&qit, system_data->group_id);
             }
-            run(it);
-        }
-    } else {
-        if (system_data->query->term_count) {
-            if (it == &qit) {
-                if (qit.flags & EcsIterTrivialCached) {
-                    while (flecs_query_trivial_cached_next(&qit)) {
-                        action(&qit);
-                    }
+
+            if (stage_count > 1 && system_data->multi_threaded) {
+                if (steal && system_data->chunk_size) {
+                    wit = ecs_worker_chunk_iter(it, stage_index, stage_count, 
+                        &steal->cursor, system_data->chunk_size);
+                } else if (steal && steal->deques) {
+                    wit = flecs_worker_steal_iter(
+                        it, stage_index, stage_count, steal);
                 } else {
-                    while (ecs_query_next(&qit)) {
-                        action(&qit);
-                    }
-                }
-            } else {
-                while (ecs_iter_next(it)) {
-                    action(it);
+                    wit = ecs_worker_iter(it, stage_index, stage_count);
                 }
+                it = &wit;
             }
-        } else {
-            action(&qit);
-            ecs_iter_fini(&qit);
         }
-    }
+
+        it->callback = system_data->action;
+
+        flecs_system_run_iter(system_data, &qit, it);
+
+        interrupted_by = it->interrupted_by;
+
+        if (!level || !(level = level->next)) {
+            break;
+        }
+
+        /* Don't start the next group before all threads finished this one.
+         * Every thread iterates the same list of groups, so all threads reach
+         * the barrier the same number of times. */
+        flecs_system_level_barrier(system_data, stage_count);
+    } while (true);
 
     flecs_stage_set_system(stage, old_system);
 
@@ -152,7 +271,7 @@ ecs_entity_t flecs_run_system(
 
     ecs_os_perf_trace_pop(system_data->name);
 
-    return it->interrupted_by;
+    return interrupted_by;
 }
 
 
@@ -172,7 +291,7 @@ ecs_entity_t ecs_run_worker(
     flecs_defer_begin(world, stage);
     ecs_entity_t result = flecs_run_system(
         world, stage, system, system_data, stage_index, stage_count, 
-        delta_time, param);
+        delta_time, param, NULL);
     flecs_defer_end(world, stage);
     return result;
 }
@@ -188,7 +307,7 @@ ecs_entity_t ecs_run(
     ecs_assert(system_data != NULL, ECS_INVALID_PARAMETER, NULL);
     flecs_defer_begin(world, stage);
     ecs_entity_t result = flecs_run_system(
-        world, stage, system, system_data, 0, 0, delta_time, param);
+        world, stage, system, system_data, 0, 0, delta_time, param, NULL);
     flecs_defer_end(world, stage);
     return result;
 }
@@ -208,6 +327,11 @@ void flecs_system_fini(ecs_system_t *sys) {
         sys->run_ctx_free(sys->run_ctx);
     }
 
+    if (sys->level_mutex) {
+        ecs_os_cond_free(sys->level_cond);
+        ecs_os_mutex_free(sys->level_mutex);
+    }
+
     /* Safe cast, type owns name */
     ecs_os_free(ECS_CONST_CAST(char*, sys->name));
 
@@ -325,7 +449,11 @@ ecs_entity_t ecs_system_init(
     system->tick_source = desc->tick_source;
 
     system->multi_threaded = desc->multi_threaded;
+    system->concurrent = desc->concurrent;
+    system->chunk_size = desc->chunk_size > 0 ? desc->chunk_size : 0;
+    system->parallel_levels = desc->parallel_levels > 0;
     system->immediate = desc->immediate;
+    flecs_system_init_levels(system);
 
     system->name = ecs_get_path(world, entity);
 
@@ -433,6 +561,20 @@ ecs_entity_t ecs_system_update(
 
     if (desc->multi_threaded) {
         system->multi_threaded = desc->multi_threaded;
+    system->concurrent = desc->concurrent;
+    }
+
+    if (desc->concurrent) {
+        system->concurrent = desc->concurrent;
+    }
+
+    if (desc->chunk_size) {
+        system->chunk_size = desc->chunk_size > 0 ? desc->chunk_size : 0;
+    }
+
+    if (desc->parallel_levels) {
+        system->parallel_levels = desc->parallel_levels > 0;
+        flecs_system_init_levels(system);
     }
 
     if (desc->immediate) {
@@ -15,6 +15,10 @@
 
 extern ecs_mixins_t ecs_system_t_mixins;
 
+/* Number of times a thread checks whether all threads finished a query group
+ * before yielding, for systems that run query groups one at a time. */
+#define FLECS_SYSTEM_LEVEL_SPIN_COUNT (1024)
+
 /* Internal function to run a system */
 ecs_entity_t flecs_run_system(
     ecs_world_t *world,
@@ -24,7 +28,8 @@ ecs_entity_t flecs_run_system(
     int32_t stage_current,
     int32_t stage_count,
     ecs_ftime_t delta_time,
-    void *param);
+    void *param,
+    ecs_worker_steal_t *steal);
 
 #endif
 
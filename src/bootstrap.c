@@ -747,27 +747,18 @@ ecs_table_t* flecs_bootstrap_component_table(
     
     {
         ecs_column_t *column = &result->data.columns[0];
-        ecs_vec_t v = ecs_vec_from_column_t(column, result, EcsComponent);
-        ecs_vec_init_t(NULL, &v, EcsComponent, EcsFirstUserComponentId);
-        ecs_assert(v.count == v_entities.count, ECS_INTERNAL_ERROR, NULL);
-        ecs_assert(v.size == v_entities.size, ECS_INTERNAL_ERROR, NULL);
-        column->data = v.array;
+        column->data = flecs_table_column_alloc(
+            ECS_SIZEOF(EcsComponent) * EcsFirstUserComponentId);
     }
     {
         ecs_column_t *column = &result->data.columns[1];
-        ecs_vec_t v = ecs_vec_from_column_t(column, result, EcsIdentifier);
-        ecs_vec_init_t(NULL, &v, EcsIdentifier, EcsFirstUserComponentId);
-        ecs_assert(v.count == v_entities.count, ECS_INTERNAL_ERROR, NULL);
-        ecs_assert(v.size == v_entities.size, ECS_INTERNAL_ERROR, NULL);
-        column->data = v.array;
+        column->data = flecs_table_column_alloc(
+            ECS_SIZEOF(EcsIdentifier) * EcsFirstUserComponentId);
     }
     {
         ecs_column_t *column = &result->data.columns[2];
-        ecs_vec_t v = ecs_vec_from_column_t(column, result, EcsIdentifier);
-        ecs_vec_init_t(NULL, &v, EcsIdentifier, EcsFirstUserComponentId);
-        ecs_assert(v.count == v_entities.count, ECS_INTERNAL_ERROR, NULL);
-        ecs_assert(v.size == v_entities.size, ECS_INTERNAL_ERROR, NULL);
-        column->data = v.array;
+        column->data = flecs_table_column_alloc(
+            ECS_SIZEOF(EcsIdentifier) * EcsFirstUserComponentId);
     }
 
     result->data.entities = v_entities.array;
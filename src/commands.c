@@ -223,12 +223,23 @@ bool flecs_defer_bulk_new(
     const ecs_entity_t **ids_out)
 {
     if (flecs_defer_cmd(stage)) {
-        ecs_entity_t *ids = ecs_os_malloc(count * ECS_SIZEOF(ecs_entity_t));
+        ecs_entity_t *ids = NULL;
 
-        /* Use ecs_new as this is thread safe */
-        int i;
-        for (i = 0; i < count; i ++) {
-            ids[i] = ecs_new(world);
+        /* Entities can't be created while in multithreaded mode. Prefab 
+         * instances are an exception, their ids are created when the command
+         * is merged (see ecs_bulk_instantiate()). */
+        if (!(world->flags & EcsWorldMultiThreaded)) {
+            ids = ecs_os_malloc(count * ECS_SIZEOF(ecs_entity_t));
+
+            /* Use ecs_new as this is thread safe */
+            int i;
+            for (i = 0; i < count; i ++) {
+                ids[i] = ecs_new(world);
+            }
+        } else {
+            ecs_assert(ECS_IS_PAIR(id) && ECS_PAIR_FIRST(id) == EcsIsA, 
+                ECS_INVALID_OPERATION, 
+                "cannot create entities in multithreaded mode");
         }
 
         *ids_out = ids;
@@ -715,9 +726,30 @@ void flecs_flush_bulk_new(
     ecs_cmd_t *cmd)
 {
     ecs_entity_t *entities = cmd->is._n.entities;
+    int32_t count = cmd->is._n.count;
+    ecs_id_t id = cmd->id;
+
+    /* Instantiate prefab hierarchy for all instances at once */
+    if (id && ECS_IS_PAIR(id) && ECS_PAIR_FIRST(id) == EcsIsA && count &&
+        !world->stages[0]->base) 
+    {
+        ecs_entity_t prefab = flecs_entities_get_alive(
+            world, ECS_PAIR_SECOND(id));
+        if (prefab && flecs_entities_is_alive(world, prefab)) {
+            flecs_bulk_instantiate(world, prefab, entities, count);
+            ecs_os_free(entities);
+            return;
+        }
+    }
+
+    if (!entities) {
+        /* Ids weren't created when the command was enqueued */
+        ecs_bulk_new_w_id(world, id, count);
+        return;
+    }
 
     if (cmd->id) {
-        int i, count = cmd->is._n.count;
+        int i;
         for (i = 0; i < count; i ++) {
             ecs_record_t *r = flecs_entities_ensure(world, entities[i]);
             if (!r->table) {
@@ -1109,6 +1141,230 @@ done:
     flecs_table_diff_builder_clear(diff);
 }
 
+/* Tables with these flags require per-entity bookkeeping when moving entities,
+ * so entities in them aren't moved as a block. */
+#define FLECS_CMD_COALESCE_EXCLUDE\
+    (EcsTableHasBuiltins | EcsTableIsPrefab | EcsTableHasIsA |\
+     EcsTableHasParent | EcsTableHasToggle | EcsTableHasSparse |\
+     EcsTableHasDontFragment | EcsTableHasOrderedChildren)
+
+/* Count ids that are in one type but not in the other. */
+static
+int32_t flecs_cmd_type_diff_count(
+    const ecs_type_t *type_1,
+    const ecs_type_t *type_2)
+{
+    int32_t i_1 = 0, count_1 = type_1->count;
+    int32_t i_2 = 0, count_2 = type_2->count;
+    int32_t result = 0;
+
+    for (; (i_1 < count_1) && (i_2 < count_2); ) {
+        ecs_id_t id_1 = type_1->array[i_1];
+        ecs_id_t id_2 = type_2->array[i_2];
+        result += id_1 != id_2;
+        i_1 += id_1 <= id_2;
+        i_2 += id_2 <= id_1;
+    }
+
+    return result + (count_1 - i_1) + (count_2 - i_2);
+}
+
+/* Find destination table for an entity of which all commands are add/remove
+ * commands. Returns NULL if one of the commands requires the entity to be moved
+ * on its own. */
+static
+ecs_table_t* flecs_cmd_coalesce_dst(
+    ecs_world_t *world,
+    ecs_table_diff_builder_t *diff,
+    ecs_table_t *table,
+    ecs_cmd_t *cmds,
+    int32_t start)
+{
+    int32_t cur = start, next_for_entity;
+
+    diff->added_flags = 0;
+    diff->removed_flags = 0;
+
+    do {
+        ecs_cmd_t *cmd = &cmds[cur];
+        ecs_id_t id = cmd->id;
+        next_for_entity = cmd->next_for_entity;
+        if (next_for_entity < 0) {
+            next_for_entity *= -1;
+        }
+
+        if (cmd->kind != EcsCmdAdd && cmd->kind != EcsCmdRemove) {
+            return NULL;
+        }
+
+        if (ECS_IS_PAIR(id) && (ECS_PAIR_FIRST(id) == EcsChildOf)) {
+            return NULL;
+        }
+
+        ecs_component_record_t *cr = flecs_components_get(world, id);
+        if (cr && (cr->flags & (EcsIdDontFragment|EcsIdSparse))) {
+            return NULL;
+        }
+
+        if (!flecs_remove_invalid(world, id, &id) || !id) {
+            return NULL;
+        }
+
+        if (cmd->kind == EcsCmdAdd) {
+            table = flecs_find_table_add(world, table, id, diff);
+        } else {
+            table = flecs_find_table_remove(world, table, id, diff);
+        }
+    } while ((cur = next_for_entity));
+
+    return table;
+}
+
+static
+void flecs_cmd_coalesce_skip(
+    ecs_world_t *world,
+    ecs_cmd_t *cmds,
+    int32_t start)
+{
+    int32_t cur = start, next_for_entity;
+
+    /* Clear sign of first command so entity won't be batched again */
+    if (cmds[cur].next_for_entity < 0) {
+        cmds[cur].next_for_entity *= -1;
+    }
+
+    do {
+        ecs_cmd_t *cmd = &cmds[cur];
+        next_for_entity = cmd->next_for_entity;
+        cmd->kind = EcsCmdSkip;
+        world->info.cmd.batched_command_count ++;
+    } while ((cur = next_for_entity));
+
+    world->info.cmd.batched_entity_count ++;
+}
+
+/* Find the destination table for an entity if it can be moved as part of a
+ * block. Returns NULL if the entity must be moved on its own. */
+static
+ecs_table_t* flecs_cmd_coalesce_entity(
+    ecs_world_t *world,
+    ecs_table_diff_builder_t *diff,
+    ecs_cmd_t *cmds,
+    int32_t cur,
+    ecs_table_t **src_out)
+{
+    ecs_entity_t e = cmds[cur].entity;
+    if (!flecs_entities_is_alive(world, e)) {
+        return NULL;
+    }
+
+    ecs_record_t *r = flecs_entities_get(world, e);
+    ecs_table_t *src = r->table;
+    if (!src || (src->flags & FLECS_CMD_COALESCE_EXCLUDE)) {
+        return NULL;
+    }
+
+    ecs_table_t *dst = flecs_cmd_coalesce_dst(world, diff, src, cmds, cur);
+
+    /* Only coalesce if the diff doesn't contain ids that were both added and
+     * removed, so all entities in a block have the same diff. */
+    if (!dst || (dst == src) || (dst->flags & FLECS_CMD_COALESCE_EXCLUDE) ||
+        (flecs_cmd_type_diff_count(&src->type, &dst->type) !=
+            (ecs_vec_count(&diff->added) + ecs_vec_count(&diff->removed))))
+    {
+        flecs_table_diff_builder_clear(diff);
+        return NULL;
+    }
+
+    *src_out = src;
+    return dst;
+}
+
+/* Move a contiguous run of entities with the same source and destination table
+ * as a single block. The run starts at the first command for an entity, and 
+ * ends at the first entity with a different table transition or at a command
+ * that isn't an add/remove command, so that the order in which entities are
+ * moved is the same as when commands are batched per entity. Returns the index
+ * at which the next run can start. */
+static
+int32_t flecs_cmd_coalesce(
+    ecs_world_t *world,
+    ecs_table_diff_builder_t *diff,
+    ecs_cmd_t *cmds,
+    int32_t start,
+    int32_t count)
+{
+    ecs_table_t *src = NULL;
+    ecs_table_t *dst = flecs_cmd_coalesce_entity(
+        world, diff, cmds, start, &src);
+    if (!dst) {
+        return start + 1;
+    }
+
+    /* All entities in the block have the same diff, keep the first */
+    ecs_table_diff_t table_diff;
+    flecs_table_diff_build_noalloc(diff, &table_diff);
+
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_t entities;
+    ecs_vec_init_t(a, &entities, ecs_entity_t, 0);
+    ecs_vec_append_t(a, &entities, ecs_entity_t)[0] = cmds[start].entity;
+
+    ecs_table_diff_builder_t next_diff;
+    flecs_table_diff_builder_init(world, &next_diff);
+
+    int32_t i;
+    for (i = start + 1; i < count; i ++) {
+        ecs_cmd_t *cmd = &cmds[i];
+        if (cmd->kind == EcsCmdSkip) {
+            continue;
+        }
+
+        if (cmd->kind != EcsCmdAdd && cmd->kind != EcsCmdRemove) {
+            break;
+        }
+
+        /* Only the first command for an entity has an entry */
+        if (!cmd->entry) {
+            continue;
+        }
+
+        ecs_table_t *next_src = NULL;
+        ecs_table_t *next_dst = flecs_cmd_coalesce_entity(
+            world, &next_diff, cmds, i, &next_src);
+        flecs_table_diff_builder_clear(&next_diff);
+        if (next_src != src || next_dst != dst) {
+            break;
+        }
+
+        ecs_vec_append_t(a, &entities, ecs_entity_t)[0] = cmd->entity;
+    }
+
+    flecs_table_diff_builder_fini(world, &next_diff);
+
+    int32_t entity_count = ecs_vec_count(&entities);
+    if (entity_count >= FLECS_CMD_COALESCE_MIN_ENTITIES) {
+        int32_t j;
+        for (j = start; j < i; j ++) {
+            if (cmds[j].entry && cmds[j].kind != EcsCmdSkip) {
+                flecs_cmd_coalesce_skip(world, cmds, j);
+            }
+        }
+
+        /* Same as when batching commands for a single entity, defer commands
+         * enqueued by hooks and observers while the block is moved. */
+        flecs_defer_begin(world, world->stages[0]);
+        flecs_commit_n(world, ecs_vec_first(&entities), entity_count, 
+            src, dst, &table_diff);
+        flecs_defer_end(world, world->stages[0]);
+    }
+
+    flecs_table_diff_builder_clear(diff);
+    ecs_vec_fini_t(a, &entities, ecs_entity_t);
+
+    return i;
+}
+
 /* Leave safe section. Run all deferred commands. */
 bool flecs_defer_end(
     ecs_world_t *world,
@@ -1165,10 +1421,25 @@ bool flecs_defer_end(
 
             ecs_table_diff_builder_t diff = {0};
             bool diff_builder_used = false;
+            int32_t coalesce_end = 0;
 
             for (i = 0; i < count; i ++) {
                 ecs_cmd_t *cmd = &cmds[i];
                 ecs_entity_t e = cmd->entity;
+
+                /* Move entities with the same table transition as a block */
+                if (merge_to_world && (i >= coalesce_end) && cmd->entry &&
+                    ((cmd->kind == EcsCmdAdd) || (cmd->kind == EcsCmdRemove))) 
+                {
+                    if (!diff_builder_used) {
+                        flecs_table_diff_builder_init(world, &diff);
+                        diff_builder_used = true;
+                    }
+
+                    coalesce_end = flecs_cmd_coalesce(
+                        world, &diff, cmds, i, count);
+                }
+
                 bool is_alive = flecs_entities_is_alive(world, e);
 
                 /* A negative index indicates the first command for an entity */
@@ -1429,7 +1700,11 @@ bool ecs_defer_end(
 {
     ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
     ecs_stage_t *stage = flecs_stage_from_world(&world);
-    return flecs_defer_end(world, stage);
+    bool result = flecs_defer_end(world, stage);
+    if (stage == world->stages[0]) {
+        flecs_observers_flush_batched(world);
+    }
+    return result;
 error:
     return false;
 }
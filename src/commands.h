@@ -6,6 +6,10 @@
 #ifndef FLECS_COMMANDS_H
 #define FLECS_COMMANDS_H
 
+/* Minimum number of entities with the same table transition for which entities
+ * are moved as a single block when merging commands. */
+#define FLECS_CMD_COALESCE_MIN_ENTITIES (2)
+
 /** Types for deferred operations */
 typedef enum ecs_cmd_kind_t {
     EcsCmdClone,
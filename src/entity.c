@@ -56,6 +56,26 @@ flecs_component_ptr_t flecs_get_component_ptr(
     return flecs_table_get_component(table, tr->column, row);
 }
 
+/* Components with an indexed member are marked dirty when a mutable pointer is
+ * returned, so that the member index can find values that were written without
+ * calling modified(). */
+static
+void flecs_mark_indexed_dirty(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t row,
+    const ecs_component_record_t *cr)
+{
+    if (!cr || !(cr->flags & EcsIdIndexed) || !table->dirty_state) {
+        return;
+    }
+
+    const ecs_table_record_t *tr = flecs_component_get_table(cr, table);
+    if (tr && (tr->column != -1)) {
+        flecs_table_mark_column_dirty(world, table, tr->column + 1, row, 1);
+    }
+}
+
 void* flecs_get_component(
     const ecs_world_t *world,
     ecs_table_t *table,
@@ -296,6 +316,58 @@ void flecs_commit(
     return;
 }
 
+void flecs_commit_n(
+    ecs_world_t *world,
+    const ecs_entity_t *entities,
+    int32_t count,
+    ecs_table_t *src_table,
+    ecs_table_t *dst_table,
+    ecs_table_diff_t *diff)
+{
+    ecs_assert(!(world->flags & EcsWorldReadonly), ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(src_table != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(dst_table != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(src_table != dst_table, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(count > 0, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_os_perf_trace_push("flecs.commit_n");
+
+    /* Swap entities to the end of the source table so that they form a single
+     * range that can be moved as a block. Entities that are already placed are 
+     * never swapped again, as each step only swaps into the next free slot. */
+    int32_t i, is_trav = 0, src_row = ecs_table_count(src_table) - count;
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t e = entities[i];
+        ecs_record_t *r = flecs_entities_get(world, e);
+        ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert(r->table == src_table, ECS_INTERNAL_ERROR, NULL);
+        flecs_journal(world, EcsJournalMove, e, &diff->added, &diff->removed);
+        is_trav += (r->row & EcsEntityIsTraversable) != 0;
+        ecs_table_swap_rows(world, src_table, 
+            ECS_RECORD_TO_ROW(r->row), src_row + i);
+    }
+
+    flecs_table_traversable_add(dst_table, is_trav);
+
+    /* Invoke remove actions for removed components */
+    flecs_actions_move_remove(world, src_table, dst_table, src_row, count, diff);
+
+    int32_t dst_row = flecs_table_move_tail(world, dst_table, src_table, count);
+
+    flecs_actions_move_add(world, dst_table, src_table, dst_row, count, diff,
+        0, true, 0);
+
+    flecs_table_traversable_add(src_table, -is_trav);
+
+    /* Same as flecs_commit, rematch queries that depend on components of
+     * traversable entities. */
+    if (is_trav) {
+        flecs_update_component_monitors(world, &diff->added, &diff->removed);
+    }
+
+    ecs_os_perf_trace_pop("flecs.commit_n");
+}
+
 const ecs_entity_t* flecs_bulk_new(
     ecs_world_t *world,
     ecs_table_t *table,
@@ -535,7 +607,12 @@ flecs_component_ptr_t flecs_ensure(
         if (column_index > 0) {
             ecs_column_t *column = &table->data.columns[column_index - 1];
             ecs_assert(column->ti->size == size, ECS_INTERNAL_ERROR, NULL);
-            dst.ptr = ECS_ELEM(column->data, size, ECS_RECORD_TO_ROW(r->row));
+            int32_t row = ECS_RECORD_TO_ROW(r->row);
+            if (world->non_trivial_lookup[component] & EcsNonTrivialIdIndexed) {
+                flecs_table_mark_column_dirty(
+                    world, table, column_index, row, 1);
+            }
+            dst.ptr = ECS_ELEM(column->data, size, row);
             dst.ti = column->ti;
             return dst;
         } else if (column_index < 0) {
@@ -556,6 +633,8 @@ flecs_component_ptr_t flecs_ensure(
             world, table, ECS_RECORD_TO_ROW(r->row), cr);
         if (dst.ptr) {
             ecs_assert(dst.ti->size == size, ECS_INTERNAL_ERROR, NULL);
+            flecs_mark_indexed_dirty(
+                world, table, ECS_RECORD_TO_ROW(r->row), cr);
             return dst;
         }
     }
@@ -573,6 +652,7 @@ flecs_component_ptr_t flecs_ensure(
     }
 
     ecs_assert(r->table != NULL, ECS_INTERNAL_ERROR, NULL);
+    flecs_mark_indexed_dirty(world, r->table, ECS_RECORD_TO_ROW(r->row), cr);
     return flecs_get_component_ptr(
         world, r->table, ECS_RECORD_TO_ROW(r->row), cr);
 }
@@ -616,6 +696,8 @@ flecs_component_ptr_t flecs_get_mut(
 
     ecs_component_record_t *cr = flecs_components_get(world, id);
     int32_t row = ECS_RECORD_TO_ROW(r->row);
+    flecs_mark_indexed_dirty(
+        ECS_CONST_CAST(ecs_world_t*, world), r->table, row, cr);
     return flecs_get_component_ptr(world, r->table, row, cr);
 error:
     return (flecs_component_ptr_t){0};
@@ -879,7 +961,8 @@ void flecs_copy_id(
 
     flecs_type_info_copy(dst_ptr, src_ptr, 1, ti);
 
-    flecs_table_mark_dirty(world, r->table, component);
+    flecs_table_mark_dirty(world, r->table, component, 
+        ECS_RECORD_TO_ROW(r->row));
 
     ecs_table_t *table = r->table;
     ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
@@ -1982,6 +2065,8 @@ void* ecs_get_mut_id(
 
     ecs_component_record_t *cr = flecs_components_get(world, component);
     int32_t row = ECS_RECORD_TO_ROW(r->row);
+    flecs_mark_indexed_dirty(
+        ECS_CONST_CAST(ecs_world_t*, world), r->table, row, cr);
     return flecs_get_component_ptr(world, r->table, row, cr).ptr;
 error:
     return NULL;
@@ -2208,6 +2293,8 @@ void* ecs_record_ensure_id(
 {
     const ecs_world_t *world = ecs_get_world(stage);
     ecs_component_record_t *cr = flecs_components_get(world, component);
+    flecs_mark_indexed_dirty(ECS_CONST_CAST(ecs_world_t*, world), 
+        r->table, ECS_RECORD_TO_ROW(r->row), cr);
     return flecs_get_component(
         world, r->table, ECS_RECORD_TO_ROW(r->row), cr);
 }
@@ -2241,7 +2328,7 @@ void flecs_modified_id_if(
 
     flecs_notify_on_set(world, table, row, component, invoke_hook);
 
-    flecs_table_mark_dirty(world, table, component);
+    flecs_table_mark_dirty(world, table, component, row);
     flecs_defer_end(world, stage);
 error:
     return;
@@ -2282,7 +2369,8 @@ void ecs_modified_id(
     flecs_notify_on_set(
         world, table, ECS_RECORD_TO_ROW(r->row), component, true);
 
-    flecs_table_mark_dirty(world, table, component);
+    flecs_table_mark_dirty(world, table, component, 
+        ECS_RECORD_TO_ROW(r->row));
     flecs_defer_end(world, stage);
 error:
     return;
@@ -2324,7 +2412,8 @@ void flecs_set_id_move(
         flecs_type_info_ctor_move_dtor(dst.ptr, ptr, 1, ti);
     }
 
-    flecs_table_mark_dirty(world, r->table, component);
+    flecs_table_mark_dirty(world, r->table, component, 
+        ECS_RECORD_TO_ROW(r->row));
 
     if (cmd_kind == EcsCmdSet) {
         ecs_table_t *table = r->table;
@@ -102,6 +102,16 @@ void flecs_commit(
     ecs_id_t emplace_id,
     ecs_flags32_t evt_flags);
 
+/* Commit entities that share the same source table to the same destination 
+ * table. Entities are moved as a single block. */
+void flecs_commit_n(
+    ecs_world_t *world,
+    const ecs_entity_t *entities,
+    int32_t count,
+    ecs_table_t *src_table,
+    ecs_table_t *dst_table,
+    ecs_table_diff_t *diff);
+
 /* Add multiple component ids to entity. */
 void flecs_add_ids(
     ecs_world_t *world,
@@ -548,3 +548,159 @@ void flecs_instantiate(
 error:
     return;
 }
+
+/* Instantiate prefab children for multiple instances of the same prefab. If 
+ * the prefab children can be created with a tree spawner, each spawner table is
+ * populated for all instances at once. */
+static
+void flecs_instantiate_n(
+    ecs_world_t *world,
+    ecs_entity_t base,
+    const ecs_entity_t *instances,
+    int32_t count)
+{
+    ecs_record_t *record = flecs_entities_get_any(world, base);
+    ecs_table_t *base_table = record->table;
+    ecs_assert(base_table != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_component_record_t *cr = NULL;
+    if (base_table->flags & EcsTableIsPrefab) {
+        cr = flecs_components_get(world, ecs_childof(base));
+    }
+
+    if (!cr || !(cr->flags & EcsIdOrderedChildren) || 
+        !flecs_component_has_non_fragmenting_childof(cr)) 
+    {
+        /* Children aren't created with a tree spawner, instantiate each 
+         * instance separately. */
+        int32_t i;
+        for (i = 0; i < count; i ++) {
+            flecs_instantiate(world, base, instances[i], NULL, 0);
+        }
+        return;
+    }
+
+    if (base_table->flags & EcsTableOverrideDontFragment) {
+        int32_t i;
+        for (i = 0; i < count; i ++) {
+            flecs_instantiate_override_dont_fragment(
+                world, base_table, instances[i]);
+        }
+    }
+
+    if (record->row & EcsEntityHasDontFragment) {
+        int32_t i;
+        for (i = 0; i < count; i ++) {
+            flecs_instantiate_dont_fragment(world, base, instances[i]);
+        }
+    }
+
+    EcsTreeSpawner *ts = flecs_get_mut(
+        world, base, ecs_id(EcsTreeSpawner), record, 
+        sizeof(EcsTreeSpawner)).ptr;
+    if (!ts) {
+        ts = flecs_prefab_spawner_build(world, base);
+    }
+
+    if (ts) {
+        flecs_spawner_instantiate_n(world, ts, base, instances, count);
+    }
+}
+
+const ecs_entity_t* flecs_bulk_instantiate(
+    ecs_world_t *world,
+    ecs_entity_t prefab,
+    const ecs_entity_t *entities,
+    int32_t count)
+{
+    ecs_assert(!world->stages[0]->base, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(count > 0, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_os_perf_trace_push("flecs.bulk_instantiate");
+
+    /* Setting the base prevents IsA OnAdd events from instantiating the prefab
+     * for each instance. */
+    world->stages[0]->base = prefab;
+
+    ecs_id_t isa = ecs_isa(prefab);
+    ecs_entity_t *instances = flecs_walloc_n(world, ecs_entity_t, count);
+    const ecs_entity_t *result = NULL;
+
+    if (entities) {
+        /* Entities were created before the prefab is instantiated, for example
+         * by a deferred bulk command. Move them to the instance table one by
+         * one, and instantiate the prefab for all of them at once. */
+        int32_t i;
+        for (i = 0; i < count; i ++) {
+            ecs_record_t *r = flecs_entities_ensure(world, entities[i]);
+            if (!r->table) {
+                flecs_add_to_root_table(world, entities[i]);
+            }
+            flecs_add_id(world, entities[i], isa);
+        }
+
+        ecs_os_memcpy_n(instances, entities, ecs_entity_t, count);
+        result = entities;
+    }
+
+    /* Defer operations from observers until all instances have been created, 
+     * so that instances don't get moved to other tables. */
+    flecs_defer_begin(world, world->stages[0]);
+
+    if (!entities) {
+        ecs_table_diff_builder_t diff = ECS_TABLE_DIFF_INIT;
+        flecs_table_diff_builder_init(world, &diff);
+        ecs_table_t *table = flecs_find_table_add(
+            world, &world->store.root, isa, &diff);
+        ecs_table_diff_t td;
+        flecs_table_diff_build_noalloc(&diff, &td);
+
+        int32_t row;
+        const ecs_entity_t *ids = flecs_bulk_new(
+            world, table, NULL, NULL, count, NULL, false, &row, &td);
+        flecs_table_diff_builder_fini(world, &diff);
+
+        /* Creating children can reallocate the entity index, copy ids. */
+        ecs_os_memcpy_n(instances, ids, ecs_entity_t, count);
+        result = &ecs_table_entities(table)[row];
+    }
+
+    flecs_instantiate_n(world, prefab, instances, count);
+
+    flecs_wfree_n(world, ecs_entity_t, count, instances);
+
+    world->stages[0]->base = 0;
+
+    flecs_defer_end(world, world->stages[0]);
+
+    ecs_os_perf_trace_pop("flecs.bulk_instantiate");
+
+    return result;
+}
+
+const ecs_entity_t* ecs_bulk_instantiate(
+    ecs_world_t *world,
+    ecs_entity_t prefab,
+    int32_t count)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(prefab != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(count >= 0, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_world_t *world_arg = world;
+    ecs_stage_t *stage = flecs_stage_from_world(&world);
+    ecs_check(ecs_is_alive(world, prefab), ECS_INVALID_PARAMETER, 
+        "cannot instantiate prefab that is not alive");
+
+    if (stage->defer > 0 || world->stages[0]->base || !count) {
+        /* When deferred, instances are created by a bulk command which is 
+         * instantiated for all instances when merged. When called while 
+         * another prefab is instantiated (for example from an OnAdd observer),
+         * instances aren't instantiated recursively. */
+        return ecs_bulk_new_w_id(world_arg, ecs_isa(prefab), count);
+    }
+
+    return flecs_bulk_instantiate(world, prefab, NULL, count);
+error:
+    return NULL;
+}
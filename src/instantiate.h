@@ -32,6 +32,14 @@ void flecs_instantiate_sparse(
     int32_t row_offset,
     bool emit_non_sparse);
 
+/* Create instances of prefab and instantiate the prefab for all of them at
+ * once. If entities is NULL, new entities are created. */
+const ecs_entity_t* flecs_bulk_instantiate(
+    ecs_world_t *world,
+    ecs_entity_t prefab,
+    const ecs_entity_t *entities,
+    int32_t count);
+
 ecs_entity_t flecs_instantiate_alloc_child_id(
     ecs_world_t *world,
     ecs_entity_t prefab_child,
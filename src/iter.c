@@ -1016,3 +1016,345 @@ bool ecs_worker_next(
 error:
     return false;
 }
+
+#define flecs_worker_deque(result, front, back)\
+    ((int64_t)(((uint64_t)(uint32_t)(result) << 32) |\
+        ((uint64_t)(uint16_t)(front) << 16) | (uint64_t)(uint16_t)(back)))
+
+#define flecs_worker_deque_result(deque)\
+    ((int32_t)(uint32_t)((uint64_t)(deque) >> 32))
+
+#define flecs_worker_deque_front(deque)\
+    ((int32_t)(((uint64_t)(deque) >> 16) & 0xFFFF))
+
+#define flecs_worker_deque_back(deque)\
+    ((int32_t)((uint64_t)(deque) & 0xFFFF))
+
+void flecs_worker_steal_reset(
+    ecs_worker_steal_t *steal)
+{
+    int32_t s, w, count = steal->stage_count;
+    if (steal->deques) {
+        for (s = 0; s < FLECS_WORKER_STEAL_RING; s ++) {
+            for (w = 0; w < count; w ++) {
+                /* Initialize each deque as if it was used for the result that 
+                 * precedes the first result in the ring, and has been 
+                 * emptied. */
+                steal->deques[s * count + w] = flecs_worker_deque(
+                    s - FLECS_WORKER_STEAL_RING, 0, 0);
+            }
+        }
+    }
+    steal->stolen = 0;
+    steal->cursor = 0;
+}
+
+static
+bool flecs_worker_steal_next(
+    ecs_iter_t *it);
+
+ecs_iter_t flecs_worker_steal_iter(
+    const ecs_iter_t *it,
+    int32_t index,
+    int32_t count,
+    ecs_worker_steal_t *steal)
+{
+    ecs_assert(steal != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(steal->stage_count == count, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_iter_t result = ecs_worker_iter(it, index, count);
+    ecs_worker_iter_t *iter = &result.priv_.iter.worker;
+    iter->steal = steal;
+    iter->result = -1;
+    iter->task_count = 0;
+    iter->victim = index;
+    result.next = flecs_worker_steal_next;
+    return result;
+}
+
+static
+int32_t flecs_worker_task_count(
+    int32_t row_count,
+    int32_t stage_count)
+{
+    int32_t result = (row_count + FLECS_WORKER_STEAL_MIN_ROWS - 1) / 
+        FLECS_WORKER_STEAL_MIN_ROWS;
+    int32_t max = stage_count * FLECS_WORKER_STEAL_TASKS;
+    return result > max ? max : result;
+}
+
+/* Claim task from the front of the deque of the current stage. */
+static
+int32_t flecs_worker_task_pop(
+    int64_t *deque,
+    int32_t result,
+    int32_t begin,
+    int32_t end)
+{
+    do {
+        int64_t cur = ecs_os_lacas(deque, 0, 0); /* atomic load */
+        int32_t cur_result = flecs_worker_deque_result(cur);
+        int32_t front = flecs_worker_deque_front(cur);
+        int32_t back = flecs_worker_deque_back(cur);
+
+        if (cur_result == (result - FLECS_WORKER_STEAL_RING)) {
+            /* First time this stage gets to the result and no other stage has
+             * initialized the deque yet. */
+            ecs_assert(front >= back, ECS_INTERNAL_ERROR, NULL);
+            ecs_os_lacas(deque, cur, 
+                flecs_worker_deque(result, begin, end));
+            continue;
+        }
+
+        if (cur_result != result) {
+            /* Other stages emptied the deque and reused it for a next result */
+            ecs_assert(cur_result > result, ECS_INTERNAL_ERROR, NULL);
+            return -1;
+        }
+
+        if (front >= back) {
+            return -1;
+        }
+
+        if (ecs_os_lacas(deque, cur, 
+            flecs_worker_deque(result, front + 1, back)) == cur) 
+        {
+            return front;
+        }
+    } while (true);
+}
+
+/* Claim task from the back of the deque of another stage. */
+static
+int32_t flecs_worker_task_steal(
+    int64_t *deque,
+    int32_t result,
+    int32_t begin,
+    int32_t end)
+{
+    do {
+        /* Values are validated by the compare and swap, so a torn read at
+         * worst causes a retry or a missed steal. */
+        int64_t cur = *(volatile int64_t*)deque;
+        int32_t cur_result = flecs_worker_deque_result(cur);
+        int32_t front = flecs_worker_deque_front(cur);
+        int32_t back = flecs_worker_deque_back(cur);
+
+        if (cur_result == (result - FLECS_WORKER_STEAL_RING)) {
+            if (front < back) {
+                /* Stage is still working on an earlier result */
+                return -1;
+            }
+
+            /* Stage hasn't gotten to this result yet, initialize its deque */
+            ecs_os_lacas(deque, cur, flecs_worker_deque(result, begin, end));
+            continue;
+        }
+
+        if (cur_result != result || front >= back) {
+            return -1;
+        }
+
+        if (ecs_os_lacas(deque, cur, 
+            flecs_worker_deque(result, front, back - 1)) == cur) 
+        {
+            return back - 1;
+        }
+    } while (true);
+}
+
+/* Advance deque of the current stage to a result without tasks, so that the
+ * deque has the expected result index when the ring wraps around. */
+static
+void flecs_worker_task_skip(
+    int64_t *deque,
+    int32_t result)
+{
+    int64_t cur;
+    do {
+        cur = ecs_os_lacas(deque, 0, 0); /* atomic load */
+        if (flecs_worker_deque_result(cur) != 
+            (result - FLECS_WORKER_STEAL_RING)) 
+        {
+            /* Already initialized by another stage */
+            ecs_assert(flecs_worker_deque_result(cur) >= result, 
+                ECS_INTERNAL_ERROR, NULL);
+            return;
+        }
+    } while (ecs_os_lacas(deque, cur, flecs_worker_deque(result, 0, 0)) != cur);
+}
+
+static
+bool flecs_worker_steal_next(
+    ecs_iter_t *it)
+{
+    ecs_iter_t *chain_it = it->chain_it;
+    ecs_worker_iter_t *iter = &it->priv_.iter.worker;
+    ecs_worker_steal_t *steal = iter->steal;
+    int32_t res_count = iter->count, res_index = iter->index;
+
+    do {
+        if (iter->task_count) {
+            int32_t task_count = iter->task_count;
+            int32_t result = iter->result;
+            int64_t *deques = &steal->deques[
+                (result % FLECS_WORKER_STEAL_RING) * res_count];
+            int32_t task = -1;
+
+            if (iter->victim == res_index) {
+                task = flecs_worker_task_pop(&deques[res_index], result,
+                    (task_count * res_index) / res_count,
+                    (task_count * (res_index + 1)) / res_count);
+                if (task == -1) {
+                    iter->victim = (res_index + 1) % res_count;
+                }
+            }
+
+            while (task == -1 && iter->victim != res_index) {
+                int32_t victim = iter->victim;
+                task = flecs_worker_task_steal(&deques[victim], result,
+                    (task_count * victim) / res_count,
+                    (task_count * (victim + 1)) / res_count);
+                if (task == -1) {
+                    iter->victim = (victim + 1) % res_count;
+                } else {
+                    ecs_os_ainc(&steal->stolen);
+                }
+            }
+
+            if (task != -1) {
+                /* Copy everything up to the private iterator data */
+                ecs_os_memcpy(it, chain_it, offsetof(ecs_iter_t, priv_));
+
+                int32_t row_count = it->count;
+                int32_t first = (int32_t)(
+                    ((int64_t)row_count * task) / task_count);
+                int32_t last = (int32_t)(
+                    ((int64_t)row_count * (task + 1)) / task_count);
+
+                it->frame_offset += first;
+                it->count = last - first;
+                it->offset += first;
+                it->entities = &(ecs_table_entities(it->table)[it->offset]);
+                return true;
+            }
+
+            iter->task_count = 0;
+        }
+
+        if (!ecs_iter_next(chain_it)) {
+            return false;
+        }
+
+        iter->result ++;
+        iter->victim = res_index;
+
+        if (chain_it->table == NULL) {
+            flecs_worker_task_skip(&steal->deques[
+                (iter->result % FLECS_WORKER_STEAL_RING) * res_count + 
+                    res_index], iter->result);
+            if (res_index == 0) {
+                ecs_os_memcpy(it, chain_it, offsetof(ecs_iter_t, priv_));
+                return true;
+            } else {
+                ecs_iter_fini(chain_it);
+                return false;
+            }
+        }
+
+        iter->task_count = flecs_worker_task_count(chain_it->count, res_count);
+        if (!iter->task_count) {
+            flecs_worker_task_skip(&steal->deques[
+                (iter->result % FLECS_WORKER_STEAL_RING) * res_count + 
+                    res_index], iter->result);
+        }
+    } while (true);
+}
+
+ecs_iter_t ecs_worker_chunk_iter(
+    const ecs_iter_t *it,
+    int32_t index,
+    int32_t count,
+    int32_t *cursor,
+    int32_t chunk_size)
+{
+    ecs_check(cursor != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(chunk_size > 0, ECS_INVALID_PARAMETER, 
+        "invalid chunk size %d", chunk_size);
+
+    ecs_iter_t result = ecs_worker_iter(it, index, count);
+    ecs_worker_iter_t *iter = &result.priv_.iter.worker;
+    iter->cursor = cursor;
+    iter->chunk_size = chunk_size;
+    iter->result = -1;
+    result.next = ecs_worker_chunk_next;
+    return result;
+error:
+    return (ecs_iter_t){ 0 };
+}
+
+bool ecs_worker_chunk_next(
+    ecs_iter_t *it)
+{
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(it->chain_it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(it->next == ecs_worker_chunk_next, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_iter_t *chain_it = it->chain_it;
+    ecs_worker_iter_t *iter = &it->priv_.iter.worker;
+
+    /* Rows are numbered across all results of the chained iterator. Chunks
+     * are claimed in increasing order, so a stage only has to move forward
+     * through the results to find the rows of its next chunk. */
+    if (iter->row == iter->row_end) {
+        int32_t chunk = ecs_os_ainc(iter->cursor) - 1;
+        iter->row = chunk * iter->chunk_size;
+        iter->row_end = iter->row + iter->chunk_size;
+    }
+
+    while ((iter->result == -1) || (chain_it->table == NULL) || 
+        (iter->row >= (iter->base + chain_it->count))) 
+    {
+        if (iter->result != -1 && chain_it->table != NULL) {
+            iter->base += chain_it->count;
+        }
+
+        if (!ecs_iter_next(chain_it)) {
+            return false;
+        }
+
+        iter->result ++;
+
+        if (chain_it->table == NULL) {
+            /* Results without a table can't be split, so only return them on
+             * the first stage. */
+            if (iter->index == 0) {
+                ecs_os_memcpy(it, chain_it, offsetof(ecs_iter_t, priv_));
+                return true;
+            } else {
+                ecs_iter_fini(chain_it);
+                return false;
+            }
+        }
+    }
+
+    /* Copy everything up to the private iterator data */
+    ecs_os_memcpy(it, chain_it, offsetof(ecs_iter_t, priv_));
+
+    int32_t first = iter->row - iter->base;
+    int32_t last = iter->row_end - iter->base;
+    if (last > it->count) {
+        last = it->count;
+    }
+
+    it->frame_offset += first;
+    it->count = last - first;
+    it->offset += first;
+    it->entities = &(ecs_table_entities(it->table)[it->offset]);
+
+    iter->row = iter->base + last;
+
+    return true;
+error:
+    return false;
+}
@@ -41,4 +41,36 @@ void* flecs_iter_calloc(
 #define flecs_iter_free_n(ptr, T, count)\
     flecs_iter_free(ptr, ECS_SIZEOF(T) * count)
 
+/* Number of consecutive results for which work stealing deques are kept. A
+ * stage doesn't steal from stages that are further behind than this. */
+#define FLECS_WORKER_STEAL_RING (16)
+
+/* Minimum number of rows in a work stealing task. */
+#define FLECS_WORKER_STEAL_MIN_ROWS (64)
+
+/* Maximum number of tasks per stage per result. */
+#define FLECS_WORKER_STEAL_TASKS (8)
+
+/* Shared state for stages that iterate the same query with work stealing. Each
+ * stage has a deque per result that is packed in a single 64bit word, which 
+ * stores the result index (upper 32 bits) and front and back task indices. */
+typedef struct ecs_worker_steal_t {
+    int64_t *deques;             /* [FLECS_WORKER_STEAL_RING][stage_count] */
+    int32_t stage_count;
+    int32_t stolen;              /* Number of tasks claimed from other stages */
+    int32_t cursor;              /* Shared cursor for ecs_worker_chunk_iter() */
+} ecs_worker_steal_t;
+
+/* Reset work stealing state. Must be called before stages start iterating. */
+void flecs_worker_steal_reset(
+    ecs_worker_steal_t *steal);
+
+/* Same as ecs_worker_iter(), but stages that run out of rows claim tasks 
+ * (row ranges) from stages that haven't finished the current result yet. */
+ecs_iter_t flecs_worker_steal_iter(
+    const ecs_iter_t *it,
+    int32_t index,
+    int32_t count,
+    ecs_worker_steal_t *steal);
+
 #endif
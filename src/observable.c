@@ -15,9 +15,11 @@ void flecs_observable_init(
 {
     flecs_sparse_init_t(&observable->events, NULL, NULL, ecs_event_record_t);
     ecs_vec_init_t(NULL, &observable->global_observers, ecs_observer_t*, 0);
+    ecs_vec_init_t(NULL, &observable->batched_observers, ecs_observer_t*, 0);
     observable->on_add.event = EcsOnAdd;
     observable->on_remove.event = EcsOnRemove;
     observable->on_set.event = EcsOnSet;
+    observable->dispatch_generation = 1;
 }
 
 void flecs_observable_fini(
@@ -50,6 +52,7 @@ void flecs_observable_fini(
     }
 
     ecs_vec_fini_t(NULL, &observable->global_observers, ecs_observer_t*);
+    ecs_vec_fini_t(NULL, &observable->batched_observers, ecs_observer_t*);
     flecs_sparse_fini(&observable->events);
 }
 
@@ -239,6 +242,115 @@ int32_t flecs_event_observers_get(
     return count;
 }
 
+static
+ecs_flags32_t flecs_event_record_dispatch_flag(
+    const ecs_observable_t *o,
+    const ecs_event_record_t *er)
+{
+    if      (er == &o->on_add)      return EcsDispatchOnAdd;
+    else if (er == &o->on_remove)   return EcsDispatchOnRemove;
+    else if (er == &o->on_set)      return EcsDispatchOnSet;
+    else if (er == &o->on_wildcard) return EcsDispatchOnWildcard;
+    return 0;
+}
+
+static
+ecs_flags32_t flecs_event_observers_dispatch(
+    const ecs_event_record_t *er,
+    ecs_id_t id,
+    ecs_flags32_t flag,
+    ecs_event_id_record_t **iders)
+{
+    int32_t i, count = flecs_event_observers_get(er, id, iders);
+    if (!count) {
+        return 0;
+    }
+
+    for (i = 0; i < count; i ++) {
+        ecs_event_id_record_t *ider = iders[i];
+        if (ecs_map_count(&ider->up) || ecs_map_count(&ider->self_up)) {
+            return flag | (flag << EcsDispatchUpShift);
+        }
+    }
+
+    return flag;
+}
+
+static
+void flecs_component_dispatch_update(
+    const ecs_world_t *world,
+    ecs_component_record_t *cr,
+    ecs_event_id_record_t **iders)
+{
+    const ecs_observable_t *o = &world->observable;
+    if (cr->dispatch_generation == o->dispatch_generation) {
+        return;
+    }
+
+    ecs_id_t id = cr->id;
+    cr->dispatch = 
+        flecs_event_observers_dispatch(
+            &o->on_add, id, EcsDispatchOnAdd, iders) |
+        flecs_event_observers_dispatch(
+            &o->on_remove, id, EcsDispatchOnRemove, iders) |
+        flecs_event_observers_dispatch(
+            &o->on_set, id, EcsDispatchOnSet, iders) |
+        flecs_event_observers_dispatch(
+            &o->on_wildcard, id, EcsDispatchOnWildcard, iders);
+    cr->dispatch_generation = o->dispatch_generation;
+}
+
+/* Get observers for component record. For builtin events, whether any 
+ * observers exist for the component is cached on the component record, which
+ * means that events for components without observers don't require map 
+ * lookups for the id and its wildcard variants. */
+static
+int32_t flecs_component_observers_get(
+    const ecs_world_t *world,
+    const ecs_event_record_t *er,
+    ecs_component_record_t *cr,
+    ecs_event_id_record_t **iders)
+{
+    if (!er) {
+        return 0;
+    }
+
+    const ecs_observable_t *o = &world->observable;
+    ecs_flags32_t flag = flecs_event_record_dispatch_flag(o, er);
+    if (!flag) {
+        return flecs_event_observers_get(er, cr->id, iders);
+    }
+
+    flecs_component_dispatch_update(world, cr, iders);
+
+    if (!(cr->dispatch & flag)) {
+        return 0;
+    }
+
+    return flecs_event_observers_get(er, cr->id, iders);
+}
+
+/* Test whether events for a component record can be observed by observers 
+ * that traverse relationships. When this returns false, events don't have to
+ * be propagated to the entities that (transitively) inherit the component. */
+static
+bool flecs_component_observers_up(
+    const ecs_world_t *world,
+    const ecs_event_record_t *er,
+    ecs_component_record_t *cr)
+{
+    const ecs_observable_t *o = &world->observable;
+    ecs_flags32_t flag = flecs_event_record_dispatch_flag(o, er);
+    if (!flag) {
+        return true;
+    }
+
+    ecs_event_id_record_t *iders[5];
+    flecs_component_dispatch_update(world, cr, iders);
+
+    return (cr->dispatch & (flag << EcsDispatchUpShift)) != 0;
+}
+
 bool flecs_observers_exist(
     const ecs_observable_t *observable,
     ecs_id_t id,
@@ -338,18 +450,39 @@ void flecs_emit_propagate_id(
             int32_t i, count = ecs_vec_count(&cur->pair->ordered_children);
             ecs_entity_t *children = ecs_vec_first(&cur->pair->ordered_children);
             int32_t event_cur = it->event_cur;
+
+            /* Children are often stored in the same table in the same order as
+             * the ordered children list. Combine children that are stored in
+             * adjacent rows of the same table, so that observers are invoked
+             * once per range instead of once per child. */
+            ecs_table_range_t range = {0};
             for (i = 0; i < count; i ++) {
                 ecs_record_t *r = flecs_entities_get(world, children[i]);
                 ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+                int32_t row = ECS_RECORD_TO_ROW(r->row);
+
+                if (range.count && (r->table == range.table) &&
+                    (row == (range.offset + range.count)))
+                {
+                    range.count ++;
+                    continue;
+                }
+
+                if (range.count) {
+                    flecs_emit_propagate_id_for_range(
+                        world, it, cr, trav, iders, ider_count, &range);
+                }
 
+                range.table = r->table;
+                range.offset = row;
+                range.count = 1;
+            }
+
+            if (range.count) {
                 flecs_emit_propagate_id_for_range(
-                    world, it, cr, trav, iders, ider_count,
-                        &(ecs_table_range_t){
-                            .table = r->table,
-                            .offset = ECS_RECORD_TO_ROW(r->row),
-                            .count = 1
-                        });
+                    world, it, cr, trav, iders, ider_count, &range);
             }
+
             it->event_cur = event_cur;
         }
 
@@ -578,12 +711,10 @@ void flecs_emit_forward_id(
     ecs_event_id_record_t *iders_onset[5];
 
     /* Skip id if there are no observers for it */
-    int32_t ider_i, ider_count = flecs_event_observers_get(er, id, iders);
-    int32_t ider_onset_i, ider_onset_count = 0;
-    if (er_onset) {
-        ider_onset_count = flecs_event_observers_get(
-            er_onset, id, iders_onset);
-    }
+    int32_t ider_i, ider_count = flecs_component_observers_get(
+        world, er, cr, iders);
+    int32_t ider_onset_i, ider_onset_count = flecs_component_observers_get(
+        world, er_onset, cr, iders_onset);
 
     if (!may_override && (!ider_count && !ider_onset_count)) {
         return;
@@ -1088,8 +1219,13 @@ void flecs_emit_forward(
                 }
 
                 ecs_event_id_record_t *iders[5] = {0};
-                int32_t ider_count = flecs_event_observers_get(
-                    er, rc_cr->id, iders);
+                int32_t ider_count = flecs_component_observers_get(
+                    world, er, rc_cr, iders);
+                if (!ider_count || !flecs_component_observers_up(
+                    world, er, rc_cr)) 
+                {
+                    continue;
+                }
 
                 it->ids[0] = rc_cr->id;
                 it->event_id = rc_cr->id;
@@ -1143,7 +1279,7 @@ void flecs_emit_on_set_for_override_on_add(
 
     ecs_event_id_record_t *iders_set[5] = {0};
     int32_t ider_set_i, ider_set_count = 
-        flecs_event_observers_get(er_onset, id, iders_set);
+        flecs_component_observers_get(world, er_onset, cr, iders_set);
     if (!ider_set_count) {
         /* No OnSet observers for component */
         return;
@@ -1190,7 +1326,7 @@ void flecs_emit_on_set_for_override_on_remove(
 
     ecs_event_id_record_t *iders_set[5] = {0};
     int32_t ider_set_i, ider_set_count = 
-        flecs_event_observers_get(er_onset, id, iders_set);
+        flecs_component_observers_get(world, er_onset, cr, iders_set);
     if (!ider_set_count) {
         /* No OnSet observers for component */
         return;
@@ -1466,7 +1602,7 @@ repeat_event:
              * observers, in case an observer matches for wildcard ids. For
              * example, both observers for (ChildOf, p) and (ChildOf, *) would
              * match an event for (ChildOf, p). */
-            ider_count = flecs_event_observers_get(er, id, iders);
+            ider_count = flecs_component_observers_get(world, er, cr, iders);
         }
 
         if (!ider_count && !(can_override_on_add || can_override_on_remove)) {
@@ -1525,6 +1661,12 @@ repeat_event:
             continue;
         }
 
+        /* Only walk the entities that inherit the component if there are 
+         * observers that could receive the propagated event. */
+        if (!flecs_component_observers_up(world, er, cr)) {
+            continue;
+        }
+
         /* The table->traversable_count value indicates if the table contains any
          * entities that are used as targets of traversable relationships. If the
          * entity/entities for which the event was generated are used as such a
@@ -17,6 +17,24 @@ typedef struct ecs_event_id_record_t {
     int32_t observer_count;
 } ecs_event_id_record_t;
 
+/* Flags for ecs_component_record_t::dispatch */
+#define EcsDispatchOnAdd               (1u << 0u)
+#define EcsDispatchOnRemove            (1u << 1u)
+#define EcsDispatchOnSet               (1u << 2u)
+#define EcsDispatchOnWildcard          (1u << 3u)
+
+/* Set when observers for the event traverse relationships (up, self|up). The
+ * up flag for an event is the dispatch flag shifted by EcsDispatchUpShift. */
+#define EcsDispatchUpShift             (4u)
+
+/* Event buffered by a batched observer */
+typedef struct ecs_observer_batch_elem_t {
+    ecs_entity_t event;
+    ecs_entity_t entity;
+    ecs_table_t *table;         /* Table and row are looked up on flush */
+    int32_t row;
+} ecs_observer_batch_elem_t;
+
 typedef struct ecs_observer_impl_t {
     ecs_observer_t pub;
 
@@ -34,6 +52,9 @@ typedef struct ecs_observer_impl_t {
     ecs_query_t *not_query;     /**< Query used to populate observer data when a
                                      term with a not operator triggers. */
 
+    ecs_vec_t batch;            /**< vector<ecs_observer_batch_elem_t>, events 
+                                     buffered by a batched observer */
+
     /* Mixins */
     flecs_poly_dtor_t dtor;
 } ecs_observer_impl_t;
@@ -108,6 +129,10 @@ void flecs_observers_invoke(
     ecs_table_t *table,
     ecs_entity_t trav);
 
+/* Deliver buffered events to batched observers. */
+void flecs_observers_flush_batched(
+    ecs_world_t *world);
+
 /* Invalidate reachable cache. */
 void flecs_emit_propagate_invalidate(
     ecs_world_t *world,
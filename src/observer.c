@@ -65,6 +65,12 @@ void flecs_inc_observer_count(
     ecs_assert(idt != NULL, ECS_INTERNAL_ERROR, NULL);
     
     int32_t result = idt->observer_count += value;
+
+    /* Invalidate observers cached on component records. This happens for each
+     * change, since the set of observers that traverse relationships can 
+     * change without the observer count going to or from zero. */
+    world->observable.dispatch_generation ++;
+
     if (result == 1) {
         /* Notify framework that there are observers for the event/id. This 
          * allows parts of the code to skip event evaluation early */
@@ -415,6 +421,33 @@ void flecs_observer_invoke(
     }
 }
 
+/* Buffer entities of event for batched observer. */
+static
+void flecs_observer_batch(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    const ecs_iter_t *it,
+    ecs_entity_t event)
+{
+    ecs_observer_impl_t *impl = flecs_observer_impl(o);
+    int32_t i, count = it->count;
+    if (!count) {
+        return;
+    }
+
+    if (!ecs_vec_count(&impl->batch)) {
+        ecs_vec_append_t(NULL, &world->observable.batched_observers, 
+            ecs_observer_t*)[0] = o;
+    }
+
+    ecs_observer_batch_elem_t *elems = ecs_vec_grow_t(&world->allocator, 
+        &impl->batch, ecs_observer_batch_elem_t, count);
+    for (i = 0; i < count; i ++) {
+        elems[i].event = event;
+        elems[i].entity = it->entities[i];
+    }
+}
+
 static
 void flecs_uni_observer_invoke(
     ecs_world_t *world,
@@ -427,6 +460,16 @@ void flecs_uni_observer_invoke(
         return;
     }
 
+    ecs_observer_impl_t *impl = flecs_observer_impl(o);
+    if (impl->flags & EcsObserverBatched) {
+        ecs_term_t *term = &o->query->terms[0];
+        if (!trav || term->trav == trav) {
+            flecs_observer_batch(world, o, it, 
+                flecs_get_observer_event(term, it->event));
+        }
+        return;
+    }
+
     if (ecs_should_log_3()) {
         char *path = ecs_get_path(world, it->system);
         ecs_dbg_3("observer: invoke %s", path);
@@ -435,7 +478,6 @@ void flecs_uni_observer_invoke(
 
     ecs_log_push_3();
 
-    ecs_observer_impl_t *impl = flecs_observer_impl(o);
     it->system = o->entity;
     it->ctx = o->ctx;
     it->callback_ctx = o->callback_ctx;
@@ -571,6 +613,12 @@ void flecs_multi_observer_invoke(
 
     ecs_observer_impl_t *impl = flecs_observer_impl(o);
     ecs_world_t *world = it->real_world;
+
+    if (impl->flags & EcsObserverBatched) {
+        /* Query is evaluated when the batch is flushed */
+        flecs_observer_batch(world, o, it, it->event);
+        return;
+    }
     
     if (impl->last_event_id[0] == it->event_cur) {
         /* Already handled this event */
@@ -926,6 +974,7 @@ int flecs_multi_observer_init(
     child_desc.run_ctx = NULL;
     child_desc.run_ctx_free = NULL;
     child_desc.yield_existing = false;
+    child_desc.batched = false;
     child_desc.flags_ &= ~(EcsObserverYieldOnCreate|EcsObserverYieldOnDelete);
     ecs_os_zeromem(&child_desc.entity);
     ecs_os_zeromem(&child_desc.query.terms);
@@ -1140,7 +1189,8 @@ ecs_observer_t* flecs_observer_init(
         .ids = ids
     };
 
-    if (desc->events[0] != EcsMonitor) {
+    /* Batched observers evaluate their query when events are flushed */
+    if (desc->events[0] != EcsMonitor && !desc->batched) {
         if (flecs_query_finalize_simple(world, &dummy_query, &query_desc)) {
             /* Flag is set if query increased the keep_alive count of the 
              * queried for component, which prevents deleting the component
@@ -1256,6 +1306,24 @@ ecs_observer_t* flecs_observer_init(
     ecs_check(o->event_count != 0, ECS_INVALID_PARAMETER,
         "observer must have at least one event");
 
+    if (desc->batched) {
+        for (i = 0; i < o->event_count; i ++) {
+            ecs_entity_t event = o->events[i];
+            ecs_check(!(impl->flags & EcsObserverIsMonitor) && 
+                (event == EcsOnAdd || event == EcsOnSet), 
+                    ECS_INVALID_PARAMETER,
+                        "batched observers only support OnAdd and OnSet events");
+            (void)event;
+        }
+
+        ecs_check(query->flags & EcsQueryMatchThis, ECS_INVALID_PARAMETER,
+            "batched observers must match $this");
+
+        impl->flags |= EcsObserverBatched;
+        ecs_vec_init_t(&world->allocator, &impl->batch, 
+            ecs_observer_batch_elem_t, 0);
+    }
+
     bool multi = false;
 
     if (query->term_count == 1 && !desc->last_event_id) {
@@ -1440,6 +1508,190 @@ error:
     return 0;
 }
 
+static
+int flecs_observer_batch_compare(
+    const void *ptr_a,
+    const void *ptr_b)
+{
+    const ecs_observer_batch_elem_t *a = ptr_a;
+    const ecs_observer_batch_elem_t *b = ptr_b;
+
+    if (a->event != b->event) {
+        return (a->event > b->event) - (a->event < b->event);
+    }
+
+    if (a->table != b->table) {
+        return (a->table->id > b->table->id) - (a->table->id < b->table->id);
+    }
+
+    return (a->row > b->row) - (a->row < b->row);
+}
+
+/* Invoke batched observer for a range of entities with buffered events. */
+static
+void flecs_observer_batch_invoke(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    ecs_entity_t event,
+    ecs_table_range_t *range)
+{
+    ecs_query_t *query = o->query;
+    ecs_iter_t it = ecs_query_iter(world, query);
+    ecs_iter_set_var_as_range(&it, 0, range);
+
+    it.event = event;
+    it.event_id = query->ids[0];
+    it.system = o->entity;
+    it.ctx = o->ctx;
+    it.callback_ctx = o->callback_ctx;
+    it.run_ctx = o->run_ctx;
+    it.callback = o->callback;
+
+    ECS_TABLE_LOCK(world, range->table);
+
+    if (o->run) {
+        o->run(&it);
+    } else {
+        while (ecs_query_next(&it)) {
+            o->callback(&it);
+        }
+    }
+
+    ECS_TABLE_UNLOCK(world, range->table);
+
+    ecs_os_inc(&query->eval_count);
+    world->info.observers_ran_total ++;
+}
+
+/* Sort buffered events by table and row, and invoke the observer once for each
+ * contiguous range of entities. */
+static
+void flecs_observer_batch_flush(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    ecs_vec_t *batch)
+{
+    int32_t i, count = ecs_vec_count(batch), alive_count = 0;
+    ecs_observer_batch_elem_t *elems = ecs_vec_first(batch);
+
+    /* Entities may have been moved or deleted since the event was buffered */
+    for (i = 0; i < count; i ++) {
+        ecs_record_t *r = flecs_entities_try(world, elems[i].entity);
+        if (!r || !r->table) {
+            continue;
+        }
+
+        ecs_observer_batch_elem_t *elem = &elems[alive_count ++];
+        elem->event = elems[i].event;
+        elem->entity = elems[i].entity;
+        elem->table = r->table;
+        elem->row = ECS_RECORD_TO_ROW(r->row);
+    }
+
+    qsort(elems, flecs_itosize(alive_count), 
+        sizeof(ecs_observer_batch_elem_t), flecs_observer_batch_compare);
+
+    ecs_entity_t old_system = flecs_stage_set_system(
+        world->stages[0], o->entity);
+
+    for (i = 0; i < alive_count; ) {
+        ecs_observer_batch_elem_t *first = &elems[i];
+        int32_t end = first->row + 1;
+
+        for (i ++; i < alive_count; i ++) {
+            ecs_observer_batch_elem_t *elem = &elems[i];
+            if (elem->event != first->event || elem->table != first->table) {
+                break;
+            }
+
+            if (elem->row == (end - 1)) {
+                continue; /* Multiple events for the same entity */
+            }
+
+            if (elem->row != end) {
+                break;
+            }
+
+            end ++;
+        }
+
+        ecs_table_range_t range = {
+            .table = first->table,
+            .offset = first->row,
+            .count = end - first->row
+        };
+
+        flecs_observer_batch_invoke(world, o, first->event, &range);
+    }
+
+    flecs_stage_set_system(world->stages[0], old_system);
+}
+
+void flecs_observers_flush_batched(
+    ecs_world_t *world)
+{
+    ecs_vec_t *observers = &world->observable.batched_observers;
+    if (!ecs_vec_count(observers)) {
+        return;
+    }
+
+    /* Only flush when operations can be applied to the world directly */
+    ecs_stage_t *stage = world->stages[0];
+    if (stage->defer || stage->cmd_flushing || 
+        (world->flags & (EcsWorldReadonly|EcsWorldFini))) 
+    {
+        return;
+    }
+
+    ecs_os_perf_trace_push("flecs.observers.flush_batched");
+
+    /* Defer operations from observers so that entities don't move while the
+     * buffered events are delivered. */
+    flecs_defer_begin(world, stage);
+
+    int32_t count;
+    while ((count = ecs_vec_count(observers))) {
+        ecs_observer_t *o = ecs_vec_last_t(observers, ecs_observer_t*)[0];
+        ecs_observer_impl_t *impl = flecs_observer_impl(o);
+        ecs_vec_remove_last(observers);
+
+        /* Take ownership of the buffered events, so that the observer can 
+         * buffer new events while it is invoked. */
+        ecs_vec_t batch = impl->batch;
+        ecs_vec_init_t(&world->allocator, &impl->batch, 
+            ecs_observer_batch_elem_t, 0);
+
+        if (!(impl->flags & (EcsObserverIsDisabled|EcsObserverIsParentDisabled))) {
+            flecs_observer_batch_flush(world, o, &batch);
+        }
+
+        ecs_vec_fini_t(&world->allocator, &batch, ecs_observer_batch_elem_t);
+
+        if (count == 1) {
+            /* Merge operations from observers, which can buffer new events */
+            flecs_defer_end(world, stage);
+            flecs_defer_begin(world, stage);
+        }
+    }
+
+    flecs_defer_end(world, stage);
+
+    ecs_os_perf_trace_pop("flecs.observers.flush_batched");
+}
+
+void ecs_flush_observers(
+    ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!ecs_is_deferred(world), ECS_INVALID_OPERATION, 
+        "cannot flush observers while world is deferred");
+    ecs_check(!(world->flags & EcsWorldReadonly), ECS_INVALID_OPERATION, 
+        "cannot flush observers while world is in readonly mode");
+    flecs_observers_flush_batched(world);
+error:
+    return;
+}
+
 const ecs_observer_t* ecs_observer_get(
     const ecs_world_t *world,
     ecs_entity_t observer)
@@ -1475,6 +1727,24 @@ void flecs_observer_fini(
 
     ecs_vec_fini_t(&world->allocator, &impl->children, ecs_observer_t*);
 
+    if (impl->flags & EcsObserverBatched) {
+        /* Discard buffered events */
+        if (ecs_vec_count(&impl->batch)) {
+            ecs_vec_t *batched = &world->observable.batched_observers;
+            int32_t i, count = ecs_vec_count(batched);
+            ecs_observer_t **observers = ecs_vec_first(batched);
+            for (i = 0; i < count; i ++) {
+                if (observers[i] == o) {
+                    ecs_vec_remove_t(batched, ecs_observer_t*, i);
+                    break;
+                }
+            }
+        }
+
+        ecs_vec_fini_t(&world->allocator, &impl->batch, 
+            ecs_observer_batch_elem_t);
+    }
+
     /* Cleanup queries */
     if (o->query) {
         ecs_query_fini(o->query);
@@ -1524,6 +1794,9 @@ void flecs_observer_set_disable_bit(
                 ECS_BIT_COND(flecs_observer_impl(children[i])->flags, bit, cond);
             }
         }
+
+        /* Batched observers check the bit when flushing */
+        ECS_BIT_COND(impl->flags, bit, cond);
     } else {
         flecs_poly_assert(o, ecs_observer_t);
         ECS_BIT_COND(impl->flags, bit, cond);
@@ -635,6 +635,12 @@ bool ecs_os_has_task_support(void) {
         (ecs_os_api.task_join_ != NULL);
 }
 
+bool ecs_os_has_atomic_cas(void) {
+    return
+        (ecs_os_api.acas_ != NULL) &&
+        (ecs_os_api.lacas_ != NULL);
+}
+
 bool ecs_os_has_time(void) {
     return 
         (ecs_os_api.get_time_ != NULL) &&
@@ -199,6 +199,13 @@ int flecs_query_create_cache(
         desc->entity = q->entity;
     }
 
+    if (q->cache_kind != EcsQueryCacheNone) {
+        /* Use existing cache if a query with the same terms has one */
+        if (flecs_query_cache_share(impl, desc)) {
+            return 0;
+        }
+    }
+
     if (q->cache_kind == EcsQueryCacheAll) {
         /* Create query cache for all terms */
         if (!flecs_query_cache_init(impl, desc)) {
@@ -262,6 +269,10 @@ int flecs_query_create_cache(
         }
     }
 
+    if (impl->cache) {
+        flecs_query_cache_register(impl, desc);
+    }
+
     return 0;
 error:
     return -1;
@@ -332,8 +343,7 @@ void flecs_query_fini(
     }
 
     if (impl->cache) {
-        flecs_free_n(a, int8_t, FLECS_TERM_COUNT_MAX, impl->cache->field_map);
-        flecs_query_cache_fini(impl);
+        flecs_query_cache_release(impl);
     }
 
     flecs_query_free_arrays(q);
@@ -685,6 +695,105 @@ error:
     return;
 }
 
+static
+bool flecs_query_op_is_driver(
+    const ecs_query_op_t *op)
+{
+    switch(op->kind) {
+    case EcsQueryAll:
+    case EcsQueryAnd:
+    case EcsQueryAndAny:
+    case EcsQueryAndWcTgt:
+    case EcsQueryTriv:
+    case EcsQueryUp:
+    case EcsQuerySelfUp:
+    case EcsQueryIdsRight:
+    case EcsQueryIdsLeft:
+    case EcsQueryIdsAll:
+    case EcsQuerySparse:
+    case EcsQuerySparseUp:
+    case EcsQuerySparseSelfUp:
+    case EcsQueryTree:
+    case EcsQueryTreeWildcard:
+    case EcsQueryTreePre:
+    case EcsQueryTreeUp:
+    case EcsQueryTreeSelfUp:
+    case EcsQueryTreeUpPre:
+    case EcsQueryTreeSelfUpPre:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ecs_iter_set_partition(
+    ecs_iter_t *it,
+    int32_t index,
+    int32_t count)
+{
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(it->next == ecs_query_next, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!(it->flags & EcsIterIsValid), ECS_INVALID_PARAMETER, 
+        "cannot set partition during iteration");
+    ecs_check(count > 0, ECS_INVALID_PARAMETER, 
+        "partition count must be larger than 0");
+    ecs_check(index >= 0 && index < count, ECS_INVALID_PARAMETER, 
+        "partition index out of range");
+
+    ecs_query_iter_t *qit = &it->priv_.iter.query;
+    ecs_query_impl_t *q = flecs_query_impl(it->query);
+    ecs_check(q != NULL, ECS_INVALID_PARAMETER, NULL);
+    flecs_poly_assert(q, ecs_query_t);
+
+    qit->partition_index = index;
+    qit->partition_count = count;
+    qit->partition_cur = 0;
+
+    if (qit->ops != q->ops) {
+        /* Driver operation was already replaced by a previous call */
+        return;
+    }
+
+    qit->partition_op = -1;
+    if (count == 1 || !q->ops) {
+        /* Nothing to partition, or iterator doesn't run the query VM */
+        return;
+    }
+
+    /* Find the first operation that produces results, skipping over the
+     * operations that initialize iterator state. */
+    const ecs_query_op_t *ops = q->ops;
+    int16_t i, op_count = flecs_ito(int16_t, q->op_count);
+    for (i = 0; i < op_count; i ++) {
+        ecs_query_op_kind_t kind = ops[i].kind;
+        if (kind != EcsQuerySetVars && kind != EcsQuerySetThis && 
+            kind != EcsQuerySetFixed && kind != EcsQuerySetIds &&
+            kind != EcsQuerySetId)
+        {
+            break;
+        }
+    }
+
+    if (i == op_count || !flecs_query_op_is_driver(&ops[i])) {
+        /* Plan starts with a control flow operation. Partition yielded
+         * results instead. */
+        return;
+    }
+
+    /* Replace the driver operation in an iterator-local copy of the plan, so
+     * the remaining operations only run for tables in this partition. */
+    ecs_query_op_t *it_ops = flecs_iter_calloc_n(
+        it, ecs_query_op_t, op_count);
+    ecs_os_memcpy_n(it_ops, ops, ecs_query_op_t, op_count);
+    qit->partition_kind = it_ops[i].kind;
+    qit->partition_op = i;
+    it_ops[i].kind = EcsQueryPartition;
+    qit->ops = it_ops;
+
+error:
+    return;
+}
+
 const ecs_query_group_info_t* ecs_query_get_group_info(
     const ecs_query_t *query,
     uint64_t group_id)
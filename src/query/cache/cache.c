@@ -127,6 +127,19 @@
  * iterating the group->tables array and the wildcard_matches array on each
  * matched table, in a way that all matches for the same table are iterated
  * together.
+ * 
+ * Sharing
+ * =======
+ * Applications often create many queries with the same terms, for example 
+ * systems that iterate the same components. Rather than building a separate
+ * cache for each of these queries, queries with identical terms and flags share
+ * a single reference counted cache. Caches that can be shared are stored in the
+ * world::query_caches map, which is indexed by a hash of the terms.
+ * 
+ * Only caches whose contents don't depend on the query that created them can be
+ * shared. This excludes queries with group_by, order_by, change detection and
+ * up traversal (which registers monitors for the query), and queries with
+ * variables other than $this.
  */
 
 #include "../../private_api.h"
@@ -425,9 +438,9 @@ void flecs_query_cache_on_event(
         o_impl->last_event_id[0] = world->event_id;
     }
 
-    ecs_query_impl_t *impl = o->ctx;
-    flecs_poly_assert(impl, ecs_query_t);
-    ecs_query_cache_t *cache = impl->cache;
+    /* The observer context is the cache and not the query, as the cache can
+     * be shared by multiple queries. */
+    ecs_query_cache_t *cache = o->ctx;
     ecs_assert(cache != NULL, ECS_INTERNAL_ERROR, NULL);
     ecs_table_t *table = it->table;
     ecs_entity_t event = it->event;
@@ -546,6 +559,16 @@ void flecs_query_cache_fini(
     ecs_map_fini(&cache->tables);
     ecs_map_fini(&cache->groups);
     ecs_vec_fini_t(NULL, &cache->table_slices, ecs_query_cache_match_t);
+
+    int32_t i, count = ecs_vec_count(&cache->merge_jobs);
+    ecs_query_cache_merge_job_t *merge_jobs = ecs_vec_first(&cache->merge_jobs);
+    for (i = 0; i < count; i ++) {
+        ecs_vec_fini_t(NULL, &merge_jobs[i].slices, ecs_query_cache_match_t);
+    }
+    ecs_vec_fini_t(&world->allocator, &cache->merge_jobs, 
+        ecs_query_cache_merge_job_t);
+    ecs_vec_fini_t(&world->allocator, &cache->sort_jobs, 
+        ecs_query_cache_sort_job_t);
     
     if (cache->query->term_count) {
         flecs_bfree(&cache->allocators.ids, cache->sources);
@@ -554,6 +577,9 @@ void flecs_query_cache_fini(
     flecs_query_cache_allocators_fini(cache);
     ecs_query_fini(cache->query);
 
+    flecs_free_n(&stage->allocator, int8_t, FLECS_TERM_COUNT_MAX, 
+        cache->field_map);
+
     flecs_bfree(&stage->allocators.query_cache, cache);
 }
 
@@ -594,8 +620,19 @@ ecs_query_cache_t* flecs_query_cache_init(
 
     ecs_query_cache_t *result = flecs_bcalloc(&stage->allocators.query_cache);
     result->entity = entity;
+    result->refcount = 1;
+    result->stage = stage;
     impl->cache = result;
 
+    /* If no compare function is provided, sort on the primitive value of the
+     * order_by component or member. */
+    ecs_entity_t order_by = const_desc->order_by;
+    ecs_order_by_action_t order_by_callback = const_desc->order_by_callback;
+    if (order_by && !order_by_callback) {
+        order_by_callback = flecs_query_cache_order_by_key(
+            world, result, &order_by);
+    }
+
     ecs_observer_desc_t observer_desc = { .query = desc };
     observer_desc.query.flags |= EcsQueryNested;
 
@@ -604,7 +641,7 @@ ecs_query_cache_t* flecs_query_cache_init(
 
     /* order_by is not compatible with matching empty tables, as it causes
      * a query to return table slices, not entire tables. */
-    if (const_desc->order_by_callback) {
+    if (order_by_callback) {
         query_flags &= ~EcsQueryMatchEmptyTables;
     }
 
@@ -657,14 +694,14 @@ ecs_query_cache_t* flecs_query_cache_init(
         }
     }
 
-    if (const_desc->order_by) {
+    if (order_by) {
         ecs_component_record_t *cr = 
-            flecs_components_ensure(world, const_desc->order_by);
+            flecs_components_ensure(world, order_by);
         if (cr) {
             cr->flags |= EcsIdHasOnSet;
 
-            if (const_desc->order_by < FLECS_HI_COMPONENT_ID) {
-                world->non_trivial_set[const_desc->order_by] = true;
+            if (order_by < FLECS_HI_COMPONENT_ID) {
+                world->non_trivial_set[order_by] = true;
             }
         }
     }
@@ -692,7 +729,7 @@ ecs_query_cache_t* flecs_query_cache_init(
 
     if (q->term_count) {
         observer_desc.run = flecs_query_cache_on_event;
-        observer_desc.ctx = impl;
+        observer_desc.ctx = result;
 
         int32_t event_index = 0;
         observer_desc.events[event_index ++] = EcsOnTableCreate;
@@ -713,6 +750,7 @@ ecs_query_cache_t* flecs_query_cache_init(
     }
 
     result->prev_match_count = -1;
+    result->sort_merge_count = -1;
 
     if (ecs_should_log_1()) {
         char *query_expr = ecs_query_str(result->query);
@@ -753,9 +791,9 @@ ecs_query_cache_t* flecs_query_cache_init(
     ecs_map_init(&result->tables, &world->allocator);
     flecs_query_cache_match_tables(world, result);
 
-    if (const_desc->order_by_callback) {
+    if (order_by_callback) {
         if (flecs_query_cache_order_by(world, impl, 
-            const_desc->order_by, const_desc->order_by_callback,
+            order_by, order_by_callback,
             const_desc->order_by_table_callback))
         {
             goto error;
@@ -774,3 +812,279 @@ ecs_query_cache_t* flecs_query_cache_init(
 error:
     return NULL;
 }
+
+/* Can the cache of a query be shared with other queries? */
+static
+bool flecs_query_cache_is_shareable(
+    ecs_query_impl_t *impl,
+    const ecs_query_desc_t *desc)
+{
+    ecs_query_t *q = &impl->pub;
+    if (q->flags & EcsQueryNested) {
+        return false;
+    }
+
+    if (desc->order_by || desc->order_by_callback || 
+        desc->group_by || desc->group_by_callback ||
+        (desc->flags & EcsQueryDetectChanges))
+    {
+        return false;
+    }
+
+    if (q->real_world->flags & EcsWorldFini) {
+        return false;
+    }
+
+    int32_t i, count = q->term_count;
+    for (i = 0; i < count; i ++) {
+        ecs_term_t *term = &q->terms[i];
+        if (term->src.id & (EcsUp|EcsCascade)) {
+            return false;
+        }
+
+        /* Names are only preserved for variables, which are owned by the query
+         * and can't be compared after the query is deleted. */
+        if (term->src.name || term->first.name || term->second.name) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static
+uint64_t flecs_query_cache_hash(
+    const ecs_query_t *q)
+{
+    uint64_t key[FLECS_TERM_COUNT_MAX * 6 + 2];
+    int32_t i, count = q->term_count, k = 0;
+    for (i = 0; i < count; i ++) {
+        const ecs_term_t *term = &q->terms[i];
+        key[k ++] = term->id;
+        key[k ++] = term->src.id;
+        key[k ++] = term->first.id;
+        key[k ++] = term->second.id;
+        key[k ++] = term->trav;
+        key[k ++] = (uint64_t)(uint16_t)term->inout | 
+            ((uint64_t)(uint16_t)term->oper << 16) |
+            ((uint64_t)(uint8_t)term->field_index << 32) |
+            ((uint64_t)term->flags_ << 40);
+    }
+
+    key[k ++] = q->flags;
+    key[k ++] = (uint64_t)q->cache_kind;
+
+    return flecs_hash(key, k * ECS_SIZEOF(uint64_t));
+}
+
+static
+bool flecs_query_cache_terms_equal(
+    const ecs_term_t *a,
+    const ecs_term_t *b,
+    int32_t count)
+{
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        const ecs_term_t *ta = &a[i], *tb = &b[i];
+        if (ta->id != tb->id ||
+            ta->src.id != tb->src.id ||
+            ta->first.id != tb->first.id ||
+            ta->second.id != tb->second.id ||
+            ta->trav != tb->trav ||
+            ta->inout != tb->inout ||
+            ta->oper != tb->oper ||
+            ta->field_index != tb->field_index ||
+            ta->flags_ != tb->flags_)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Find cache created by a query with the same terms, and use it. */
+bool flecs_query_cache_share(
+    ecs_query_impl_t *impl,
+    const ecs_query_desc_t *desc)
+{
+    if (!flecs_query_cache_is_shareable(impl, desc)) {
+        return false;
+    }
+
+    ecs_query_t *q = &impl->pub;
+    ecs_world_t *world = q->real_world;
+    uint64_t hash = flecs_query_cache_hash(q);
+
+    ecs_query_cache_t *cache = ecs_map_get_deref(
+        &world->query_caches, ecs_query_cache_t, hash);
+    for (; cache; cache = cache->next) {
+        if (cache->stage != impl->stage) {
+            continue;
+        }
+        if (cache->term_count != q->term_count) {
+            continue;
+        }
+        if (cache->flags != q->flags) {
+            continue;
+        }
+        if (!flecs_query_cache_terms_equal(
+            cache->terms, q->terms, q->term_count)) 
+        {
+            continue;
+        }
+        break;
+    }
+
+    if (!cache) {
+        return false;
+    }
+
+    ecs_assert(q->entity != 0, ECS_INTERNAL_ERROR, NULL);
+    ecs_vec_append_t(&world->allocator, &cache->entities, 
+        ecs_entity_t)[0] = q->entity;
+    cache->refcount ++;
+    impl->cache = cache;
+
+    if (!ecs_map_count(&cache->tables) && cache->query->term_count) {
+        ecs_add_id(world, q->entity, EcsEmpty);
+    }
+
+    ecs_dbg_2("#[green]query#[normal] shares cache of #[yellow]%s", 
+        flecs_errstr(ecs_get_path(world, cache->entity)));
+
+    return true;
+}
+
+/* Make cache of query available to queries with the same terms. */
+void flecs_query_cache_register(
+    ecs_query_impl_t *impl,
+    const ecs_query_desc_t *desc)
+{
+    ecs_query_cache_t *cache = impl->cache;
+    ecs_assert(cache != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(cache->terms == NULL, ECS_INTERNAL_ERROR, NULL);
+
+    if (!flecs_query_cache_is_shareable(impl, desc)) {
+        return;
+    }
+
+    /* Non-trivial caches store change detection monitors in their elements,
+     * which ecs_query_changed() and ecs_iter_changed() enable lazily for the
+     * query that calls them. Sharing such a cache would let one query sync 
+     * the monitors of another, so only share trivial caches. */
+    if (!flecs_query_cache_is_trivial(cache)) {
+        return;
+    }
+
+    ecs_query_t *q = &impl->pub;
+    ecs_world_t *world = q->real_world;
+    cache->hash = flecs_query_cache_hash(q);
+    cache->terms = flecs_dup_n(&world->allocator, ecs_term_t, 
+        q->term_count, q->terms);
+    cache->term_count = q->term_count;
+    cache->flags = q->flags;
+    ecs_vec_init_t(&world->allocator, &cache->entities, ecs_entity_t, 0);
+
+    ecs_query_cache_t **ptr = ecs_map_ensure_ref(
+        &world->query_caches, ecs_query_cache_t, cache->hash);
+    cache->next = ptr[0];
+    ptr[0] = cache;
+}
+
+/* Remove cache from world::query_caches. */
+static
+void flecs_query_cache_unregister(
+    ecs_world_t *world,
+    ecs_query_cache_t *cache)
+{
+    ecs_query_cache_t **ptr = ecs_map_get_ref(
+        &world->query_caches, ecs_query_cache_t, cache->hash);
+    ecs_assert(ptr != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    while (ptr[0] != cache) {
+        ecs_assert(ptr[0] != NULL, ECS_INTERNAL_ERROR, NULL);
+        ptr = &ptr[0]->next;
+    }
+
+    ptr[0] = cache->next;
+
+    if (!ecs_map_get_deref(
+        &world->query_caches, ecs_query_cache_t, cache->hash)) 
+    {
+        ecs_map_remove(&world->query_caches, cache->hash);
+    }
+
+    flecs_free_n(&world->allocator, ecs_term_t, cache->term_count, 
+        cache->terms);
+    ecs_vec_fini_t(&world->allocator, &cache->entities, ecs_entity_t);
+    cache->terms = NULL;
+}
+
+/* Release reference to query cache. */
+void flecs_query_cache_release(
+    ecs_query_impl_t *impl)
+{
+    ecs_query_cache_t *cache = impl->cache;
+    ecs_assert(cache != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_world_t *world = impl->pub.real_world;
+
+    if (!-- cache->refcount) {
+        if (cache->terms) {
+            flecs_query_cache_unregister(world, cache);
+        }
+        flecs_query_cache_fini(impl);
+        return;
+    }
+
+    /* Other queries are still using the cache. If the cache belongs to the
+     * entity of the deleted query, transfer it to one of the other queries. */
+    ecs_entity_t entity = impl->pub.entity;
+    int32_t i, count = ecs_vec_count(&cache->entities);
+    ecs_entity_t *entities = ecs_vec_first(&cache->entities);
+    ecs_assert(count != 0, ECS_INTERNAL_ERROR, NULL);
+
+    if (cache->entity == entity) {
+        entity = cache->entity = entities[0];
+        i = 0;
+    } else {
+        for (i = 0; i < count; i ++) {
+            if (entities[i] == entity) {
+                break;
+            }
+        }
+        ecs_assert(i != count, ECS_INTERNAL_ERROR, NULL);
+    }
+
+    ecs_vec_remove_t(&cache->entities, ecs_entity_t, i);
+
+    ecs_observer_t *o = cache->observer;
+    if (o) {
+        o->entity = cache->entity;
+
+        ecs_observer_impl_t *o_impl = flecs_observer_impl(o);
+        ecs_observer_t **children = ecs_vec_first(&o_impl->children);
+        count = ecs_vec_count(&o_impl->children);
+        for (i = 0; i < count; i ++) {
+            children[i]->entity = cache->entity;
+        }
+    }
+}
+
+/* Remove EcsEmpty tag from all queries that use the cache. */
+void flecs_query_cache_set_not_empty(
+    ecs_query_cache_t *cache)
+{
+    ecs_world_t *world = cache->query->world;
+    if (cache->entity) {
+        ecs_remove_id(world, cache->entity, EcsEmpty);
+    }
+
+    if (cache->terms) {
+        int32_t i, count = ecs_vec_count(&cache->entities);
+        ecs_entity_t *entities = ecs_vec_first(&cache->entities);
+        for (i = 0; i < count; i ++) {
+            ecs_remove_id(world, entities[i], EcsEmpty);
+        }
+    }
+}
@@ -27,6 +27,7 @@ struct ecs_query_cache_match_t {
     ecs_entity_t *_sources;           /* Sources of ids. */
     ecs_termset_t _up_fields;         /* Fields that are matched through traversal. */
     int32_t *_monitor;                /* Used to monitor table for changes. */
+    int32_t _sort_state[2];           /* Table and order_by column dirty state at last sort. */
     int32_t rematch_count;            /* Track whether table was rematched. */
     ecs_vec_t *wildcard_matches;      /* Additional matches for table for wildcard queries. */
 };
@@ -52,6 +53,27 @@ typedef struct ecs_query_cache_allocators_t {
     ecs_block_allocator_t columns;
 } ecs_query_cache_allocators_t;
 
+/* Kind of key used to radix sort tables for order_by */
+typedef enum ecs_query_sort_key_t {
+    EcsQuerySortKeyNone,
+    EcsQuerySortKeyUnsigned,
+    EcsQuerySortKeySigned,
+    EcsQuerySortKeyFloat
+} ecs_query_sort_key_t;
+
+/* Table that must be sorted before the query is iterated */
+typedef struct ecs_query_cache_sort_job_t {
+    ecs_query_cache_match_t *match;
+    int32_t column;                   /* Column of order_by component, or -1 */
+    bool structural;                  /* Table gained or lost entities */
+} ecs_query_cache_sort_job_t;
+
+/* Group for which sorted table slices must be built */
+typedef struct ecs_query_cache_merge_job_t {
+    ecs_query_cache_group_t *group;
+    ecs_vec_t slices;                 /* vec<ecs_query_cache_match_t> */
+} ecs_query_cache_merge_job_t;
+
 /** Query that is automatically matched against tables */
 typedef struct ecs_query_cache_t {
     /* Uncached query used to populate the cache */
@@ -78,6 +100,18 @@ typedef struct ecs_query_cache_t {
     ecs_sort_table_action_t order_by_table_callback;
     ecs_vec_t table_slices;
     int32_t order_by_term;
+    ecs_size_t order_by_offset;      /* Offset of member to sort on */
+    int8_t order_by_key;             /* Radix sort key kind (ecs_query_sort_key_t) */
+    int8_t order_by_key_size;        /* Size of radix sort key */
+    int32_t sort_match_count;        /* match_count when slices were built */
+    int64_t sort_merge_count;        /* Merge count when pipeline last sorted */
+
+    /* Sorting work that can be distributed across threads */
+    ecs_vec_t sort_jobs;             /* vec<ecs_query_cache_sort_job_t> */
+    ecs_vec_t merge_jobs;            /* vec<ecs_query_cache_merge_job_t> */
+    int32_t sort_job_next;           /* Next sort job to claim */
+    int32_t merge_job_next;          /* Next merge job to claim */
+    int32_t merge_job_count;         /* Number of merge jobs to run */
 
     /* Table grouping */
     ecs_entity_t group_by;
@@ -103,6 +137,17 @@ typedef struct ecs_query_cache_t {
     /* Map field indices from cache query to actual query */
     int8_t *field_map;
 
+    /* Sharing cache between queries with identical terms. The terms, term
+     * count and flags are copied from the query that created the cache. */
+    int32_t refcount;                /* Number of queries using the cache */
+    uint64_t hash;                   /* Key in world::query_caches */
+    ecs_term_t *terms;               /* Terms of query, NULL if not shared */
+    int32_t term_count;
+    ecs_flags32_t flags;
+    ecs_stage_t *stage;              /* Stage cache is allocated from */
+    ecs_vec_t entities;              /* vec<ecs_entity_t> of other queries */
+    struct ecs_query_cache_t *next;  /* Next cache with same hash */
+
     /* Query-level allocators */
     ecs_query_cache_allocators_t allocators;
 } ecs_query_cache_t;
@@ -114,13 +159,63 @@ ecs_query_cache_t* flecs_query_cache_init(
 void flecs_query_cache_fini(
     ecs_query_impl_t *impl);
 
+/* Queries with identical terms share a single cache. Share returns true if a
+ * cache was found for the query, register makes a new cache available for
+ * sharing. Release drops the query's reference and frees the cache when the
+ * last query that uses it is deleted. */
+bool flecs_query_cache_share(
+    ecs_query_impl_t *impl,
+    const ecs_query_desc_t *desc);
+
+void flecs_query_cache_register(
+    ecs_query_impl_t *impl,
+    const ecs_query_desc_t *desc);
+
+void flecs_query_cache_release(
+    ecs_query_impl_t *impl);
+
+/* Remove EcsEmpty tag from all queries that use the cache. */
+void flecs_query_cache_set_not_empty(
+    ecs_query_cache_t *cache);
+
 void flecs_query_cache_sort_tables(
     ecs_world_t *world,
     ecs_query_impl_t *impl);
 
+/* Sorting is split up in phases so it can be distributed across threads. 
+ * Prepare runs on the main thread and collects the tables that changed since
+ * the last sort. It returns false if the query doesn't need sorting. The sort
+ * and merge phases can run on multiple threads at the same time. All threads
+ * must have finished sorting before merging starts. Finish runs on the main
+ * thread and stores the sorted table slices in the cache. */
+bool flecs_query_cache_sort_prepare(
+    ecs_world_t *world,
+    ecs_query_cache_t *cache);
+
+void flecs_query_cache_sort_run(
+    ecs_world_t *world,
+    ecs_query_cache_t *cache,
+    int32_t stage_count);
+
+void flecs_query_cache_merge_run(
+    ecs_query_cache_t *cache,
+    int32_t stage_count);
+
+void flecs_query_cache_sort_finish(
+    ecs_query_cache_t *cache);
+
 void flecs_query_cache_build_sorted_tables(
     ecs_query_cache_t *cache);
 
+/* Find radix sort key for order_by component or member with a primitive type.
+ * Returns the compare function to use for the key, or NULL if the type doesn't
+ * have a primitive key. If order_by is a member, it is replaced with the
+ * component that contains the member. */
+ecs_order_by_action_t flecs_query_cache_order_by_key(
+    const ecs_world_t *world,
+    ecs_query_cache_t *cache,
+    ecs_entity_t *order_by);
+
 bool flecs_query_cache_is_trivial(
     const ecs_query_cache_t *cache);
 
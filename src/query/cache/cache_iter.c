@@ -23,8 +23,15 @@ void flecs_query_cache_iter_init(
 
     /* If query uses order_by, iterate the array with ordered table slices. */
     if (cache->order_by_callback) {
-        /* Check if query needs sorting. */
-        flecs_query_cache_sort_tables(it->real_world, impl);
+        /* Check if query needs sorting. When systems run on multiple threads,
+         * queries of systems are sorted by the pipeline before the systems
+         * run, and sorting here would race with other threads. */
+        ecs_world_t *world = it->real_world;
+        if (!(world->flags & EcsWorldMultiThreaded) ||
+            (cache->sort_merge_count != world->info.merge_count_total)) 
+        {
+            flecs_query_cache_sort_tables(world, impl);
+        }
         qit->tables = &cache->table_slices;
         qit->all_tables = qit->tables;
         qit->group = NULL;
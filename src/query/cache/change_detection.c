@@ -494,14 +494,20 @@ void flecs_query_mark_fields_dirty(
 
         ecs_entity_t src = it->sources[i];
         ecs_table_t *table;
+        int32_t offset, count;
         if (!src) {
             table = it->table;
+            offset = it->offset;
+            count = it->count;
         } else {
             ecs_record_t *r = flecs_entities_get(world, src);
             if (!r || !(table = r->table)) {
                 continue;
             }
 
+            offset = ECS_RECORD_TO_ROW(r->row);
+            count = 1;
+
             if (q->shared_readonly_fields & flecs_ito(uint32_t, 1 << i)) {
                 /* Shared fields that aren't marked explicitly as out/inout 
                  * default to readonly */
@@ -528,7 +534,7 @@ void flecs_query_mark_fields_dirty(
 
         ecs_assert(type_index < table->type.count, ECS_INTERNAL_ERROR, NULL);
         int32_t column = table->column_map[type_index];
-        dirty_state[column + 1] ++;
+        flecs_table_mark_column_dirty(world, table, column + 1, offset, count);
     }
 }
 
@@ -574,7 +580,8 @@ void flecs_query_mark_fixed_fields_dirty(
         }
         ecs_assert(tr->column >= 0, ECS_INTERNAL_ERROR, NULL);
         int32_t column = table->column_map[tr->index];
-        dirty_state[column + 1] ++;
+        flecs_table_mark_column_dirty(world, table, column + 1, 
+            ECS_RECORD_TO_ROW(r->row), 1);
     }
 }
 
@@ -712,6 +719,156 @@ error:
     return false;
 }
 
+/* Check if a chunk changed for any of the specified table columns */
+static
+bool flecs_query_check_chunk_monitor(
+    const ecs_table_t *table,
+    const int32_t *columns,
+    const int32_t *monitor,
+    int32_t count,
+    int32_t chunk)
+{
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        int32_t state = flecs_table_get_chunk_dirty_state(
+            table, columns[i], chunk);
+        
+        /* Chunk changed if it was marked after the monitor was synchronized.
+         * Compare the difference as dirty state may wrap around. */
+        if ((int32_t)((uint32_t)state - (uint32_t)monitor[i]) > 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Public API call to find changed rows in the currently iterated result. */
+int32_t ecs_iter_changed_rows(
+    ecs_iter_t *it,
+    int32_t *row)
+{
+    ecs_check(row != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(*row >= 0, ECS_INVALID_PARAMETER, NULL);
+
+    int32_t start = *row, count = it->count;
+    if (start >= count) {
+        return 0;
+    }
+
+    if (!ecs_iter_changed(it)) {
+        *row = count;
+        return 0;
+    }
+
+    ecs_query_impl_t *impl = flecs_query_impl(it->query);
+    ecs_query_cache_t *cache = impl->cache;
+    ecs_table_t *table = it->table;
+
+    /* Changes to fields with fixed sources apply to all rows */
+    if ((it->flags & EcsIterFixedInChanged) || !cache || !table) {
+        return count - start;
+    }
+
+    const ecs_query_t *query = cache->query;
+    ecs_world_t *world = query->world;
+    ecs_query_cache_match_t *qm = 
+        (ecs_query_cache_match_t*)it->priv_.iter.query.elem;
+    ecs_assert(qm != NULL, ECS_INTERNAL_ERROR, NULL);
+    int32_t *monitor = qm->_monitor;
+    ecs_assert(monitor != NULL, ECS_INTERNAL_ERROR, NULL);
+    int32_t *dirty_state = flecs_table_get_dirty_state(world, table);
+
+    /* Entities were added to or removed from the table */
+    if (monitor[0] != dirty_state[0]) {
+        return count - start;
+    }
+
+    /* Collect owned columns that changed since the last iteration */
+    int32_t columns[FLECS_TERM_COUNT_MAX];
+    int32_t column_monitor[FLECS_TERM_COUNT_MAX];
+    int32_t i, field_count = query->field_count, changed_count = 0;
+    ecs_entity_t *sources = NULL;
+    if (!flecs_query_cache_is_trivial(cache)) {
+        sources = qm->_sources;
+    }
+
+    for (i = 0; i < field_count; i ++) {
+        int32_t mon = monitor[i + 1];
+        if (mon == -1) {
+            continue;
+        }
+
+        if (!(it->set_fields & (1llu << i))) {
+            continue;
+        }
+
+        ecs_entity_t src = sources ? sources[i] : 0;
+        if (!src) {
+            int32_t column = qm->base.columns[i];
+            if (column >= 0 && mon != dirty_state[column + 1]) {
+                columns[changed_count] = column + 1;
+                column_monitor[changed_count] = mon;
+                changed_count ++;
+            }
+            continue;
+        }
+
+        /* Shared component changed, which applies to all rows */
+        flecs_table_column_t tc;
+        flecs_query_get_column_for_field(query, qm, i, &tc);
+        if (!tc.table || tc.column < 0) {
+            continue;
+        }
+
+        if (mon != flecs_table_get_dirty_state(world, tc.table)[tc.column + 1]) {
+            return count - start;
+        }
+    }
+
+    if (!changed_count) {
+        *row = count;
+        return 0;
+    }
+
+    /* Find first range of changed chunks, starting from the provided row */
+    int32_t offset = it->offset;
+    int32_t chunk = (offset + start) >> FLECS_CHANGE_CHUNK_BITS;
+    int32_t last = (offset + count - 1) >> FLECS_CHANGE_CHUNK_BITS;
+
+    while (chunk <= last && !flecs_query_check_chunk_monitor(
+        table, columns, column_monitor, changed_count, chunk)) 
+    {
+        chunk ++;
+    }
+
+    if (chunk > last) {
+        *row = count;
+        return 0;
+    }
+
+    int32_t end = chunk + 1;
+    while (end <= last && flecs_query_check_chunk_monitor(
+        table, columns, column_monitor, changed_count, end)) 
+    {
+        end ++;
+    }
+
+    int32_t first_row = (chunk << FLECS_CHANGE_CHUNK_BITS) - offset;
+    int32_t end_row = (end << FLECS_CHANGE_CHUNK_BITS) - offset;
+    if (first_row < start) {
+        first_row = start;
+    }
+    if (end_row > count) {
+        end_row = count;
+    }
+
+    *row = first_row;
+    return end_row - first_row;
+error:
+    return 0;
+}
+
 /* Public API call for skipping change detection (don't mark fields dirty) */
 void ecs_iter_skip(
     ecs_iter_t *it)
@@ -297,8 +297,8 @@ ecs_query_cache_match_t* flecs_query_cache_add_table(
     ecs_assert(ecs_map_get(&cache->tables, table->id) == NULL, 
         ECS_INTERNAL_ERROR, NULL);
 
-    if (!ecs_map_count(&cache->tables) && cache->entity) {
-        ecs_remove_id(cache->query->world, cache->entity, EcsEmpty);
+    if (!ecs_map_count(&cache->tables)) {
+        flecs_query_cache_set_not_empty(cache);
     }
 
     uint64_t group_id = flecs_query_cache_get_group_id(cache, table);
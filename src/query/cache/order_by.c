@@ -7,9 +7,266 @@
 
 ECS_SORT_TABLE_WITH_COMPARE(_, flecs_query_cache_sort_table_generic, order_by, static)
 
+/* Tables with fewer rows than this are sorted with the generic sort */
+#define FLECS_QUERY_RADIX_SORT_MIN (32)
+
+/* Convert value to unsigned key that sorts in the same order as the value */
+static
+uint64_t flecs_query_cache_sort_key(
+    const void *ptr,
+    ecs_query_sort_key_t kind,
+    ecs_size_t size)
+{
+    uint64_t key;
+    switch(size) {
+    case 1: key = *(const uint8_t*)ptr; break;
+    case 2: key = *(const uint16_t*)ptr; break;
+    case 4: key = *(const uint32_t*)ptr; break;
+    default: key = *(const uint64_t*)ptr; break;
+    }
+
+    uint64_t sign = 1llu << (size * 8 - 1);
+    if (kind == EcsQuerySortKeySigned) {
+        key ^= sign;
+    } else if (kind == EcsQuerySortKeyFloat) {
+        /* Negative floats sort in reverse order of their bits */
+        if (key & sign) {
+            key = ~key & ((sign - 1) | sign);
+        } else {
+            key |= sign;
+        }
+    }
+
+    return key;
+}
+
+/* Compare functions for order_by on primitive values */
+#define FLECS_QUERY_CACHE_COMPARE(T)\
+    static\
+    int flecs_query_cache_compare_##T(\
+        ecs_entity_t e1,\
+        const void *ptr1,\
+        ecs_entity_t e2,\
+        const void *ptr2)\
+    {\
+        (void)e1; (void)e2;\
+        T v1 = *(const T*)ptr1, v2 = *(const T*)ptr2;\
+        return (v1 > v2) - (v1 < v2);\
+    }
+
+FLECS_QUERY_CACHE_COMPARE(uint8_t)
+FLECS_QUERY_CACHE_COMPARE(uint16_t)
+FLECS_QUERY_CACHE_COMPARE(uint32_t)
+FLECS_QUERY_CACHE_COMPARE(uint64_t)
+FLECS_QUERY_CACHE_COMPARE(int8_t)
+FLECS_QUERY_CACHE_COMPARE(int16_t)
+FLECS_QUERY_CACHE_COMPARE(int32_t)
+FLECS_QUERY_CACHE_COMPARE(int64_t)
+
+/* Floats are compared by their sort key so that the compare function orders
+ * values the same as the radix sort, including NaN and negative zero. */
+#define FLECS_QUERY_CACHE_COMPARE_FLOAT(T)\
+    static\
+    int flecs_query_cache_compare_##T(\
+        ecs_entity_t e1,\
+        const void *ptr1,\
+        ecs_entity_t e2,\
+        const void *ptr2)\
+    {\
+        (void)e1; (void)e2;\
+        uint64_t k1 = flecs_query_cache_sort_key(\
+            ptr1, EcsQuerySortKeyFloat, ECS_SIZEOF(T));\
+        uint64_t k2 = flecs_query_cache_sort_key(\
+            ptr2, EcsQuerySortKeyFloat, ECS_SIZEOF(T));\
+        return (k1 > k2) - (k1 < k2);\
+    }
+
+FLECS_QUERY_CACHE_COMPARE_FLOAT(float)
+FLECS_QUERY_CACHE_COMPARE_FLOAT(double)
+
+ecs_order_by_action_t flecs_query_cache_order_by_key(
+    const ecs_world_t *world,
+    ecs_query_cache_t *cache,
+    ecs_entity_t *order_by)
+{
+#ifdef FLECS_META
+    ecs_entity_t component = *order_by, type = component;
+    ecs_size_t offset = 0;
+
+    const EcsMember *m = ecs_get(world, type, EcsMember);
+    if (m) {
+        component = ecs_get_parent(world, type);
+        if (!component) {
+            return NULL;
+        }
+        type = m->type;
+        offset = m->offset;
+    }
+
+    const EcsPrimitive *p = ecs_get(world, type, EcsPrimitive);
+    if (!p) {
+        return NULL;
+    }
+
+    ecs_query_sort_key_t key;
+    ecs_order_by_action_t compare;
+    ecs_size_t size;
+
+    switch(p->kind) {
+    case EcsBool:
+    case EcsByte:
+    case EcsU8:
+        key = EcsQuerySortKeyUnsigned;
+        compare = flecs_query_cache_compare_uint8_t;
+        size = 1;
+        break;
+    case EcsU16:
+        key = EcsQuerySortKeyUnsigned;
+        compare = flecs_query_cache_compare_uint16_t;
+        size = 2;
+        break;
+    case EcsU32:
+        key = EcsQuerySortKeyUnsigned;
+        compare = flecs_query_cache_compare_uint32_t;
+        size = 4;
+        break;
+    case EcsU64:
+    case EcsEntity:
+    case EcsId:
+        key = EcsQuerySortKeyUnsigned;
+        compare = flecs_query_cache_compare_uint64_t;
+        size = 8;
+        break;
+    case EcsUPtr:
+        key = EcsQuerySortKeyUnsigned;
+        size = ECS_SIZEOF(uintptr_t);
+        compare = size == 8 ? flecs_query_cache_compare_uint64_t
+                            : flecs_query_cache_compare_uint32_t;
+        break;
+    case EcsChar: /* Ordered as signed, regardless of the signedness of char */
+    case EcsI8:
+        key = EcsQuerySortKeySigned;
+        compare = flecs_query_cache_compare_int8_t;
+        size = 1;
+        break;
+    case EcsI16:
+        key = EcsQuerySortKeySigned;
+        compare = flecs_query_cache_compare_int16_t;
+        size = 2;
+        break;
+    case EcsI32:
+        key = EcsQuerySortKeySigned;
+        compare = flecs_query_cache_compare_int32_t;
+        size = 4;
+        break;
+    case EcsI64:
+        key = EcsQuerySortKeySigned;
+        compare = flecs_query_cache_compare_int64_t;
+        size = 8;
+        break;
+    case EcsIPtr:
+        key = EcsQuerySortKeySigned;
+        size = ECS_SIZEOF(intptr_t);
+        compare = size == 8 ? flecs_query_cache_compare_int64_t
+                            : flecs_query_cache_compare_int32_t;
+        break;
+    case EcsF32:
+        key = EcsQuerySortKeyFloat;
+        compare = flecs_query_cache_compare_float;
+        size = 4;
+        break;
+    case EcsF64:
+        key = EcsQuerySortKeyFloat;
+        compare = flecs_query_cache_compare_double;
+        size = 8;
+        break;
+    case EcsString:
+    default:
+        return NULL;
+    }
+
+    *order_by = component;
+    cache->order_by_offset = offset;
+    cache->order_by_key = flecs_ito(int8_t, key);
+    cache->order_by_key_size = flecs_ito(int8_t, size);
+    return compare;
+#else
+    (void)world;
+    (void)cache;
+    (void)order_by;
+    return NULL;
+#endif
+}
+
+/* LSD radix sort for order_by on primitive values. Sorts keys together with
+ * the rows they were read from, then moves the table rows into place. Passes
+ * for digits that are the same for all keys are skipped. Rows with equal keys 
+ * keep their order. */
+static
+void flecs_query_cache_radix_sort_table(
+    ecs_world_t *world,
+    ecs_query_cache_t *cache,
+    ecs_table_t *table,
+    const void *ptr,
+    ecs_size_t size,
+    int32_t count)
+{
+    ecs_query_sort_key_t kind = (ecs_query_sort_key_t)cache->order_by_key;
+    ecs_size_t key_size = cache->order_by_key_size;
+
+    uint64_t *keys = ecs_os_malloc_n(uint64_t, count);
+    uint64_t *keys_tmp = ecs_os_malloc_n(uint64_t, count);
+    int32_t *rows = ecs_os_malloc_n(int32_t, count);
+    int32_t *rows_tmp = ecs_os_malloc_n(int32_t, count);
+    uint64_t *k = keys, *k_out = keys_tmp;
+    int32_t *r = rows, *r_out = rows_tmp;
+
+    int32_t i, pass;
+    for (i = 0; i < count; i ++) {
+        keys[i] = flecs_query_cache_sort_key(
+            ECS_ELEM(ptr, size, i), kind, key_size);
+        rows[i] = i;
+    }
+
+    for (pass = 0; pass < key_size; pass ++) {
+        int32_t shift = pass * 8, hist[256] = {0};
+        for (i = 0; i < count; i ++) {
+            hist[(k[i] >> shift) & 0xFF] ++;
+        }
+
+        if (hist[(k[0] >> shift) & 0xFF] == count) {
+            continue; /* All keys have the same digit */
+        }
+
+        int32_t digit, offset = 0;
+        for (digit = 0; digit < 256; digit ++) {
+            int32_t digit_count = hist[digit];
+            hist[digit] = offset;
+            offset += digit_count;
+        }
+
+        for (i = 0; i < count; i ++) {
+            int32_t dst = hist[(k[i] >> shift) & 0xFF] ++;
+            k_out[dst] = k[i];
+            r_out[dst] = r[i];
+        }
+
+        uint64_t *k_swap = k; k = k_out; k_out = k_swap;
+        int32_t *r_swap = r; r = r_out; r_out = r_swap;
+    }
+
+    flecs_table_reorder(world, table, 0, count, r);
+
+    ecs_os_free(rows_tmp);
+    ecs_os_free(rows);
+    ecs_os_free(keys_tmp);
+    ecs_os_free(keys);
+}
+
 static
 void flecs_query_cache_sort_table(
     ecs_world_t *world,
+    ecs_query_cache_t *cache,
     ecs_table_t *table,
     int32_t column_index,
     ecs_order_by_action_t compare,
@@ -32,17 +289,264 @@ void flecs_query_cache_sort_table(
         ecs_column_t *column = &table->data.columns[column_index];
         ecs_type_info_t *ti = column->ti;
         size = ti->size;
-        ptr = column->data;
+        ptr = ECS_OFFSET(column->data, cache->order_by_offset);
     }
 
     if (sort) {
         sort(world, table, entities, ptr, size, 0, count - 1, compare);
+    } else if (ptr && cache->order_by_key && 
+        count >= FLECS_QUERY_RADIX_SORT_MIN) 
+    {
+        flecs_query_cache_radix_sort_table(
+            world, cache, table, ptr, size, count);
     } else {
         flecs_query_cache_sort_table_generic(
             world, table, entities, ptr, size, 0, count - 1, compare);
     }
 }
 
+/* Range of rows in a table that changed since the last sort */
+typedef struct sort_range_t {
+    int32_t start;
+    int32_t end;
+} sort_range_t;
+
+/* Merge sort for row indices. Rows that compare equal keep their order. */
+static
+void flecs_query_cache_sort_rows(
+    int32_t *rows,
+    int32_t *tmp,
+    int32_t count,
+    const ecs_entity_t *entities,
+    const void *ptr,
+    int32_t size,
+    ecs_order_by_action_t compare)
+{
+    int32_t width, i;
+    for (width = 1; width < count; width *= 2) {
+        for (i = 0; i < count; i += 2 * width) {
+            int32_t lo = i, mid = i + width, hi = i + 2 * width;
+            if (mid > count) {
+                mid = count;
+            }
+            if (hi > count) {
+                hi = count;
+            }
+
+            int32_t l = lo, r = mid, out = lo;
+            while (l < mid && r < hi) {
+                int32_t row_l = rows[l], row_r = rows[r];
+                if (compare(entities[row_r], ECS_ELEM(ptr, size, row_r), 
+                    entities[row_l], ECS_ELEM(ptr, size, row_l)) < 0) 
+                {
+                    tmp[out ++] = row_r;
+                    r ++;
+                } else {
+                    tmp[out ++] = row_l;
+                    l ++;
+                }
+            }
+            while (l < mid) {
+                tmp[out ++] = rows[l ++];
+            }
+            while (r < hi) {
+                tmp[out ++] = rows[r ++];
+            }
+        }
+
+        ecs_os_memcpy_n(rows, tmp, int32_t, count);
+    }
+}
+
+/* Get the table row of the n-th row that didn't change */
+static
+int32_t flecs_query_cache_clean_row(
+    const sort_range_t *ranges,
+    const int32_t *dirty_before,
+    int32_t range_count,
+    int32_t dirty_count,
+    int32_t rank)
+{
+    /* Find the first changed range that starts after the clean row */
+    int32_t lo = 0, hi = range_count;
+    while (lo < hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        if ((ranges[mid].start - dirty_before[mid]) > rank) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    if (lo == range_count) {
+        return rank + dirty_count;
+    }
+
+    return rank + dirty_before[lo];
+}
+
+/* Only re-sort the rows of a table that changed since the table was last
+ * sorted. The unchanged rows are still in order, so the changed rows are 
+ * sorted separately and merged into the unchanged rows. Only rows between the
+ * first and last moved row are reordered. Returns false if the table needs to
+ * be sorted entirely. */
+static
+bool flecs_query_cache_sort_table_changed(
+    ecs_world_t *world,
+    ecs_query_cache_t *cache,
+    ecs_query_cache_match_t *qm,
+    int32_t column_index,
+    ecs_order_by_action_t compare)
+{
+    ecs_table_t *table = qm->base.table;
+    int32_t count = ecs_table_count(table);
+    if (count < 2 || column_index == -1) {
+        return false;
+    }
+
+    if (qm->wildcard_matches) {
+        return false;
+    }
+
+    int32_t sort_state = qm->_sort_state[1];
+
+    /* Collect ranges of chunks that changed since the table was sorted */
+    int32_t chunk, chunk_count = ((count - 1) >> FLECS_CHANGE_CHUNK_BITS) + 1;
+    int32_t range_size = (chunk_count + 1) / 2;
+    sort_range_t *ranges = ecs_os_malloc_n(sort_range_t, range_size);
+    int32_t range_count = 0, dirty_count = 0;
+    bool result = false;
+
+    for (chunk = 0; chunk < chunk_count; chunk ++) {
+        int32_t state = flecs_table_get_chunk_dirty_state(
+            table, column_index + 1, chunk);
+        if ((int32_t)((uint32_t)state - (uint32_t)sort_state) <= 0) {
+            continue;
+        }
+
+        int32_t start = chunk << FLECS_CHANGE_CHUNK_BITS;
+        int32_t end = (chunk + 1) << FLECS_CHANGE_CHUNK_BITS;
+        if (end > count) {
+            end = count;
+        }
+
+        if (range_count && ranges[range_count - 1].end == start) {
+            ranges[range_count - 1].end = end;
+        } else {
+            ranges[range_count].start = start;
+            ranges[range_count].end = end;
+            range_count ++;
+        }
+
+        dirty_count += end - start;
+    }
+
+    if (!dirty_count) {
+        /* Values changed, but not since the table was last sorted */
+        result = true;
+        goto done_ranges;
+    }
+
+    if (dirty_count > (count >> 2)) {
+        /* Too many changes, sorting the table is cheaper */
+        goto done_ranges;
+    }
+
+    ecs_column_t *column = &table->data.columns[column_index];
+    int32_t size = column->ti->size;
+    const void *ptr = ECS_OFFSET(column->data, cache->order_by_offset);
+    const ecs_entity_t *entities = table->data.entities;
+
+    /* Sort changed rows. Storage order isn't changed until the final 
+     * position of each row is known. */
+    int32_t *rows = ecs_os_malloc_n(int32_t, dirty_count);
+    int32_t *tmp = ecs_os_malloc_n(int32_t, dirty_count);
+    int32_t *dirty_before = ecs_os_malloc_n(int32_t, range_count);
+    int32_t i, j, m = 0;
+    for (i = 0; i < range_count; i ++) {
+        dirty_before[i] = m;
+        for (j = ranges[i].start; j < ranges[i].end; j ++) {
+            rows[m ++] = j;
+        }
+    }
+
+    flecs_query_cache_sort_rows(
+        rows, tmp, dirty_count, entities, ptr, size, compare);
+
+    /* Find the final position of each changed row by counting the unchanged
+     * rows that come before it. Because changed rows are sorted, the search
+     * for the next row can start where the previous one ended. */
+    int32_t *pos = tmp;
+    int32_t clean_count = count - dirty_count, lo = 0;
+    bool moved = false;
+    for (m = 0; m < dirty_count; m ++) {
+        int32_t row = rows[m];
+        ecs_entity_t e = entities[row];
+        const void *value = ECS_ELEM(ptr, size, row);
+        int32_t hi = clean_count;
+        while (lo < hi) {
+            int32_t mid = lo + (hi - lo) / 2;
+            int32_t clean = flecs_query_cache_clean_row(
+                ranges, dirty_before, range_count, dirty_count, mid);
+            if (compare(entities[clean], ECS_ELEM(ptr, size, clean),
+                e, value) <= 0)
+            {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+
+        pos[m] = m + lo;
+        if (pos[m] != row) {
+            moved = true;
+        }
+    }
+
+    if (moved) {
+        /* Only rows between the first and last changed row or position can
+         * move. Build the permutation for that window and apply it. */
+        int32_t first = ranges[0].start, last = ranges[range_count - 1].end - 1;
+        if (pos[0] < first) {
+            first = pos[0];
+        }
+        if (pos[dirty_count - 1] > last) {
+            last = pos[dirty_count - 1];
+        }
+
+        int32_t p, window = last - first + 1;
+        int32_t *src = ecs_os_malloc_n(int32_t, window);
+        int32_t clean = first, r = 0;
+        for (p = first, m = 0; p <= last; p ++) {
+            if (m < dirty_count && pos[m] == p) {
+                src[p - first] = rows[m ++];
+                continue;
+            }
+
+            while (r < range_count && clean >= ranges[r].start) {
+                if (clean < ranges[r].end) {
+                    clean = ranges[r].end;
+                }
+                r ++;
+            }
+
+            src[p - first] = clean ++;
+        }
+
+        flecs_table_reorder(world, table, first, window, src);
+
+        ecs_os_free(src);
+    }
+
+    ecs_os_free(dirty_before);
+    ecs_os_free(tmp);
+    ecs_os_free(rows);
+    result = true;
+done_ranges:
+    ecs_os_free(ranges);
+    return result;
+}
+
 /* Helper struct for building sorted table ranges */
 typedef struct sort_helper_t {
     ecs_query_cache_match_t *match;
@@ -79,15 +583,82 @@ ecs_entity_t e_from_helper(
     }
 }
 
+/* Does row of table come before the first row of the next table */
+static
+bool flecs_query_cache_row_precedes(
+    sort_helper_t *helper,
+    int32_t row,
+    sort_helper_t *next,
+    bool before_next,
+    ecs_order_by_action_t compare)
+{
+    int32_t cur_row = helper->row;
+    helper->row = row;
+    int32_t cmp = compare(e_from_helper(helper), ptr_from_helper(helper),
+        e_from_helper(next), ptr_from_helper(next));
+    helper->row = cur_row;
+    return cmp < 0 || (cmp == 0 && before_next);
+}
+
+/* Find end of the run of rows in a table that come before the first row of
+ * the next table. The rows of owned columns are sorted, which allows for an
+ * exponential search. Rows of shared columns aren't sorted and are scanned. */
+static
+int32_t flecs_query_cache_run_end(
+    sort_helper_t *helper,
+    sort_helper_t *next,
+    bool before_next,
+    ecs_order_by_action_t compare)
+{
+    int32_t row = helper->row + 1, count = helper->count;
+    if (helper->shared) {
+        while (row < count && flecs_query_cache_row_precedes(
+            helper, row, next, before_next, compare))
+        {
+            row ++;
+        }
+        return row;
+    }
+
+    /* First row is known to come before the next table */
+    int32_t lo = helper->row, hi = row, step = 1;
+    while (hi < count && flecs_query_cache_row_precedes(
+        helper, hi, next, before_next, compare))
+    {
+        lo = hi;
+        step *= 2;
+        hi = helper->row + step;
+    }
+
+    if (hi > count) {
+        hi = count;
+    }
+
+    /* lo comes before the next table, hi doesn't (or is the end) */
+    while (hi - lo > 1) {
+        int32_t mid = lo + (hi - lo) / 2;
+        if (flecs_query_cache_row_precedes(
+            helper, mid, next, before_next, compare))
+        {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return hi;
+}
+
+/* Merge the sorted tables of a group into slices. Can run on any thread, as it
+ * only reads from the world and writes to the slices vector. */
 static
 void flecs_query_cache_build_sorted_table_range(
     ecs_query_cache_t *cache,
-    ecs_query_cache_group_t *group)
+    ecs_query_cache_group_t *group,
+    ecs_vec_t *slices)
 {
     ecs_world_t *world = cache->query->world;
     flecs_poly_assert(world, ecs_world_t);
-    ecs_assert(!(world->flags & EcsWorldMultiThreaded), ECS_UNSUPPORTED,
-        "cannot sort query in multithreaded mode");
 
     ecs_entity_t id = cache->order_by;
     ecs_order_by_action_t compare = cache->order_by_callback;
@@ -96,12 +667,11 @@ void flecs_query_cache_build_sorted_table_range(
         return;
     }
 
-    ecs_vec_init_if_t(&cache->table_slices, ecs_query_cache_match_t);
+    ecs_vec_init_if_t(slices, ecs_query_cache_match_t);
     int32_t to_sort = 0;
     int32_t order_by_term = cache->order_by_term;
 
-    sort_helper_t *helper = flecs_alloc_n(
-        &world->allocator, sort_helper_t, table_count);
+    sort_helper_t *helper = ecs_os_malloc_n(sort_helper_t, table_count);
     for (i = 0; i < table_count; i ++) {
         ecs_query_cache_match_t *qm = 
             ecs_vec_get_t(&group->tables, ecs_query_cache_match_t, i);
@@ -120,7 +690,8 @@ void flecs_query_cache_build_sorted_table_range(
                 int32_t column_index = qm->base.columns[field];
                 ecs_assert(column_index >= 0, ECS_INTERNAL_ERROR, NULL);
                 ecs_column_t *column = &table->data.columns[column_index];
-                helper[to_sort].ptr = column->data;
+                helper[to_sort].ptr = ECS_OFFSET(
+                    column->data, cache->order_by_offset);
                 helper[to_sort].elem_size = size;
                 helper[to_sort].shared = false;
             } else {
@@ -137,8 +708,9 @@ void flecs_query_cache_build_sorted_table_range(
                     }
                 }
 
-                helper[to_sort].ptr = ecs_table_get_id(
-                    world, r->table, id, ECS_RECORD_TO_ROW(r->row));
+                helper[to_sort].ptr = ECS_OFFSET(ecs_table_get_id(
+                    world, r->table, id, ECS_RECORD_TO_ROW(r->row)),
+                        cache->order_by_offset);
                 helper[to_sort].elem_size = size;
                 helper[to_sort].shared = true;
             }
@@ -163,87 +735,166 @@ void flecs_query_cache_build_sorted_table_range(
 
     ecs_query_cache_match_t *cur = NULL;
 
-    bool proceed;
     do {
-        int32_t j, min = 0;
-        proceed = true;
-
-        ecs_entity_t e1;
-        while (!(e1 = e_from_helper(&helper[min]))) {
-            min ++;
-            if (min == to_sort) {
-                proceed = false;
-                break;
-            }
-        }
-
-        if (!proceed) {
-            break;
-        }
+        int32_t j, min = -1, next = -1;
 
-        for (j = min + 1; j < to_sort; j++) {
-            ecs_entity_t e2 = e_from_helper(&helper[j]);
-            if (!e2) {
+        /* Find the table with the first row, and the table with the row that
+         * comes after it. Ties are resolved in favor of the earlier table. */
+        for (j = 0; j < to_sort; j ++) {
+            if (!e_from_helper(&helper[j])) {
                 continue;
             }
 
-            const void *ptr1 = ptr_from_helper(&helper[min]);
-            const void *ptr2 = ptr_from_helper(&helper[j]);
+            if (min == -1) {
+                min = j;
+                continue;
+            }
 
-            if (compare(e1, ptr1, e2, ptr2) > 0) {
+            if (compare(e_from_helper(&helper[min]), ptr_from_helper(&helper[min]),
+                e_from_helper(&helper[j]), ptr_from_helper(&helper[j])) > 0)
+            {
+                next = min;
                 min = j;
-                e1 = e_from_helper(&helper[min]);
+            } else if (next == -1 || compare(
+                e_from_helper(&helper[next]), ptr_from_helper(&helper[next]),
+                e_from_helper(&helper[j]), ptr_from_helper(&helper[j])) > 0)
+            {
+                next = j;
             }
         }
 
+        if (min == -1) {
+            break;
+        }
+
+        /* Rows of a table are sorted, so the table with the first row can
+         * emit all rows that come before the first row of the next table as a
+         * single slice. */
         sort_helper_t *cur_helper = &helper[min];
+        int32_t row = cur_helper->row, end = cur_helper->count;
+        if (next != -1) {
+            end = flecs_query_cache_run_end(
+                cur_helper, &helper[next], min < next, compare);
+        }
+
         if (!cur || cur->base.columns != cur_helper->match->base.columns) {
-            cur = ecs_vec_append_t(NULL, &cache->table_slices, 
-                ecs_query_cache_match_t);
+            cur = ecs_vec_append_t(NULL, slices, ecs_query_cache_match_t);
             *cur = *(cur_helper->match);
-            cur->_offset = cur_helper->row;
-            cur->_count = 1;
+            cur->_offset = row;
+            cur->_count = end - row;
         } else {
-            cur->_count ++;
+            cur->_count += end - row;
         }
 
-        cur_helper->row ++;
-    } while (proceed);
+        cur_helper->row = end;
+    } while (true);
 
 done:
-    flecs_free_n(&world->allocator, sort_helper_t, table_count, helper);
+    ecs_os_free(helper);
 }
 
-void flecs_query_cache_build_sorted_tables(
+/* Claim the next job. Jobs are claimed atomically if multiple threads run the
+ * same phase. */
+static
+int32_t flecs_query_cache_claim_job(
+    int32_t *next,
+    int32_t stage_count)
+{
+    if (stage_count > 1) {
+        return ecs_os_ainc(next) - 1;
+    }
+    return (*next) ++;
+}
+
+/* Prepare a merge job for each group */
+static
+void flecs_query_cache_prepare_merge(
+    ecs_world_t *world,
     ecs_query_cache_t *cache)
 {
-    ecs_vec_clear(&cache->table_slices);
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_init_if_t(&cache->merge_jobs, ecs_query_cache_merge_job_t);
 
-    /* Sort tables in group order */
+    int32_t count = 0;
     ecs_query_cache_group_t *cur = cache->first_group;
     do {
-        flecs_query_cache_build_sorted_table_range(cache, cur);
+        ecs_query_cache_merge_job_t *job;
+        if (count < ecs_vec_count(&cache->merge_jobs)) {
+            job = ecs_vec_get_t(
+                &cache->merge_jobs, ecs_query_cache_merge_job_t, count);
+        } else {
+            job = ecs_vec_append_t(
+                a, &cache->merge_jobs, ecs_query_cache_merge_job_t);
+            ecs_vec_init_t(NULL, &job->slices, ecs_query_cache_match_t, 0);
+        }
+
+        job->group = cur;
+        ecs_vec_clear(&job->slices);
+        count ++;
     } while ((cur = cur->next));
+
+    cache->merge_job_count = count;
+    cache->merge_job_next = 0;
 }
 
-void flecs_query_cache_sort_tables(
+/* Sort a table and store the dirty state the table was sorted for */
+static
+void flecs_query_cache_sort_job(
     ecs_world_t *world,
-    ecs_query_impl_t *impl)
+    ecs_query_cache_t *cache,
+    ecs_query_cache_sort_job_t *job)
 {
-    ecs_query_cache_t *cache = impl->cache;
+    ecs_query_cache_match_t *qm = job->match;
+    ecs_table_t *table = qm->base.table;
+    int32_t column = job->column;
     ecs_order_by_action_t compare = cache->order_by_callback;
-    if (!compare) {
-        return;
+
+    /* If only values changed, only the changed rows are sorted and merged back
+     * in. Prefers using flecs_query_cache_sort_table when available */
+    if (job->structural || !flecs_query_cache_sort_table_changed(
+        world, cache, qm, column, compare))
+    {
+        flecs_query_cache_sort_table(world, cache, table, column, compare, 
+            cache->order_by_table_callback);
+    }
+
+    /* Dirty state was created by prepare, so it's safe to access here */
+    int32_t *dirty_state = table->dirty_state;
+    ecs_assert(dirty_state != NULL, ECS_INTERNAL_ERROR, NULL);
+    qm->_sort_state[0] = dirty_state[0];
+    if (column != -1) {
+        qm->_sort_state[1] = dirty_state[column + 1];
+    }
+}
+
+void flecs_query_cache_build_sorted_tables(
+    ecs_query_cache_t *cache)
+{
+    flecs_query_cache_prepare_merge(cache->query->world, cache);
+    flecs_query_cache_merge_run(cache, 1);
+    flecs_query_cache_sort_finish(cache);
+}
+
+bool flecs_query_cache_sort_prepare(
+    ecs_world_t *world,
+    ecs_query_cache_t *cache)
+{
+    if (!cache->order_by_callback) {
+        return false;
     }
 
-    ecs_sort_table_action_t sort = cache->order_by_table_callback;
     ecs_entity_t order_by = cache->order_by;
-    int32_t order_by_term = cache->order_by_term;
     ecs_component_record_t *cr = flecs_components_get(world, order_by);
+    ecs_allocator_t *a = &world->allocator;
 
-    /* Iterate over non-empty tables. Don't bother with empty tables as they
-     * have nothing to sort */
+    ecs_vec_init_if_t(&cache->sort_jobs, ecs_query_cache_sort_job_t);
+    ecs_vec_clear(&cache->sort_jobs);
+    cache->sort_job_next = 0;
+    cache->merge_job_count = 0;
 
+    /* Only tables that changed since they were last sorted need sorting. The
+     * state is tracked separately from the query monitors, so that a query 
+     * that was sorted before it is iterated isn't sorted again. */
     bool tables_sorted = false;
 
     ecs_query_cache_group_t *cur = cache->first_group;
@@ -253,65 +904,143 @@ void flecs_query_cache_sort_tables(
             ecs_query_cache_match_t *qm = 
                 ecs_vec_get_t(&cur->tables, ecs_query_cache_match_t, i);
             ecs_table_t *table = qm->base.table;
-            bool dirty = false;
+            int32_t *dirty_state = flecs_table_get_dirty_state(world, table);
+            bool structural = qm->_sort_state[0] != dirty_state[0];
+            bool dirty = structural;
 
-            if (flecs_query_check_table_monitor(impl, qm, 0)) {
+            if (structural) {
                 tables_sorted = true;
-                dirty = true;
-
-                if (!ecs_table_count(table)) {
-                    /* If table is empty, there's a chance the query won't 
-                     * iterate it so update the match monitor here. */
-                    flecs_query_sync_match_monitor(impl, qm);
-
-                    ecs_vec_t *matches = qm->wildcard_matches;
-                    if (matches) {
-                        int32_t j, qms_count = ecs_vec_count(matches);
-                        ecs_query_cache_match_t *qms = ecs_vec_first(matches);
-                        for (j = 0; j < qms_count; j ++) {
-                            flecs_query_sync_match_monitor(impl, &qms[j]);
-                        }
-                    }
-                }
             }
 
             int32_t column = -1;
             if (order_by) {
-                if (flecs_query_check_table_monitor(
-                    impl, qm, order_by_term + 1)) 
-                {
-                    dirty = true;
+                const ecs_table_record_t *tr = flecs_component_get_table(
+                    cr, table);
+                if (tr) {
+                    column = tr->column;
                 }
 
-                if (dirty) {
-                    column = -1;
-
-                    const ecs_table_record_t *tr = flecs_component_get_table(
-                        cr, table);
-                    if (tr) {
-                        column = tr->column;
-                    }
-
-                    if (column == -1) {
-                        /* Component is shared, no sorting is needed */
-                        dirty = false;
-                    }
+                if (column == -1) {
+                    /* Component is shared, no sorting is needed */
+                    dirty = false;
+                } else if (qm->_sort_state[1] != dirty_state[column + 1]) {
+                    dirty = true;
                 }
             }
 
             if (!dirty) {
+                qm->_sort_state[0] = dirty_state[0];
                 continue;
             }
 
-            /* Something has changed, sort the table. Prefers using 
-            * flecs_query_cache_sort_table when available */
-            flecs_query_cache_sort_table(world, table, column, compare, sort);
+            /* Something has changed, sort the table */
+            ecs_query_cache_sort_job_t *job = ecs_vec_append_t(
+                a, &cache->sort_jobs, ecs_query_cache_sort_job_t);
+            job->match = qm;
+            job->column = column;
+            job->structural = structural;
             tables_sorted = true;
         }
     } while ((cur = cur->next)); /* Next group */
 
-    if (tables_sorted || cache->match_count != cache->prev_match_count) {
-        flecs_query_cache_build_sorted_tables(cache);
-        cache->match_count ++; /* Increase version if tables changed */
+    if (tables_sorted || cache->match_count != cache->sort_match_count) {
+        flecs_query_cache_prepare_merge(world, cache);
+        return true;
     }
+
+    return false;
+}
+
+void flecs_query_cache_sort_run(
+    ecs_world_t *world,
+    ecs_query_cache_t *cache,
+    int32_t stage_count)
+{
+    int32_t count = ecs_vec_count(&cache->sort_jobs);
+    ecs_query_cache_sort_job_t *jobs = ecs_vec_first_t(
+        &cache->sort_jobs, ecs_query_cache_sort_job_t);
+
+    do {
+        int32_t i = flecs_query_cache_claim_job(
+            &cache->sort_job_next, stage_count);
+        if (i >= count) {
+            break;
+        }
+
+        flecs_query_cache_sort_job(world, cache, &jobs[i]);
+    } while (true);
+}
+
+void flecs_query_cache_merge_run(
+    ecs_query_cache_t *cache,
+    int32_t stage_count)
+{
+    int32_t count = cache->merge_job_count;
+    ecs_query_cache_merge_job_t *jobs = ecs_vec_first_t(
+        &cache->merge_jobs, ecs_query_cache_merge_job_t);
+
+    do {
+        int32_t i = flecs_query_cache_claim_job(
+            &cache->merge_job_next, stage_count);
+        if (i >= count) {
+            break;
+        }
+
+        flecs_query_cache_build_sorted_table_range(
+            cache, jobs[i].group, &jobs[i].slices);
+    } while (true);
+}
+
+void flecs_query_cache_sort_finish(
+    ecs_query_cache_t *cache)
+{
+    int32_t i, count = cache->merge_job_count;
+    if (!count) {
+        return;
+    }
+
+    ecs_query_cache_merge_job_t *jobs = ecs_vec_first_t(
+        &cache->merge_jobs, ecs_query_cache_merge_job_t);
+
+    if (count == 1) {
+        /* Only one group, use its slices as the slices of the cache */
+        ecs_vec_t tmp = cache->table_slices;
+        cache->table_slices = jobs[0].slices;
+        jobs[0].slices = tmp;
+    } else {
+        /* Concatenate the slices of groups in group order */
+        ecs_vec_clear(&cache->table_slices);
+        for (i = 0; i < count; i ++) {
+            int32_t slice_count = ecs_vec_count(&jobs[i].slices);
+            if (!slice_count) {
+                continue;
+            }
+
+            ecs_query_cache_match_t *dst = ecs_vec_grow_t(NULL, 
+                &cache->table_slices, ecs_query_cache_match_t, slice_count);
+            ecs_os_memcpy_n(dst, ecs_vec_first(&jobs[i].slices),
+                ecs_query_cache_match_t, slice_count);
+        }
+    }
+
+    cache->merge_job_count = 0;
+    cache->match_count ++; /* Increase version if tables changed */
+    cache->sort_match_count = cache->match_count;
+}
+
+void flecs_query_cache_sort_tables(
+    ecs_world_t *world,
+    ecs_query_impl_t *impl)
+{
+    ecs_query_cache_t *cache = impl->cache;
+    if (!flecs_query_cache_sort_prepare(world, cache)) {
+        return;
+    }
+
+    ecs_assert(!(world->flags & EcsWorldMultiThreaded), ECS_UNSUPPORTED,
+        "cannot sort query in multithreaded mode");
+
+    flecs_query_cache_sort_run(world, cache, 1);
+    flecs_query_cache_merge_run(cache, 1);
+    flecs_query_cache_sort_finish(cache);
 }
@@ -552,6 +552,90 @@ int32_t flecs_query_term_next_known(
     return -1;
 }
 
+/* Get the cost of using a term to find the tables for $this, which is the 
+ * number of tables the term matches. Returns -1 if the term can't be used to 
+ * start evaluating the query. */
+static
+int32_t flecs_query_term_this_cost(
+    ecs_world_t *world,
+    ecs_query_impl_t *query,
+    ecs_term_t *term)
+{
+    ecs_query_t *q = &query->pub;
+
+    if (term->oper != EcsAnd || flecs_term_is_or(q, term)) {
+        return -1;
+    }
+
+    if (term->flags_ & (EcsTermIsScope|EcsTermIsMember|EcsTermIsToggle|
+        EcsTermIsSparse|EcsTermDontFragment|EcsTermNonFragmentingChildOf|
+        EcsTermMatchAny|EcsTermMatchAnySrc|EcsTermTransitive|EcsTermReflexive|
+        EcsTermIdInherited)) 
+    {
+        return -1;
+    }
+
+    if (!(term->src.id & EcsIsVariable) || 
+        (ECS_TERM_REF_ID(&term->src) != EcsThis)) 
+    {
+        return -1;
+    }
+
+    if ((term->src.id & EcsTraverseFlags) != EcsSelf) {
+        return -1;
+    }
+
+    if (ecs_id_is_wildcard(term->id)) {
+        return -1;
+    }
+
+    ecs_component_record_t *cr = flecs_components_get(world, term->id);
+    if (!cr) {
+        return 0;
+    }
+
+    if (cr->flags & (EcsIdSparse|EcsIdDontFragment)) {
+        return -1;
+    }
+
+    return cr->cache.tables.count;
+}
+
+/* Find the most selective term to start evaluating the query from. If a query
+ * has multiple terms that can find the tables for $this, starting from the term
+ * with the fewest tables reduces the number of tables that have to be tested
+ * against the remaining terms. */
+static
+int32_t flecs_query_term_most_selective(
+    ecs_world_t *world,
+    ecs_query_impl_t *query, 
+    int32_t offset,
+    ecs_flags64_t compiled) 
+{
+    ecs_query_t *q = &query->pub;
+    ecs_term_t *terms = q->terms;
+    int32_t i, count = q->term_count, result = offset;
+
+    int32_t min_cost = flecs_query_term_this_cost(world, query, &terms[offset]);
+    if (min_cost <= 0) {
+        return offset;
+    }
+
+    for (i = offset + 1; i < count; i ++) {
+        if (compiled & (1ull << i)) {
+            continue;
+        }
+
+        int32_t cost = flecs_query_term_this_cost(world, query, &terms[i]);
+        if (cost != -1 && cost < min_cost) {
+            min_cost = cost;
+            result = i;
+        }
+    }
+
+    return result;
+}
+
 /* If the first part of a query contains more than one trivial term, insert a
  * special instruction which batch-evaluates multiple terms. */
 static
@@ -1013,6 +1097,18 @@ int flecs_query_compile(
                 can_reorder = false;
             }
 
+            /* If no variables have been written yet, start from the term that
+             * matches the fewest tables. */
+            if (can_reorder && !ctx.written) {
+                int32_t term_index = flecs_query_term_most_selective(
+                    q->real_world, query, i, compiled);
+                if (term_index != i) {
+                    term = &q->terms[term_index];
+                    compile = term_index;
+                    i --; /* Repeat current term */
+                }
+            }
+
             /* If variables have been written, but this term has no known variables,
              * first try to resolve terms that have known variables. This can 
              * significantly reduce the search space. 
@@ -1552,6 +1552,30 @@ bool flecs_query_end(
     return !redo;
 }
 
+static
+bool flecs_query_partition(
+    const ecs_query_op_t *op,
+    bool redo,
+    ecs_query_run_ctx_t *ctx)
+{
+    /* Replaces the driver operation in the plan copy of a partitioned iterator.
+     * Results of the driver are dealt round-robin across partitions, so that
+     * the remaining operations only run for the results of this partition. */
+    ecs_query_iter_t *qit = ctx->qit;
+    ecs_query_op_t driver = *op;
+    driver.kind = qit->partition_kind;
+
+    do {
+        if (!flecs_query_dispatch(&driver, redo, ctx)) {
+            return false;
+        }
+        redo = true;
+    } while ((qit->partition_cur ++ % qit->partition_count) != 
+        qit->partition_index);
+
+    return true;
+}
+
 static
 bool flecs_query_dispatch(
     const ecs_query_op_t *op,
@@ -1621,6 +1645,7 @@ bool flecs_query_dispatch(
     case EcsQuerySetId: return flecs_query_setid(op, redo, ctx);
     case EcsQueryContain: return flecs_query_contain(op, redo, ctx);
     case EcsQueryPairEq: return flecs_query_pair_eq(op, redo, ctx);
+    case EcsQueryPartition: return flecs_query_partition(op, redo, ctx);
     case EcsQueryYield: return false;
     case EcsQueryNothing: return false;
     }
@@ -180,36 +180,14 @@ void flecs_iter_assert_columns(
 }
 #endif
 
-bool ecs_query_next(
-    ecs_iter_t *it)
+static
+bool flecs_query_next_result(
+    ecs_iter_t *it,
+    ecs_query_iter_t *qit,
+    ecs_query_impl_t *impl,
+    ecs_query_run_ctx_t *ctx,
+    bool redo)
 {
-    ecs_assert(it != NULL, ECS_INVALID_PARAMETER, NULL);
-    ecs_assert(it->next == ecs_query_next || 
-        it->next == flecs_query_trivial_cached_next ||
-        it->next == flecs_default_next_callback,
-            ECS_INVALID_PARAMETER, NULL);
-
-    ecs_query_iter_t *qit = &it->priv_.iter.query;
-    ecs_query_impl_t *impl = ECS_CONST_CAST(ecs_query_impl_t*, it->query);
-    ecs_assert(impl != NULL, ECS_INVALID_OPERATION, 
-        "cannot call ecs_query_next on invalid iterator");
-
-    ecs_query_run_ctx_t ctx;
-    flecs_query_iter_run_ctx_init(it, &ctx);
-
-    bool redo = it->flags & EcsIterIsValid;
-    if (redo) {
-        if (it->flags & EcsIterTrivialChangeDetection) {
-            flecs_query_self_change_detection(it, qit, impl);
-        } else {
-            flecs_query_change_detection(it, qit, impl);
-        }
-    }
-
-    it->flags &= ~(EcsIterSkip);
-    it->flags |= EcsIterIsValid;
-    it->frame_offset += it->count;
-
     /* Specialized iterator modes. When a query doesn't use any advanced 
      * features, it can call specialized iterator functions directly instead of
      * going through the dispatcher of the query engine. 
@@ -223,11 +201,11 @@ bool ecs_query_next(
         ecs_assert(impl->ops == NULL, ECS_INTERNAL_ERROR, NULL);
 
         if (it->flags & EcsIterTrivialSearch) {
-            if (flecs_query_is_trivial_cache_search(&ctx)) {
+            if (flecs_query_is_trivial_cache_search(ctx)) {
                 return true;
             }
         } else if (it->flags & EcsIterTrivialTest) {
-            if (flecs_query_is_trivial_cache_test(&ctx, redo)) {
+            if (flecs_query_is_trivial_cache_test(ctx, redo)) {
                 return true;
             }
         }
@@ -235,13 +213,13 @@ bool ecs_query_next(
         /* Cached iterator modes */
         if (it->flags & EcsIterTrivialSearch) {
             ecs_assert(impl->ops == NULL, ECS_INTERNAL_ERROR, NULL);
-            if (flecs_query_is_cache_search(&ctx)) {
+            if (flecs_query_is_cache_search(ctx)) {
                 goto trivial_search_yield;
             }
         } else if (it->flags & EcsIterTrivialTest) {
             ecs_assert(impl->ops == NULL, ECS_INTERNAL_ERROR, NULL);
-            if (flecs_query_is_cache_test(&ctx, redo)) {
-                goto yield;
+            if (flecs_query_is_cache_test(ctx, redo)) {
+                return true;
             }
         }
     } else {
@@ -249,38 +227,94 @@ bool ecs_query_next(
         if (it->flags & EcsIterTrivialSearch) {
             ecs_assert(impl->ops == NULL, ECS_INTERNAL_ERROR, NULL);
 
-            ecs_query_trivial_ctx_t *op_ctx = &ctx.op_ctx[0].is.trivial;
-            if (flecs_query_is_trivial_search(&ctx, op_ctx, redo)) {
-                goto yield;
+            ecs_query_trivial_ctx_t *op_ctx = &ctx->op_ctx[0].is.trivial;
+            if (flecs_query_is_trivial_search(ctx, op_ctx, redo)) {
+                return true;
             }
         } else if (it->flags & EcsIterTrivialTest) {
             ecs_assert(impl->ops == NULL, ECS_INTERNAL_ERROR, NULL);
 
-            int32_t fields = ctx.query->pub.term_count;
+            int32_t fields = ctx->query->pub.term_count;
             ecs_flags64_t mask = (2llu << (fields - 1)) - 1;
-            if (flecs_query_trivial_test(&ctx, redo, mask)) {
-                goto yield;
+            if (flecs_query_trivial_test(ctx, redo, mask)) {
+                return true;
             }
         } else {
             const ecs_query_op_t *ops = qit->ops;
 
             /* Default iterator mode. This enters the query VM dispatch loop. */
             if (flecs_query_run_until(
-                redo, &ctx, ops, -1, qit->op, impl->op_count - 1))
+                redo, ctx, ops, -1, qit->op, impl->op_count - 1))
             {
-                ecs_assert(ops[ctx.op_index].kind == EcsQueryYield,
+                ecs_assert(ops[ctx->op_index].kind == EcsQueryYield,
                     ECS_INTERNAL_ERROR, NULL);
-                flecs_query_set_iter_this(it, &ctx);
+                flecs_query_set_iter_this(it, ctx);
                 ecs_assert(it->count >= 0, ECS_INTERNAL_ERROR, NULL);
-                qit->op = flecs_itolbl(ctx.op_index - 1);
+                qit->op = flecs_itolbl(ctx->op_index - 1);
 #ifdef FLECS_DEBUG
                 flecs_iter_assert_columns(it);
 #endif
-                goto yield;
+                return true;
             }
         }
     }
 
+    return false;
+
+trivial_search_yield:
+    it->table = ctx->vars[0].range.table;
+    it->count = ecs_table_count(it->table);
+    it->entities = ecs_table_entities(it->table);
+    return true;
+}
+
+bool ecs_query_next(
+    ecs_iter_t *it)
+{
+    ecs_assert(it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_assert(it->next == ecs_query_next || 
+        it->next == flecs_query_trivial_cached_next ||
+        it->next == flecs_default_next_callback,
+            ECS_INVALID_PARAMETER, NULL);
+
+    ecs_query_iter_t *qit = &it->priv_.iter.query;
+    ecs_query_impl_t *impl = ECS_CONST_CAST(ecs_query_impl_t*, it->query);
+    ecs_assert(impl != NULL, ECS_INVALID_OPERATION, 
+        "cannot call ecs_query_next on invalid iterator");
+
+    ecs_query_run_ctx_t ctx;
+    flecs_query_iter_run_ctx_init(it, &ctx);
+
+    bool redo = it->flags & EcsIterIsValid;
+    if (redo) {
+        if (it->flags & EcsIterTrivialChangeDetection) {
+            flecs_query_self_change_detection(it, qit, impl);
+        } else {
+            flecs_query_change_detection(it, qit, impl);
+        }
+    }
+
+    it->flags &= ~(EcsIterSkip);
+    it->flags |= EcsIterIsValid;
+    it->frame_offset += it->count;
+
+    bool result = flecs_query_next_result(it, qit, impl, &ctx, redo);
+
+    if (qit->partition_count > 1 && qit->partition_op == -1) {
+        /* Partitioned iterator without a driver operation in its plan. Skip
+         * results that belong to other partitions. */
+        while (result && ((qit->partition_cur ++ % qit->partition_count) != 
+            qit->partition_index))
+        {
+            it->frame_offset += it->count;
+            result = flecs_query_next_result(it, qit, impl, &ctx, true);
+        }
+    }
+
+    if (result) {
+        return true;
+    }
+
     /* Done iterating */
     flecs_query_mark_fixed_fields_dirty(impl, it);
     if (ctx.query->monitor) {
@@ -293,14 +327,6 @@ bool ecs_query_next(
     ecs_iter_fini(it);
     ecs_os_linc(&it->real_world->info.queries_ran_total);
     return false;
-
-trivial_search_yield:
-    it->table = ctx.vars[0].range.table;
-    it->count = ecs_table_count(it->table);
-    it->entities = ecs_table_entities(it->table);
-
-yield:
-    return true;
 }
 
 bool flecs_query_trivial_cached_next(
@@ -347,6 +373,9 @@ void flecs_query_op_ctx_fini(
     ecs_query_op_ctx_t *ctx)
 {
     switch(op->kind) {
+    case EcsQueryTriv:
+        flecs_query_trivial_ctx_fini(it, &ctx->is.trivial);
+        break;
     case EcsQueryTrav: {
         ecs_allocator_t *a = flecs_query_get_allocator(it);
         flecs_query_trav_cache_fini(a, &ctx->is.trav.cache);
@@ -376,6 +405,12 @@ void flecs_query_op_ctx_fini(
         }
         break;
     }
+    case EcsQueryMemberEq: {
+        ecs_allocator_t *a = flecs_query_get_allocator(it);
+        ecs_vec_fini_t(a, &ctx->is.membereq.index, 
+            ecs_query_member_index_elem_t);
+        break;
+    }
     default:
         break;
     }
@@ -423,6 +458,15 @@ void flecs_query_iter_fini(
 #endif
 
     flecs_query_iter_fini_ctx(it, qit);
+    if (!flecs_query_impl(q)->ops && qit->op_ctx) {
+        /* Trivial search iterators use the context of the first operation */
+        flecs_query_trivial_ctx_fini(it, &qit->op_ctx[0].is.trivial);
+    }
+    if (qit->ops != flecs_query_impl(q)->ops) {
+        /* Plan copy of partitioned iterator */
+        flecs_iter_free_n(ECS_CONST_CAST(ecs_query_op_t*, qit->ops),
+            ecs_query_op_t, op_count);
+    }
     flecs_iter_free_n(qit->vars, ecs_var_t, var_count);
     flecs_iter_free_n(qit->written, ecs_write_flags_t, op_count);
     flecs_iter_free_n(qit->op_ctx, ecs_query_op_ctx_t, op_count);
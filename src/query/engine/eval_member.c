@@ -5,6 +5,10 @@
 
 #include "../../private_api.h"
 
+#ifdef FLECS_META
+#include "../../addons/meta/meta.h"
+#endif
+
 static
 bool flecs_query_member_cmp(
     const ecs_query_op_t *op,
@@ -122,11 +126,205 @@ match:
     return true;
 }
 
+#ifdef FLECS_META
+static
+int flecs_query_member_index_elem_cmp(
+    const void *ptr_a,
+    const void *ptr_b)
+{
+    const ecs_query_member_index_elem_t *a = ptr_a;
+    const ecs_query_member_index_elem_t *b = ptr_b;
+    if (a->table_id != b->table_id) {
+        return (a->table_id > b->table_id) - (a->table_id < b->table_id);
+    }
+    return (a->row > b->row) - (a->row < b->row);
+}
+
+/* Load entities with member value from index, and group them by table. This 
+ * happens once per value for an iterator, after which the entities for a 
+ * table can be found without visiting the entities of other tables. */
+static
+void flecs_query_member_index_load(
+    ecs_query_membereq_ctx_t *op_ctx,
+    ecs_query_run_ctx_t *ctx,
+    ecs_entity_t member,
+    ecs_entity_t value)
+{
+    ecs_allocator_t *a = flecs_query_get_allocator(ctx->it);
+    ecs_vec_reset_t(a, &op_ctx->index, ecs_query_member_index_elem_t);
+
+    int32_t i, count;
+    const ecs_entity_t *entities = ecs_member_index_find(
+        ctx->world, member, value, &count);
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t e = entities[i];
+        ecs_record_t *r = flecs_entities_get(ctx->world, e);
+        if (!r || !r->table) {
+            continue;
+        }
+
+        ecs_query_member_index_elem_t *elem = ecs_vec_append_t(a, 
+            &op_ctx->index, ecs_query_member_index_elem_t);
+        elem->table_id = r->table->id;
+        elem->table = r->table;
+        elem->row = ECS_RECORD_TO_ROW(r->row);
+        elem->entity = e;
+    }
+
+    count = ecs_vec_count(&op_ctx->index);
+    qsort(ecs_vec_first(&op_ctx->index), flecs_itosize(count), 
+        sizeof(ecs_query_member_index_elem_t), 
+            flecs_query_member_index_elem_cmp);
+
+    op_ctx->index_value = value;
+    op_ctx->index_loaded = true;
+}
+
+/* Use member index to find entities in table with member value. Returns -1 if
+ * the member is not indexed, or if the index can't be used for the operation. */
+static
+int flecs_query_member_index_eq(
+    const ecs_query_op_t *op,
+    bool redo,
+    ecs_query_run_ctx_t *ctx)
+{
+    ecs_query_membereq_ctx_t *op_ctx = flecs_op_ctx(ctx, membereq);
+    ecs_iter_t *it = ctx->it;
+    int8_t field_index = op->field_index;
+    const ecs_term_t *term = &ctx->query->pub.terms[op->term_index];
+    ecs_entity_t member = ECS_TERM_REF_ID(&term->first);
+    ecs_entity_t second;
+
+    ecs_var_id_t table_var = flecs_itovar(op->other - 1);
+    ecs_table_range_t range = flecs_query_var_get_range(table_var, ctx);
+    ecs_table_t *table = range.table;
+
+    if (!redo) {
+        op_ctx->use_index = false;
+
+        if (op->flags & (EcsQueryIsVar << EcsQuerySecond)) {
+            uint64_t written = ctx->written[ctx->op_index];
+            if (!(written & (1ull << op->second.var))) {
+                return -1;
+            }
+        }
+
+        second = flecs_get_ref_entity(&op->second, 
+            flecs_query_ref_flags(op->flags, EcsQuerySecond), ctx);
+        if (second == EcsWildcard) {
+            return -1;
+        }
+
+        EcsMemberIndex *index = ECS_CONST_CAST(EcsMemberIndex*, 
+            ecs_get(ctx->world, member, EcsMemberIndex));
+        if (!index) {
+            return -1;
+        }
+
+        if (!table) {
+            return false;
+        }
+
+        /* Index rows written without OnSet. If that's not possible the table
+         * is evaluated without the index. */
+        int synced = flecs_member_index_sync_table(
+            ctx->world, index, table, it->trs[field_index]);
+        if (synced == -1) {
+            return -1;
+        }
+
+        if (synced || !op_ctx->index_loaded || 
+            (op_ctx->index_value != second)) 
+        {
+            flecs_query_member_index_load(op_ctx, ctx, member, second);
+        }
+
+        /* Find first element for table */
+        const ecs_query_member_index_elem_t *elems = 
+            ecs_vec_first(&op_ctx->index);
+        int32_t lo = 0, hi = ecs_vec_count(&op_ctx->index);
+        while (lo < hi) {
+            int32_t mid = lo + (hi - lo) / 2;
+            if (elems[mid].table_id < table->id) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+
+        int32_t end = lo, count = ecs_vec_count(&op_ctx->index);
+        while (end < count && elems[end].table_id == table->id) {
+            end ++;
+        }
+
+        if (lo == end) {
+            return false;
+        }
+
+        op_ctx->use_index = true;
+        op_ctx->data = ecs_table_get_column(
+            table, it->trs[field_index]->column, 0);
+        op_ctx->each.row = lo - 1;
+        op_ctx->index_end = end;
+    } else if (!op_ctx->use_index) {
+        return -1;
+    } else {
+        second = op_ctx->index_value;
+    }
+
+    int32_t offset = (int32_t)op->first.entity;
+    int32_t size = (int32_t)(op->first.entity >> 32);
+    int32_t start = range.offset;
+    int32_t end = range.count ? start + range.count : ecs_table_count(table);
+    int32_t cur = op_ctx->each.row;
+    const ecs_query_member_index_elem_t *elems = ecs_vec_first(&op_ctx->index);
+
+    /* Iterate the index entities of the table, and yield the ones that are in
+     * the range. The member value is compared against the component value, so
+     * that values that were modified without notifying the index, and 
+     * entities that were moved since the index was loaded, aren't matched. */
+    while (++ cur < op_ctx->index_end) {
+        const ecs_query_member_index_elem_t *elem = &elems[cur];
+        int32_t row = elem->row;
+        if (row < start || row >= end) {
+            continue;
+        }
+
+        ecs_record_t *r = flecs_entities_get(ctx->world, elem->entity);
+        if (!r || r->table != table || ECS_RECORD_TO_ROW(r->row) != row) {
+            continue;
+        }
+
+        ecs_entity_t *val = ECS_OFFSET(
+            ECS_ELEM(op_ctx->data, size, row), offset);
+        if (val[0] != second) {
+            continue;
+        }
+
+        op_ctx->each.row = cur;
+        flecs_query_var_set_entity(op, op->src.var, elem->entity, ctx);
+        it->ids[field_index] = ecs_pair(member, second);
+        return true;
+    }
+
+    return false;
+}
+#endif
+
 bool flecs_query_member_eq(
     const ecs_query_op_t *op,
     bool redo,
     ecs_query_run_ctx_t *ctx)
 {
+#ifdef FLECS_META
+    if (op->other) {
+        int result = flecs_query_member_index_eq(op, redo, ctx);
+        if (result != -1) {
+            return result != 0;
+        }
+    }
+#endif
+
     return flecs_query_member_cmp(op, redo, ctx, false);
 }
 
@@ -5,6 +5,170 @@
 
 #include "../../private_api.h"
 
+/* Find the most selective term in a set of trivial terms. The most selective 
+ * term is the term with the fewest tables, as it minimizes the number of tables
+ * that need to be tested against the other terms. Because the driving term is
+ * selected each time the query is evaluated, the choice follows changes in the
+ * number of tables per component. Returns -1 if one of the terms has no
+ * component record, in which case the query can't match anything. */
+static
+int32_t flecs_query_trivial_select_term(
+    const ecs_query_run_ctx_t *ctx,
+    const ecs_query_t *query,
+    ecs_flags64_t term_set)
+{
+    int32_t t, result = -1, min_count = INT32_MAX;
+    for (t = 0; t < query->term_count; t ++) {
+        if (term_set && !(term_set & (1llu << t))) {
+            continue;
+        }
+
+        ecs_component_record_t *cr = flecs_components_get(
+            ctx->world, query->terms[t].id);
+        if (!cr) {
+            return -1;
+        }
+
+        int32_t count = cr->cache.tables.count;
+        if (count < min_count) {
+            min_count = count;
+            result = t;
+        }
+    }
+
+    ecs_assert(result != -1, ECS_INTERNAL_ERROR, NULL);
+    return result;
+}
+
+/* Intersect the table id sets of the driving term and the terms that are
+ * evaluated against its tables. The iterator then walks the set bits of the
+ * intersection instead of the table list of the driving term, so that tables
+ * that miss one of the components are never loaded. Only terms with enough
+ * tables to have a table id set take part in the intersection, the remaining
+ * terms are evaluated as usual. */
+static
+void flecs_query_trivial_filter_init(
+    const ecs_query_run_ctx_t *ctx,
+    ecs_query_trivial_ctx_t *op_ctx,
+    const ecs_query_t *query,
+    ecs_flags64_t term_set,
+    ecs_component_record_t *driver)
+{
+    op_ctx->filter_count = 0;
+
+    const ecs_bitset_t *driver_set = &driver->cache.table_ids;
+    if (!driver_set->data) {
+        return;
+    }
+
+    const ecs_bitset_t *sets[FLECS_TERM_COUNT_MAX];
+    int32_t t, i, set_count = 0, word_count = driver_set->size / 64;
+    for (t = 0; t < query->term_count; t ++) {
+        if (t == op_ctx->start_from) {
+            continue;
+        }
+        if (term_set && !(term_set & (1llu << t))) {
+            continue;
+        }
+
+        const ecs_component_record_t *cr = flecs_components_get(
+            ctx->world, query->terms[t].id);
+        if (!cr || !cr->cache.table_ids.data) {
+            continue;
+        }
+
+        const ecs_bitset_t *bs = &cr->cache.table_ids;
+        sets[set_count ++] = bs;
+        if ((bs->size / 64) < word_count) {
+            word_count = bs->size / 64;
+        }
+    }
+
+    /* Walking the intersection only beats walking the table list if the 
+     * driving term has at least one table per word in the intersection. */
+    if (!set_count || 
+        word_count > flecs_table_cache_count(&driver->cache)) 
+    {
+        return;
+    }
+
+    if (op_ctx->filter_size < word_count) {
+        ecs_allocator_t *a = flecs_query_get_allocator(ctx->it);
+        if (op_ctx->filter) {
+            flecs_free_n(a, uint64_t, op_ctx->filter_size, op_ctx->filter);
+        }
+        op_ctx->filter = flecs_alloc_n(a, uint64_t, word_count);
+        op_ctx->filter_size = word_count;
+    }
+
+    uint64_t *filter = op_ctx->filter;
+    ecs_os_memcpy_n(filter, driver_set->data, uint64_t, word_count);
+    for (i = 0; i < set_count; i ++) {
+        const uint64_t *data = sets[i]->data;
+        int32_t w;
+        for (w = 0; w < word_count; w ++) {
+            filter[w] &= data[w];
+        }
+    }
+
+    op_ctx->filter_count = word_count;
+    op_ctx->filter_cur = 0;
+    op_ctx->filter_word = filter[0];
+    op_ctx->cr = driver;
+}
+
+/* Return next table record of driving term. */
+static
+const ecs_table_record_t* flecs_query_trivial_next(
+    const ecs_query_run_ctx_t *ctx,
+    ecs_query_trivial_ctx_t *op_ctx,
+    bool match_empty)
+{
+    if (!op_ctx->filter_count) {
+        return flecs_table_cache_next(&op_ctx->it, ecs_table_record_t);
+    }
+
+    const ecs_sparse_t *tables = &ctx->world->store.tables;
+    uint64_t word = op_ctx->filter_word;
+    int32_t cur = op_ctx->filter_cur;
+
+    do {
+        while (!word) {
+            if (++ cur == op_ctx->filter_count) {
+                op_ctx->filter_cur = cur;
+                op_ctx->filter_word = 0;
+                return NULL;
+            }
+            word = op_ctx->filter[cur];
+        }
+
+        uint32_t elem = flecs_ito(uint32_t, cur * 64 + flecs_ctz64(word));
+        word &= word - 1;
+
+        ecs_table_t *table = flecs_sparse_get_t(tables, ecs_table_t, elem);
+        ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+        if (!match_empty && !ecs_table_count(table)) {
+            continue;
+        }
+
+        op_ctx->filter_cur = cur;
+        op_ctx->filter_word = word;
+        return flecs_component_get_table(op_ctx->cr, table);
+    } while (true);
+}
+
+void flecs_query_trivial_ctx_fini(
+    ecs_iter_t *it,
+    ecs_query_trivial_ctx_t *op_ctx)
+{
+    if (op_ctx->filter) {
+        ecs_allocator_t *a = flecs_query_get_allocator(it);
+        flecs_free_n(a, uint64_t, op_ctx->filter_size, op_ctx->filter);
+        op_ctx->filter = NULL;
+        op_ctx->filter_size = 0;
+    }
+}
+
 static
 bool flecs_query_trivial_search_init(
     const ecs_query_run_ctx_t *ctx,
@@ -14,23 +178,17 @@ bool flecs_query_trivial_search_init(
     ecs_flags64_t term_set)
 {
     if (!redo) {
-        /* Find first trivial term */
-        int32_t t = 0;
-        if (term_set) {
-            for (; t < query->term_count; t ++) {
-                if (term_set & (1llu << t)) {
-                    break;
-                }
-            }
+        /* Find term to iterate tables for */
+        int32_t t = flecs_query_trivial_select_term(ctx, query, term_set);
+        if (t == -1) {
+            return false;
         }
 
-        ecs_assert(t != query->term_count, ECS_INTERNAL_ERROR, NULL);
         op_ctx->start_from = t;
 
-        ecs_component_record_t *cr = flecs_components_get(ctx->world, query->ids[t]);
-        if (!cr) {
-            return false;
-        }
+        ecs_component_record_t *cr = flecs_components_get(
+            ctx->world, query->terms[t].id);
+        ecs_assert(cr != NULL, ECS_INTERNAL_ERROR, NULL);
 
         if (query->flags & EcsQueryMatchEmptyTables) {
             if (!flecs_table_cache_all_iter(&cr->cache, &op_ctx->it)){
@@ -42,15 +200,19 @@ bool flecs_query_trivial_search_init(
             }
         }
 
-        /* Find next term to evaluate once */
-        
-        for (t = t + 1; t < query->term_count; t ++) {
-            if (term_set & (1llu << t)) {
+        /* Find first term to evaluate against tables */
+        for (t = 0; t < query->term_count; t ++) {
+            if (t == op_ctx->start_from) {
+                continue;
+            }
+            if (!term_set || (term_set & (1llu << t))) {
                 break;
             }
         }
 
         op_ctx->first_to_eval = t;
+
+        flecs_query_trivial_filter_init(ctx, op_ctx, query, term_set, cr);
     }
 
     return true;
@@ -74,9 +236,11 @@ bool flecs_query_trivial_search(
 
     uint64_t q_filter = q->bloom_filter;
 
+    bool match_empty = q->flags & EcsQueryMatchEmptyTables;
+
     do {
-        const ecs_table_record_t *tr = flecs_table_cache_next(
-            &op_ctx->it, ecs_table_record_t);
+        const ecs_table_record_t *tr = flecs_query_trivial_next(
+            ctx, op_ctx, match_empty);
         if (!tr) {
             return false;
         }
@@ -92,7 +256,7 @@ bool flecs_query_trivial_search(
 
         int16_t *columns = ECS_CONST_CAST(int16_t*, it->columns);
         for (t = op_ctx->first_to_eval; t < term_count; t ++) {
-            if (!(term_set & (1llu << t))) {
+            if (!(term_set & (1llu << t)) || (t == op_ctx->start_from)) {
                 continue;
             }
 
@@ -116,8 +280,9 @@ bool flecs_query_trivial_search(
             ctx->vars[0].range.table = table;
             ctx->vars[0].range.count = 0;
             ctx->vars[0].range.offset = 0;
-            it->trs[op_ctx->start_from] = tr;
-            columns[op_ctx->start_from] = tr->column;
+            int8_t field = terms[op_ctx->start_from].field_index;
+            it->trs[field] = tr;
+            columns[field] = tr->column;
             break;
         }
     } while (true);
@@ -142,10 +307,12 @@ bool flecs_query_is_trivial_search(
 
     uint64_t q_filter = q->bloom_filter;
 
+    bool match_empty = q->flags & EcsQueryMatchEmptyTables;
+
 next:
     {
-        const ecs_table_record_t *tr = flecs_table_cache_next(
-            &op_ctx->it, ecs_table_record_t);
+        const ecs_table_record_t *tr = flecs_query_trivial_next(
+            ctx, op_ctx, match_empty);
         if (!tr) {
             return false;
         }
@@ -160,7 +327,12 @@ next:
         }
 
         int16_t *columns = ECS_CONST_CAST(int16_t*, it->columns);
-        for (t = 1; t < term_count; t ++) {
+        int32_t start_from = op_ctx->start_from;
+        for (t = op_ctx->first_to_eval; t < term_count; t ++) {
+            if (t == start_from) {
+                continue;
+            }
+
             ecs_component_record_t *cr = flecs_components_get(ctx->world, ids[t]);
             if (!cr) {
                 return false;
@@ -179,8 +351,8 @@ next:
         it->table = table;
         it->count = ecs_table_count(table);
         it->entities = ecs_table_entities(table);
-        it->trs[0] = tr;
-        columns[0] = tr->column;
+        it->trs[start_from] = tr;
+        columns[start_from] = tr->column;
     }
 
     return true;
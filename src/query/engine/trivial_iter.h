@@ -27,4 +27,9 @@ bool flecs_query_trivial_test(
     bool first,
     ecs_flags64_t field_set);
 
+/* Free resources of trivial iterator context. */
+void flecs_query_trivial_ctx_fini(
+    ecs_iter_t *it,
+    ecs_query_trivial_ctx_t *op_ctx);
+
 #endif
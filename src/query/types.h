@@ -106,6 +106,7 @@ typedef enum {
     EcsQuerySetId,          /* Set id if not set */
     EcsQueryContain,        /* Test if table contains entity */
     EcsQueryPairEq,         /* Test if both elements of pair are the same */
+    EcsQueryPartition,      /* Filter driver results for partitioned iterator */
     EcsQueryYield,          /* Yield result back to application */
     EcsQueryNothing         /* Must be last */
 } ecs_query_op_kind_t;
@@ -337,6 +338,12 @@ typedef struct {
     const ecs_table_record_t *tr;
     int32_t start_from;
     int32_t first_to_eval;
+    ecs_component_record_t *cr; /* Component record of driving term */
+    uint64_t *filter;         /* Intersection of table id sets of terms */
+    uint64_t filter_word;     /* Bits of current word not yet iterated */
+    int32_t filter_cur;       /* Current word in filter */
+    int32_t filter_count;     /* Number of words in filter, 0 if not used */
+    int32_t filter_size;      /* Allocated number of words in filter */
 } ecs_query_trivial_ctx_t;
 
 /* *From operator iterator context */
@@ -348,10 +355,23 @@ typedef struct {
     int32_t cur_id_index;
 } ecs_query_xfrom_ctx_t;
 
+/* Entity from member index, with its location at the time of the lookup */
+typedef struct {
+    uint64_t table_id;
+    ecs_table_t *table;
+    int32_t row;
+    ecs_entity_t entity;
+} ecs_query_member_index_elem_t;
+
 /* Member equality context */
 typedef struct {
     ecs_query_each_ctx_t each;
     void *data;
+    ecs_vec_t index;           /* vec<ecs_query_member_index_elem_t>, by table */
+    ecs_entity_t index_value;  /* Member value of entities in index vector */
+    int32_t index_end;         /* End of index elements for current table */
+    bool index_loaded;         /* Index vector is populated for index_value */
+    bool use_index;            /* Current table is evaluated with index */
 } ecs_query_membereq_ctx_t;
 
 /* Toggle context */
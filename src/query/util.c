@@ -73,6 +73,7 @@ const char* flecs_query_op_str(
     case EcsQuerySetId:          return "setid       ";
     case EcsQueryContain:        return "contain     ";
     case EcsQueryPairEq:         return "pair_eq     ";
+    case EcsQueryPartition:      return "partition   ";
     case EcsQueryYield:          return "yield       ";
     case EcsQueryNothing:        return "nothing     ";
     default:                     return "!invalid    ";
@@ -306,6 +307,79 @@ void flecs_query_str_append_bitset(
     ecs_strbuf_list_pop(buf, "}");
 }
 
+/* Get number of tables for a term. Used to show the cost of terms that are
+ * used to find tables in the query plan. */
+static
+int32_t flecs_query_plan_term_cost(
+    const ecs_query_t *q,
+    int32_t term_index)
+{
+    if (term_index < 0 || term_index >= q->term_count) {
+        return 0;
+    }
+
+    ecs_id_t id = q->terms[term_index].id;
+    if (!id || ecs_id_is_wildcard(id)) {
+        return 0;
+    }
+
+    ecs_component_record_t *cr = flecs_components_get(q->real_world, id);
+    if (!cr) {
+        return 0;
+    }
+
+    return cr->cache.tables.count;
+}
+
+/* Append number of tables for terms that are used to find tables. Only 
+ * appended if one or more of the terms matches tables. */
+static
+void flecs_query_plan_append_cost(
+    const ecs_query_t *q,
+    const ecs_query_op_t *op,
+    ecs_flags64_t written,
+    ecs_strbuf_t *buf)
+{
+    /* Operation doesn't find tables if its source was already written */
+    if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+        if (written & (1llu << op->src.var)) {
+            return;
+        }
+    } else if (op->kind != EcsQueryTriv || (written & 1llu)) {
+        return;
+    }
+
+    if (op->kind == EcsQueryTriv) {
+        ecs_flags64_t bitset = op->src.entity;
+        int32_t b, total = 0;
+        for (b = 0; b < q->term_count; b ++) {
+            if (bitset & (1llu << b)) {
+                total += flecs_query_plan_term_cost(q, b);
+            }
+        }
+
+        if (!total) {
+            return;
+        }
+
+        ecs_strbuf_appendlit(buf, " #[grey]tables: ");
+        ecs_strbuf_list_push(buf, "{", ",");
+        for (b = 0; b < q->term_count; b ++) {
+            if (bitset & (1llu << b)) {
+                ecs_strbuf_list_append(buf, "%d", 
+                    flecs_query_plan_term_cost(q, b));
+            }
+        }
+        ecs_strbuf_list_pop(buf, "}");
+        ecs_strbuf_appendlit(buf, "#[reset]");
+    } else if (op->kind == EcsQueryAnd) {
+        int32_t cost = flecs_query_plan_term_cost(q, op->term_index);
+        if (cost) {
+            ecs_strbuf_append(buf, " #[grey]tables: %d#[reset]", cost);
+        }
+    }
+}
+
 static
 void flecs_query_plan_w_profile(
     const ecs_query_t *q,
@@ -320,9 +394,15 @@ void flecs_query_plan_w_profile(
         return; /* No plan */
     }
 
+    ecs_flags64_t written_vars = 0, prev_written_vars;
     for (i = 0; i < count; i ++) {
         ecs_query_op_t *op = &ops[i];
         ecs_flags16_t flags = op->flags;
+        prev_written_vars = written_vars;
+        written_vars |= op->written;
+        if (op->kind == EcsQueryTriv) {
+            written_vars |= 1llu; /* Trivial search always writes $this */
+        }
         ecs_flags16_t src_flags = flecs_query_ref_flags(flags, EcsQuerySrc);
         ecs_flags16_t first_flags = flecs_query_ref_flags(flags, EcsQueryFirst);
         ecs_flags16_t second_flags = flecs_query_ref_flags(flags, EcsQuerySecond);
@@ -367,6 +447,7 @@ void flecs_query_plan_w_profile(
 
         if (op->kind == EcsQueryTriv) {
             flecs_query_str_append_bitset(buf, op->src.entity);
+            flecs_query_plan_append_cost(q, op, prev_written_vars, buf);
         }
 
         if (op->kind == EcsQueryIfSet) {
@@ -440,6 +521,8 @@ void flecs_query_plan_w_profile(
 
         ecs_strbuf_appendch(buf, ')');
 
+        flecs_query_plan_append_cost(q, op, prev_written_vars, buf);
+
         ecs_strbuf_appendch(buf, '\n');
     }
 }
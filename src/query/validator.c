@@ -1557,7 +1557,7 @@ int flecs_query_finalize_terms(
      * optimized logic as it doesn't have to deal with order_by edge cases */
     ECS_BIT_COND(q->flags, EcsQueryIsCacheable, 
         cacheable && (cacheable_terms == term_count) &&
-            !desc->order_by_callback &&
+            !desc->order_by_callback && !desc->order_by &&
             !has_childof);
 
     ECS_BIT_COND(q->flags, EcsQueryCacheWithFilter, has_childof);
@@ -1648,7 +1648,7 @@ bool flecs_query_finalize_simple(
         return false;
     }
 
-    if (desc->order_by_callback || desc->group_by_callback) {
+    if (desc->order_by_callback || desc->order_by || desc->group_by_callback) {
         return false;
     }
 
@@ -52,6 +52,8 @@ void flecs_stage_merge(
 
     flecs_eval_component_monitors(world);
 
+    flecs_observers_flush_batched(world);
+
     if (measure_frame_time) {
         world->info.merge_time_total += (ecs_ftime_t)ecs_time_measure(&t_start);
     }
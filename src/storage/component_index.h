@@ -73,6 +73,11 @@ struct ecs_component_record_t {
     /* Flags for id */
     ecs_flags32_t flags;
 
+    /* Builtin event records with observers for the id, including observers
+     * for wildcard ids. Valid if the generation matches the observable. */
+    ecs_flags32_t dispatch;
+    uint32_t dispatch_generation;
+
 #ifdef FLECS_DEBUG_INFO
     /* String representation of id (used for debug visualization) */
     char *str;
@@ -86,6 +86,78 @@ void flecs_table_check_sanity(
 #define flecs_table_check_sanity(table)
 #endif
 
+/* Column storage is aligned to FLECS_COLUMN_ALIGNMENT, so that fields at table
+ * offset 0 can be accessed with aligned vector loads. Allocations are padded to
+ * a multiple of the alignment so vectorized loops can process the last elements
+ * of a column without a scalar epilogue. The pointer returned by the OS 
+ * allocator is stored right before the aligned column storage. */
+void* flecs_table_column_alloc(
+    ecs_size_t size)
+{
+    ecs_assert(size > 0, ECS_INTERNAL_ERROR, NULL);
+    ecs_size_t padded = ECS_ALIGN(size, FLECS_COLUMN_ALIGNMENT);
+    void *base = ecs_os_malloc(padded + FLECS_COLUMN_ALIGNMENT + 
+        ECS_SIZEOF(void*));
+    ecs_assert(base != NULL, ECS_OUT_OF_MEMORY, NULL);
+
+    uintptr_t addr = (uintptr_t)base + sizeof(void*);
+    addr = (addr + (FLECS_COLUMN_ALIGNMENT - 1)) & 
+        ~(uintptr_t)(FLECS_COLUMN_ALIGNMENT - 1);
+
+    void *result = (void*)addr;
+    ((void**)result)[-1] = base;
+    return result;
+}
+
+void flecs_table_column_free(
+    void *ptr)
+{
+    if (ptr) {
+        ecs_os_free(((void**)ptr)[-1]);
+    }
+}
+
+/* Same as ecs_vec_set_size, but for aligned column storage. */
+static
+void flecs_table_column_set_size(
+    ecs_vec_t *v,
+    ecs_size_t elem_size,
+    int32_t elem_count)
+{
+    if (v->size == elem_count) {
+        return;
+    }
+
+    if (elem_count < v->count) {
+        elem_count = v->count;
+    }
+
+    elem_count = flecs_next_pow_of_2(elem_count);
+    if (elem_count < 2) {
+        elem_count = 2;
+    }
+
+    if (elem_count != v->size) {
+        void *array = flecs_table_column_alloc(elem_size * elem_count);
+        if (v->count) {
+            ecs_os_memcpy(array, v->array, elem_size * v->count);
+        }
+        flecs_table_column_free(v->array);
+        v->array = array;
+        v->size = elem_count;
+    }
+}
+
+static
+void flecs_table_column_fini(
+    ecs_vec_t *v)
+{
+    flecs_table_column_free(v->array);
+    v->array = NULL;
+    v->count = 0;
+    v->size = 0;
+}
+
 /* Set flags for type hooks so table operations can quickly check whether a
  * fast or complex operation that invokes hooks is required. */
 static
@@ -1188,8 +1260,7 @@ void flecs_table_fini_data(
             int32_t c, column_count = table->column_count;
             for (c = 0; c < column_count; c ++) {
                 ecs_column_t *column = &columns[c];
-                ecs_vec_t v = ecs_vec_from_column(column, table, column->ti->size);
-                ecs_vec_fini(NULL, &v, column->ti->size);
+                flecs_table_column_free(column->data);
                 column->data = NULL;
             }
 
@@ -1256,6 +1327,26 @@ void flecs_table_remove_actions(
     flecs_table_notify_on_remove(world, table);
 }
 
+/* Free per chunk dirty state */
+static
+void flecs_table_fini_dirty_chunks(
+    ecs_world_t *world,
+    ecs_table_t *table)
+{
+    ecs_table_dirty_chunks_t *dcs = table->_->dirty_chunks;
+    if (!dcs) {
+        return;
+    }
+
+    int32_t i, count = table->column_count;
+    for (i = 0; i < count; i ++) {
+        flecs_free_n(&world->allocator, int32_t, dcs[i].count, dcs[i].chunks);
+    }
+
+    flecs_free_n(&world->allocator, ecs_table_dirty_chunks_t, count, dcs);
+    table->_->dirty_chunks = NULL;
+}
+
 /* Free table resources. */
 void flecs_table_fini(
     ecs_world_t *world,
@@ -1307,6 +1398,7 @@ void flecs_table_fini(
     }
 
     flecs_table_fini_overrides(world, table);
+    flecs_table_fini_dirty_chunks(world, table);
     flecs_wfree_n(world, int32_t, table->column_count + 1, table->dirty_state);
     ecs_os_free(table->column_map);
     ecs_os_free(table->component_map);
@@ -1374,11 +1466,65 @@ void flecs_table_mark_table_dirty(
     ecs_table_t *table,
     int32_t index)
 {
+    if (index) {
+        flecs_table_mark_column_dirty(world, table, index, 0, -1);
+        return;
+    }
+
     if (table->dirty_state) {
         table->dirty_state[index] ++;
     }
-    if (!index) {
-        flecs_increment_table_version(world, table);
+
+    flecs_increment_table_version(world, table);
+}
+
+/* Mark range of rows in table column dirty. A count of -1 marks all rows. */
+void flecs_table_mark_column_dirty(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t column,
+    int32_t offset,
+    int32_t count)
+{
+    ecs_assert(column > 0, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(column <= table->column_count, ECS_INTERNAL_ERROR, NULL);
+
+    if (!table->dirty_state) {
+        return;
+    }
+
+    int32_t state = ++ table->dirty_state[column];
+    ecs_table_dirty_chunks_t *dc = &table->_->dirty_chunks[column - 1];
+
+    if (count == -1 || (!offset && count >= table->data.count)) {
+        dc->all = state;
+        return;
+    }
+
+    if (!count) {
+        return;
+    }
+
+    int32_t first = offset >> FLECS_CHANGE_CHUNK_BITS;
+    int32_t last = (offset + count - 1) >> FLECS_CHANGE_CHUNK_BITS;
+
+    if (last >= dc->count) {
+        int32_t size = table->data.size;
+        int32_t new_count = ((size - 1) >> FLECS_CHANGE_CHUNK_BITS) + 1;
+        if (new_count <= last) {
+            new_count = last + 1;
+        }
+
+        dc->chunks = flecs_realloc_n(&world->allocator, int32_t, 
+            new_count, dc->count, dc->chunks);
+        ecs_os_memset_n(&dc->chunks[dc->count], 0, int32_t, 
+            flecs_itosize(new_count - dc->count));
+        dc->count = new_count;
+    }
+
+    int32_t i;
+    for (i = first; i <= last; i ++) {
+        dc->chunks[i] = state;
     }
 }
 
@@ -1386,7 +1532,8 @@ void flecs_table_mark_table_dirty(
 void flecs_table_mark_dirty(
     ecs_world_t *world,
     ecs_table_t *table,
-    ecs_entity_t component)
+    ecs_entity_t component,
+    int32_t row)
 {
     ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
 
@@ -1413,7 +1560,11 @@ void flecs_table_mark_dirty(
 
         /* Column is offset by 1, 0 is reserved for entity column. */
 
-        table->dirty_state[column] ++;
+        if (row == -1) {
+            flecs_table_mark_column_dirty(world, table, column, 0, -1);
+        } else {
+            flecs_table_mark_column_dirty(world, table, column, row, 1);
+        }
 
         ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, 
             FLECS_LOCKED_STORAGE_MSG("dirty marking"));
@@ -1435,10 +1586,40 @@ int32_t* flecs_table_get_dirty_state(
         for (int i = 0; i < column_count + 1; i ++) {
             table->dirty_state[i] = 1;
         }
+
+        if (column_count) {
+            table->_->dirty_chunks = flecs_calloc_n(&world->allocator,
+                ecs_table_dirty_chunks_t, column_count);
+        }
     }
     return table->dirty_state;
 }
 
+/* Get dirty state of chunk in table column */
+int32_t flecs_table_get_chunk_dirty_state(
+    const ecs_table_t *table,
+    int32_t column,
+    int32_t chunk)
+{
+    ecs_assert(table->dirty_state != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(column > 0, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(column <= table->column_count, ECS_INTERNAL_ERROR, NULL);
+
+    const ecs_table_dirty_chunks_t *dc = &table->_->dirty_chunks[column - 1];
+    if (chunk >= dc->count) {
+        return dc->all;
+    }
+
+    /* Return whichever change happened last. Dirty state may wrap around, so
+     * compare the difference instead of the values. */
+    int32_t state = dc->chunks[chunk];
+    if ((int32_t)((uint32_t)state - (uint32_t)dc->all) > 0) {
+        return state;
+    }
+
+    return dc->all;
+}
+
 /* Table move logic for bitset (toggle component) column */
 static
 void flecs_table_move_bitset_columns(
@@ -1544,9 +1725,10 @@ void flecs_table_grow_column(
         ecs_assert(ti->hooks.ctor != NULL, ECS_INTERNAL_ERROR, NULL);
 
         /* Create vector */
-        ecs_vec_t dst;
-        ecs_vec_init(NULL, &dst, elem_size, dst_size);
+        ecs_vec_t dst = *column;
+        dst.array = flecs_table_column_alloc(elem_size * dst_size);
         dst.count = dst_count;
+        dst.size = dst_size;
 
         void *src_buffer = column->array;
         void *dst_buffer = dst.array;
@@ -1561,16 +1743,16 @@ void flecs_table_grow_column(
         }
 
         /* Free old vector */
-        ecs_vec_fini(NULL, column, elem_size);
+        flecs_table_column_fini(column);
 
         *column = dst;
     } else {
         /* If array won't realloc or has no move, simply add new elements */
         if (can_realloc) {
-            ecs_vec_set_size(NULL, column, elem_size, dst_size);
+            flecs_table_column_set_size(column, elem_size, dst_size);
         }
 
-        ecs_vec_grow(NULL, column, elem_size, to_add);
+        column->count += to_add;
 
         if (construct) {
             flecs_table_invoke_ctor_for_array(
@@ -1588,7 +1770,8 @@ int32_t flecs_table_grow_data(
     ecs_table_t *table,
     int32_t to_add,
     int32_t size,
-    const ecs_entity_t *ids)
+    const ecs_entity_t *ids,
+    bool construct)
 {
     flecs_poly_assert(world, ecs_world_t);
 
@@ -1637,13 +1820,14 @@ int32_t flecs_table_grow_data(
         ecs_column_t *column = &columns[i];
         const ecs_type_info_t *ti = column->ti;
         ecs_vec_t v_column = ecs_vec_from_column_ext(column, prev_count, prev_size, ti->size);
-        flecs_table_grow_column(world, table, i, &v_column, ti, to_add, size, true);
+        flecs_table_grow_column(
+            world, table, i, &v_column, ti, to_add, size, construct);
         ecs_assert(v_column.size == size, ECS_INTERNAL_ERROR, NULL);
         ecs_assert(v_column.size == v_entities.size, ECS_INTERNAL_ERROR, NULL);
         ecs_assert(v_column.count == v_entities.count, ECS_INTERNAL_ERROR, NULL);
         column->data = v_column.array;
 
-        if (to_add) {
+        if (to_add && construct) {
             flecs_table_invoke_add_hooks(
                 world, table, i, e, count, to_add, false);
         }
@@ -1678,7 +1862,9 @@ void flecs_table_fast_append(
         ecs_column_t *column = &columns[i];
         const ecs_type_info_t *ti = column->ti;
         ecs_vec_t v = ecs_vec_from_column(column, table, ti->size);
-        ecs_vec_append(NULL, &v, ti->size);
+        if (v.count == v.size) {
+            flecs_table_column_set_size(&v, ti->size, v.count + 1);
+        }
         column->data = v.array;
     }
 }
@@ -2052,12 +2238,114 @@ int32_t flecs_table_appendn(
     flecs_table_check_sanity(table);
     int32_t cur_count = ecs_table_count(table);
     int32_t result = flecs_table_grow_data(
-        world, table, to_add, cur_count + to_add, ids);
+        world, table, to_add, cur_count + to_add, ids, true);
     flecs_table_check_sanity(table);
 
     return result;
 }
 
+/* Move the last count entities of the src table to the end of the dst table.
+ * Because the moved rows are contiguous in both tables, component data is moved
+ * with a single operation per column. */
+int32_t flecs_table_move_tail(
+    ecs_world_t *world,
+    ecs_table_t *dst_table,
+    ecs_table_t *src_table,
+    int32_t count)
+{
+    ecs_assert(dst_table != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(src_table != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(dst_table != src_table, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(!dst_table->_->lock, ECS_LOCKED_STORAGE, 
+        FLECS_LOCKED_STORAGE_MSG("bulk move"));
+    ecs_assert(!src_table->_->lock, ECS_LOCKED_STORAGE, 
+        FLECS_LOCKED_STORAGE_MSG("bulk move"));
+    ecs_assert(!((dst_table->flags | src_table->flags) & EcsTableHasToggle),
+        ECS_INTERNAL_ERROR, NULL);
+
+    int32_t src_count = ecs_table_count(src_table);
+    ecs_assert(count > 0, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(count <= src_count, ECS_INTERNAL_ERROR, NULL);
+
+    flecs_table_check_sanity(dst_table);
+    flecs_table_check_sanity(src_table);
+
+    int32_t src_row = src_count - count;
+    int32_t dst_row = ecs_table_count(dst_table);
+    ecs_entity_t *src_entities = &src_table->data.entities[src_row];
+
+    /* Add rows to the destination table without constructing components that
+     * will be moved from the source table. */
+    flecs_table_grow_data(world, dst_table, count, dst_row + count, 
+        src_entities, false);
+
+    ecs_entity_t *dst_entities = &dst_table->data.entities[dst_row];
+
+    int32_t i_new = 0, dst_column_count = dst_table->column_count;
+    int32_t i_old = 0, src_column_count = src_table->column_count;
+
+    ecs_column_t *src_columns = src_table->data.columns;
+    ecs_column_t *dst_columns = dst_table->data.columns;
+
+    for (; (i_new < dst_column_count) && (i_old < src_column_count); ) {
+        ecs_column_t *dst_column = &dst_columns[i_new];
+        ecs_column_t *src_column = &src_columns[i_old];
+        ecs_id_t dst_id = flecs_column_id(dst_table, i_new);
+        ecs_id_t src_id = flecs_column_id(src_table, i_old);
+
+        if (dst_id == src_id) {
+            ecs_type_info_t *ti = dst_column->ti;
+            int32_t size = ti->size;
+            void *dst = ECS_ELEM(dst_column->data, size, dst_row);
+            void *src = ECS_ELEM(src_column->data, size, src_row);
+
+            /* The source rows are at the end of the table, so they don't need
+             * to be backfilled and can be destructed after the move. */
+            flecs_type_info_ctor_move_dtor(dst, src, count, ti);
+        } else {
+            if (dst_id < src_id) {
+                flecs_table_invoke_add_hooks(world, dst_table,
+                    i_new, dst_entities, dst_row, count, true);
+            } else {
+                flecs_table_invoke_remove_hooks(world, src_table,
+                    src_column, src_entities, src_row, count, true);
+            }
+        }
+
+        i_new += dst_id <= src_id;
+        i_old += dst_id >= src_id;
+    }
+
+    for (; (i_new < dst_column_count); i_new ++) {
+        flecs_table_invoke_add_hooks(world, dst_table, i_new,
+            dst_entities, dst_row, count, true);
+    }
+
+    for (; (i_old < src_column_count); i_old ++) {
+        flecs_table_invoke_remove_hooks(world, src_table, &src_columns[i_old], 
+            src_entities, src_row, count, true);
+    }
+
+    /* Update entity index for moved entities */
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        ecs_record_t *r = flecs_entities_get(world, dst_entities[i]);
+        ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert(r->table == src_table, ECS_INTERNAL_ERROR, NULL);
+        r->table = dst_table;
+        r->row = ECS_ROW_TO_RECORD(dst_row + i, r->row & ECS_ROW_FLAGS_MASK);
+    }
+
+    /* Remove moved rows from the source table */
+    src_table->data.count = src_row;
+    flecs_table_mark_table_dirty(world, src_table, 0);
+
+    flecs_table_check_sanity(dst_table);
+    flecs_table_check_sanity(src_table);
+
+    return dst_row;
+}
+
 /* Shrink table storage to fit number of entities */
 bool flecs_table_shrink(
     ecs_world_t *world,
@@ -2097,13 +2385,13 @@ bool flecs_table_shrink(
         void *data = columns[i].data;
 
         if (count) {
-            columns[i].data = ecs_os_malloc(component_size * count);
+            columns[i].data = flecs_table_column_alloc(component_size * count);
             flecs_type_info_ctor_move_dtor(columns[i].data, data, count, ti);
         } else {
             columns[i].data = NULL;
         }
 
-        ecs_os_free(data);
+        flecs_table_column_free(data);
     }
 
     table->data.size = count;
@@ -2224,6 +2512,112 @@ void flecs_table_swap(
     flecs_table_check_sanity(table);
 }
 
+void flecs_table_reorder(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t offset,
+    int32_t count,
+    const int32_t *src)
+{
+    ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, 
+        FLECS_LOCKED_STORAGE_MSG("table reorder"));
+    ecs_assert(offset >= 0, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(offset + count <= ecs_table_count(table), 
+        ECS_INTERNAL_ERROR, NULL);
+
+    if (!count) {
+        return;
+    }
+
+    ecs_column_t *columns = table->data.columns;
+    int32_t i, column_count = table->column_count;
+    ecs_size_t max_size = ECS_SIZEOF(ecs_entity_t);
+    bool move_hooks = table->_->bs_count != 0;
+    for (i = 0; i < column_count; i ++) {
+        const ecs_type_info_t *ti = columns[i].ti;
+        max_size = ECS_MAX(max_size, ti->size);
+        if (ti->hooks.move) {
+            move_hooks = true;
+        }
+    }
+
+    if (move_hooks) {
+        /* Components with move hooks (and bitset columns) can't be moved
+         * with memcpy, so follow the cycles of the permutation with swaps. */
+        int32_t *visit = ecs_os_malloc_n(int32_t, count);
+        ecs_os_memcpy_n(visit, src, int32_t, count);
+        for (i = 0; i < count; i ++) {
+            int32_t cur = i;
+            while (visit[cur] != -1) {
+                int32_t next = visit[cur] - offset;
+                visit[cur] = -1;
+                if (next == i) {
+                    break;
+                }
+                flecs_table_swap(world, table, offset + cur, offset + next);
+                cur = next;
+            }
+        }
+        ecs_os_free(visit);
+        return;
+    }
+
+    /* Only rows that aren't already in place need to be moved */
+    int32_t *moved = ecs_os_malloc_n(int32_t, count);
+    int32_t k, moved_count = 0;
+    for (i = 0; i < count; i ++) {
+        if (src[i] != offset + i) {
+            moved[moved_count ++] = i;
+        }
+    }
+
+    if (!moved_count) {
+        ecs_os_free(moved);
+        return;
+    }
+
+    flecs_table_check_sanity(table);
+    flecs_table_mark_table_dirty(world, table, 0);
+
+    /* Gather moved rows into a temporary buffer, then copy them back */
+    void *tmp = ecs_os_malloc(max_size * moved_count);
+    ecs_entity_t *entities = table->data.entities;
+    ecs_entity_t *tmp_entities = tmp;
+    for (k = 0; k < moved_count; k ++) {
+        tmp_entities[k] = entities[src[moved[k]]];
+    }
+    for (k = 0; k < moved_count; k ++) {
+        entities[offset + moved[k]] = tmp_entities[k];
+    }
+
+    int32_t c;
+    for (c = 0; c < column_count; c ++) {
+        ecs_size_t size = columns[c].ti->size;
+        void *data = columns[c].data;
+        for (k = 0; k < moved_count; k ++) {
+            ecs_os_memcpy(ECS_ELEM(tmp, size, k), 
+                ECS_ELEM(data, size, src[moved[k]]), size);
+        }
+        for (k = 0; k < moved_count; k ++) {
+            ecs_os_memcpy(ECS_ELEM(data, size, offset + moved[k]), 
+                ECS_ELEM(tmp, size, k), size);
+        }
+    }
+
+    /* Update rows of entity records that moved */
+    for (k = 0; k < moved_count; k ++) {
+        int32_t row = offset + moved[k];
+        ecs_record_t *r = flecs_entities_get(world, entities[row]);
+        ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+        r->row = ECS_ROW_TO_RECORD(row, ECS_RECORD_TO_ROW_FLAGS(r->row));
+    }
+
+    ecs_os_free(tmp);
+    ecs_os_free(moved);
+
+    flecs_table_check_sanity(table);
+}
+
 static
 void flecs_table_merge_vec(
     ecs_vec_t *dst,
@@ -2271,7 +2665,7 @@ void flecs_table_merge_column(
     int32_t dst_count = ecs_vec_count(dst_vec);
 
     if (!dst_count) {
-        ecs_vec_fini(NULL, dst_vec, elem_size);
+        flecs_table_column_fini(dst_vec);
         *dst_vec = *src_vec;
 
     /* If the new table is not empty, move the contents from the
@@ -2287,7 +2681,7 @@ void flecs_table_merge_column(
         ecs_assert(ti != NULL, ECS_INTERNAL_ERROR, NULL);
         flecs_type_info_ctor_move_dtor(dst_ptr, src_ptr, src_count, ti);
 
-        ecs_vec_fini(NULL, src_vec, elem_size);
+        flecs_table_column_fini(src_vec);
     }
 
     dst->data = dst_vec->array;
@@ -2329,12 +2723,11 @@ void flecs_table_merge_data(
         ecs_id_t dst_id = flecs_column_id(dst_table, i_new);
         ecs_id_t src_id = flecs_column_id(src_table, i_old);
         ecs_size_t dst_elem_size = dst_column->ti->size;
-        ecs_size_t src_elem_size = src_column->ti->size;
     
         ecs_vec_t dst_vec = ecs_vec_from_column(
             dst_column, dst_table, dst_elem_size);
         ecs_vec_t src_vec = ecs_vec_from_column(
-            src_column, src_table, src_elem_size);
+            src_column, src_table, src_column->ti->size);
 
         if (dst_id == src_id) {
             flecs_table_merge_column(world, &dst_vec, &src_vec, dst_column, 
@@ -2344,14 +2737,14 @@ void flecs_table_merge_data(
             i_old ++;
         } else if (dst_id < src_id) {
             /* New column, make sure vector is large enough. */
-            ecs_vec_set_size(NULL, &dst_vec, dst_elem_size, column_size);
+            flecs_table_column_set_size(&dst_vec, dst_elem_size, column_size);
             dst_column->data = dst_vec.array;
             flecs_table_invoke_ctor(world, dst_table, i_new, dst_count, src_count);
             i_new ++;
         } else if (dst_id > src_id) {
             /* Old column does not occur in new table, destruct */
             flecs_table_invoke_dtor(src_column, 0, src_count);
-            ecs_vec_fini(NULL, &src_vec, src_elem_size);
+            flecs_table_column_fini(&src_vec);
             src_column->data = NULL;
             i_old ++;
         }
@@ -2366,7 +2759,7 @@ void flecs_table_merge_data(
         int32_t elem_size = column->ti->size;
         ecs_assert(elem_size != 0, ECS_INTERNAL_ERROR, NULL);
         ecs_vec_t vec = ecs_vec_from_column(column, dst_table, elem_size);
-        ecs_vec_set_size(NULL, &vec, elem_size, column_size);
+        flecs_table_column_set_size(&vec, elem_size, column_size);
         column->data = vec.array;
         flecs_table_invoke_ctor(world, dst_table, i_new, dst_count, src_count);
     }
@@ -2374,12 +2767,10 @@ void flecs_table_merge_data(
     /* Destruct remaining columns */
     for (; i_old < src_column_count; i_old ++) {
         ecs_column_t *column = &src_columns[i_old];
-        int32_t elem_size = column->ti->size;
-        ecs_assert(elem_size != 0, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert(column->ti->size != 0, ECS_INTERNAL_ERROR, NULL);
         flecs_table_invoke_dtor(column, 0, src_count);
-        ecs_vec_t vec = ecs_vec_from_column(column, src_table, elem_size);
-        ecs_vec_fini(NULL, &vec, elem_size);
-        column->data = vec.array;
+        flecs_table_column_free(column->data);
+        column->data = NULL;
     }    
 
     /* Mark entity column as dirty */
@@ -2847,6 +3238,47 @@ int32_t ecs_table_size(
     return table->data.size;
 }
 
+void ecs_table_reserve(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t size)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(table != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(size >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!table->_->lock, ECS_LOCKED_STORAGE, 
+        FLECS_LOCKED_STORAGE_MSG("table reserve"));
+
+    if (size <= table->data.size) {
+        return;
+    }
+
+    flecs_table_check_sanity(table);
+
+    int32_t count = table->data.count;
+    int32_t prev_size = table->data.size;
+
+    ecs_vec_t v_entities = ecs_vec_from_entities(table);
+    ecs_vec_set_size_t(NULL, &v_entities, ecs_entity_t, size);
+    table->data.entities = v_entities.array;
+    table->data.size = size = v_entities.size;
+
+    ecs_column_t *columns = table->data.columns;
+    int32_t i, column_count = table->column_count;
+    for (i = 0; i < column_count; i ++) {
+        ecs_column_t *column = &columns[i];
+        const ecs_type_info_t *ti = column->ti;
+        ecs_vec_t v_column = ecs_vec_from_column_ext(
+            column, count, prev_size, ti->size);
+        flecs_table_grow_column(world, table, i, &v_column, ti, 0, size, false);
+        column->data = v_column.array;
+    }
+
+    flecs_table_check_sanity(table);
+error:
+    return;
+}
+
 bool ecs_table_has_id(
     const ecs_world_t *world,
     const ecs_table_t *table,
@@ -94,6 +94,16 @@ typedef struct ecs_table_overrides_t {
     ecs_ref_t *refs;                 /* Refs to base components (one for each column) */
 } ecs_table_overrides_t;
 
+/** Dirty state of a column per chunk of (1 << FLECS_CHANGE_CHUNK_BITS) rows. Each 
+ * element stores the value of the column dirty state at the time the chunk was
+ * last changed, which lets queries find the chunks that changed since they 
+ * synchronized their monitor. */
+typedef struct ecs_table_dirty_chunks_t {
+    int32_t *chunks;                 /* Dirty state per chunk */
+    int32_t count;                   /* Number of elements in chunks */
+    int32_t all;                     /* Dirty state of last change to all rows */
+} ecs_table_dirty_chunks_t;
+
 /** Infrequently accessed data not stored inline in ecs_table_t */
 typedef struct ecs_table__t {
     uint64_t hash;                   /* Type hash */
@@ -108,6 +118,7 @@ typedef struct ecs_table__t {
     ecs_bitset_t *bs_columns;        /* Bitset columns */
 
     struct ecs_table_record_t *records; /* Array with table records */
+    ecs_table_dirty_chunks_t *dirty_chunks; /* Per chunk dirty state for columns */
 
 #ifdef FLECS_DEBUG_INFO
     /* Fields used for debug visualization */
@@ -209,6 +220,15 @@ void flecs_table_move(
     int32_t old_index,
     ecs_id_t emplace_id);
 
+/* Reorder rows in range [offset, offset + count) so that row offset + i 
+ * stores the row that was stored at src[i]. Used for table sorting. */
+void flecs_table_reorder(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t offset,
+    int32_t count,
+    const int32_t *src);
+
 /* Grow table with specified number of records. Populate table with the
  * specified entity ids. */
 int32_t flecs_table_appendn(
@@ -217,6 +237,22 @@ int32_t flecs_table_appendn(
     int32_t count,
     const ecs_entity_t *ids);
 
+/* Allocate column storage aligned to FLECS_COLUMN_ALIGNMENT. */
+void* flecs_table_column_alloc(
+    ecs_size_t size);
+
+/* Free column storage allocated with flecs_table_column_alloc. */
+void flecs_table_column_free(
+    void *ptr);
+
+/* Move the last count entities of src table to the end of dst table. Returns
+ * the row of the first moved entity in the destination table. */
+int32_t flecs_table_move_tail(
+    ecs_world_t *world,
+    ecs_table_t *dst_table,
+    ecs_table_t *src_table,
+    int32_t count);
+
 /* Shrink table to contents */
 bool flecs_table_shrink(
     ecs_world_t *world,
@@ -252,10 +288,28 @@ void flecs_table_merge(
     ecs_table_t *new_table,
     ecs_table_t *old_table);
 
+/* Mark table component dirty. If row is -1, all rows are marked dirty. */
 void flecs_table_mark_dirty(
     ecs_world_t *world,
     ecs_table_t *table,
-    ecs_entity_t component);
+    ecs_entity_t component,
+    int32_t row);
+
+/* Mark range of rows in table column dirty. Column is the index of the column
+ * in dirty_state, which is offset by 1. */
+void flecs_table_mark_column_dirty(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t column,
+    int32_t offset,
+    int32_t count);
+
+/* Get dirty state of chunk in table column. Column is the index of the column
+ * in dirty_state, which is offset by 1. */
+int32_t flecs_table_get_chunk_dirty_state(
+    const ecs_table_t *table,
+    int32_t column,
+    int32_t chunk);
 
 void flecs_table_notify(
     ecs_world_t *world,
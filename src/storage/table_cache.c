@@ -66,12 +66,54 @@ void flecs_table_cache_list_insert(
         ECS_INTERNAL_ERROR, NULL);
 }
 
+static
+void flecs_table_cache_bitset_set(
+    ecs_table_cache_t *cache,
+    uint64_t table_id,
+    bool value)
+{
+    /* Strip generation from table id */
+    int32_t elem = flecs_uto(int32_t, (uint32_t)table_id);
+    if (!value && elem >= cache->table_ids.count) {
+        return;
+    }
+
+    flecs_bitset_ensure(&cache->table_ids, elem + 1);
+    flecs_bitset_set(&cache->table_ids, elem, value);
+}
+
+/* Caches with many tables keep a set with the ids of their tables. Queries use
+ * the sets of their terms to discard tables that don't have all components with
+ * a bit test, before looking up table records. The set is created once the
+ * cache reaches FLECS_TABLE_CACHE_BITSET_MIN tables, so that the large number
+ * of component records with only a few tables don't pay for it. */
+static
+void flecs_table_cache_bitset_insert(
+    ecs_table_cache_t *cache,
+    const ecs_table_t *table)
+{
+    if (cache->table_ids.data) {
+        flecs_table_cache_bitset_set(cache, table->id, true);
+        return;
+    }
+
+    if (cache->tables.count < FLECS_TABLE_CACHE_BITSET_MIN) {
+        return;
+    }
+
+    ecs_table_cache_hdr_t *cur = cache->tables.first;
+    for (; cur; cur = cur->next) {
+        flecs_table_cache_bitset_set(cache, cur->table->id, true);
+    }
+}
+
 void ecs_table_cache_init(
     ecs_world_t *world,
     ecs_table_cache_t *cache)
 {
     ecs_assert(cache != NULL, ECS_INTERNAL_ERROR, NULL);
     ecs_map_init(&cache->index, &world->allocator);
+    flecs_bitset_init(&cache->table_ids);
 }
 
 void ecs_table_cache_fini(
@@ -79,6 +121,7 @@ void ecs_table_cache_fini(
 {
     ecs_assert(cache != NULL, ECS_INTERNAL_ERROR, NULL);
     ecs_map_fini(&cache->index);
+    flecs_bitset_fini(&cache->table_ids);
 }
 
 void ecs_table_cache_insert(
@@ -98,6 +141,7 @@ void ecs_table_cache_insert(
 
     ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
     ecs_map_insert_ptr(&cache->index, table->id, result);
+    flecs_table_cache_bitset_insert(cache, table);
 
     ecs_assert(cache->tables.first != NULL, ECS_INTERNAL_ERROR, NULL);
 }
@@ -159,6 +203,9 @@ void* ecs_table_cache_remove(
 
     flecs_table_cache_list_remove(cache, elem);
     ecs_map_remove(&cache->index, table_id);
+    if (cache->table_ids.data) {
+        flecs_table_cache_bitset_set(cache, table_id, false);
+    }
 
     return elem;
 }
@@ -13,10 +13,14 @@ typedef struct ecs_table_cache_list_t {
     int32_t count;
 } ecs_table_cache_list_t;
 
+/** Number of tables after which a table cache starts tracking a table id set */
+#define FLECS_TABLE_CACHE_BITSET_MIN (32)
+
 /** Table cache */
 typedef struct ecs_table_cache_t {
     ecs_map_t index; /* <table_id, T*> */
     ecs_table_cache_list_t tables;
+    ecs_bitset_t table_ids; /* Ids of tables in cache, for caches with many tables */
 } ecs_table_cache_t;
 
 void ecs_table_cache_init(
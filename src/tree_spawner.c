@@ -218,6 +218,34 @@ EcsTreeSpawner* flecs_prefab_spawner_build(
     return ts;
 }
 
+/* Get spawner children for the depth of the instance table. */
+static
+ecs_vec_t* flecs_spawner_get_depth(
+    ecs_world_t *world,
+    EcsTreeSpawner *spawner,
+    ecs_table_t *instance_table,
+    ecs_vec_t *tmp_vec)
+{
+    int32_t depth = flecs_relation_depth(world, EcsChildOf, instance_table);
+    int32_t child_count = ecs_vec_count(&spawner->data[0].children);
+
+    /* Use cached spawner for depth if available. */
+    ecs_vec_t *vec;
+    if (depth < FLECS_TREE_SPAWNER_DEPTH_CACHE_SIZE) {
+        vec = &spawner->data[depth].children;
+    } else {
+        vec = tmp_vec;
+        ecs_vec_init_t(NULL, vec, ecs_tree_spawner_child_t, 0);
+    }
+
+    if (depth && ecs_vec_count(vec) != child_count) {
+        /* Vector for depth is not yet initialized, create it. */
+        flecs_spawner_transpose_depth(world, spawner, vec, depth);
+    }
+
+    return vec;
+}
+
 void flecs_spawner_instantiate(
     ecs_world_t *world,
     EcsTreeSpawner *spawner,
@@ -226,7 +254,6 @@ void flecs_spawner_instantiate(
     const ecs_instantiate_ctx_t *ctx)
 {
     ecs_record_t *r_instance = flecs_entities_get(world, instance);
-    int32_t depth = flecs_relation_depth(world, EcsChildOf, r_instance->table);
     int32_t i, child_count = ecs_vec_count(&spawner->data[0].children);
 
     bool is_prefab = r_instance->table->flags & EcsTableIsPrefab;
@@ -236,19 +263,9 @@ void flecs_spawner_instantiate(
         ctx_cur = *ctx;
     }
 
-    /* Use cached spawner for depth if available. */
-    ecs_vec_t *vec, tmp_vec;
-    if (depth < FLECS_TREE_SPAWNER_DEPTH_CACHE_SIZE) {
-        vec = &spawner->data[depth].children;
-    } else {
-        vec = &tmp_vec;
-        ecs_vec_init_t(NULL, vec, ecs_tree_spawner_child_t, 0);
-    }
-
-    if (depth && ecs_vec_count(vec) != child_count) {
-        /* Vector for depth is not yet initialized, create it. */
-        flecs_spawner_transpose_depth(world, spawner, vec, depth);
-    }
+    ecs_vec_t tmp_vec;
+    ecs_vec_t *vec = flecs_spawner_get_depth(
+        world, spawner, r_instance->table, &tmp_vec);
 
     ecs_tree_spawner_child_t *spawn_children = ecs_vec_first(vec);
     ecs_vec_set_min_count_t(&world->allocator, &world->allocators.tree_spawner,
@@ -340,6 +357,148 @@ void flecs_spawner_instantiate(
     }
 }
 
+/* Emit OnSet for the components of a prefab child for a range of instance 
+ * children. Sparse components are stored outside of the table and are copied
+ * for each instance child. */
+static
+void flecs_spawner_on_set_n(
+    ecs_world_t *world,
+    ecs_entity_t base_child,
+    ecs_table_t *base_child_table,
+    ecs_table_t *table,
+    int32_t row,
+    int32_t count)
+{
+    int32_t i, type_count = base_child_table->type.count;
+    ecs_type_t ids = {
+        .array = ecs_os_alloca_n(ecs_id_t, type_count)
+    };
+
+    const ecs_entity_t *entities = &ecs_table_entities(table)[row];
+    ecs_table_record_t *trs = base_child_table->_->records;
+    for (i = 0; i < type_count; i ++) {
+        ecs_component_record_t *cr = trs[i].hdr.cr;
+        const ecs_type_info_t *ti = cr->type_info;
+        if (!ti) {
+            continue;
+        }
+
+        if (cr->flags & EcsIdOnInstantiateDontInherit) {
+            continue;
+        }
+
+        if (cr->flags & EcsIdSparse) {
+            void *src_ptr = flecs_sparse_get(cr->sparse, ti->size, base_child);
+            ecs_assert(src_ptr != NULL, ECS_INTERNAL_ERROR, NULL);
+
+            int32_t j;
+            for (j = 0; j < count; j ++) {
+                void *dst_ptr = flecs_sparse_get(
+                    cr->sparse, ti->size, entities[j]);
+                ecs_assert(dst_ptr != NULL, ECS_INTERNAL_ERROR, NULL);
+                flecs_type_info_copy(dst_ptr, src_ptr, 1, ti);
+            }
+        }
+
+        ids.array[ids.count ++] = base_child_table->type.array[i];
+    }
+
+    if (ids.count) {
+        flecs_notify_on_set_ids(world, table, row, count, &ids);
+    }
+}
+
+void flecs_spawner_instantiate_n(
+    ecs_world_t *world,
+    EcsTreeSpawner *spawner,
+    ecs_entity_t base,
+    const ecs_entity_t *instances,
+    int32_t count)
+{
+    ecs_assert(count > 0, ECS_INTERNAL_ERROR, NULL);
+
+    /* Instances are created by the same operation, and are stored in the same
+     * table. This means that they also have the same depth. */
+    ecs_record_t *r_instance = flecs_entities_get(world, instances[0]);
+    ecs_assert(!(r_instance->table->flags & EcsTableIsPrefab), 
+        ECS_INTERNAL_ERROR, NULL);
+
+    ecs_vec_t tmp_vec;
+    ecs_vec_t *vec = flecs_spawner_get_depth(
+        world, spawner, r_instance->table, &tmp_vec);
+
+    int32_t i, k, child_count = ecs_vec_count(&spawner->data[0].children);
+    ecs_tree_spawner_child_t *spawn_children = ecs_vec_first(vec);
+    ecs_assert(ecs_vec_count(vec) == child_count, ECS_INTERNAL_ERROR, NULL);
+
+    /* Entities for the spawner child at index i are stored at offset 
+     * (i + 1) * count. The first count elements store the instances. */
+    ecs_vec_set_min_count_t(&world->allocator, &world->allocators.tree_spawner,
+        ecs_entity_t, (child_count + 1) * count);
+    ecs_entity_t *parents = ecs_vec_first(&world->allocators.tree_spawner);
+    ecs_os_memcpy_n(parents, instances, ecs_entity_t, count);
+
+    for (i = 0; i < child_count; i ++) {
+        ecs_tree_spawner_child_t *spawn_child = &spawn_children[i];
+        ecs_table_t *table = spawn_child->table;
+        ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+
+        ecs_entity_t *entities = &parents[(i + 1) * count];
+        ecs_entity_t *child_parents = &parents[spawn_child->parent_index * count];
+        for (k = 0; k < count; k ++) {
+            entities[k] = flecs_instantiate_alloc_child_id(
+                world, spawn_child->child, base, instances[k]);
+        }
+
+        /* Append all children for the spawner element in a single operation */
+        int32_t row = flecs_table_appendn(world, table, count, entities);
+
+        int32_t parent_column = table->component_map[ecs_id(EcsParent)];
+        ecs_assert(parent_column != 0, ECS_INTERNAL_ERROR, NULL);
+        EcsParent *parent_ptr = table->data.columns[parent_column - 1].data;
+        parent_ptr = &parent_ptr[row];
+        for (k = 0; k < count; k ++) {
+            ecs_assert(child_parents[k] != 0, ECS_INTERNAL_ERROR, NULL);
+            parent_ptr[k].value = child_parents[k];
+        }
+
+        ecs_table_diff_t table_diff = { 
+            .added = table->type,
+            .added_flags = table->flags & EcsTableAddEdgeFlags
+        };
+
+        flecs_actions_new(world, table, row, count, &table_diff, 
+            EcsEventNoOnSet, true, EcsWildcard);
+
+        for (k = 0; k < count; k ++) {
+            ecs_entity_t parent = child_parents[k];
+            ecs_component_record_t *cr = flecs_components_ensure(
+                world, ecs_childof(parent));
+            ecs_record_t *r = flecs_entities_get(world, entities[k]);
+            flecs_add_non_fragmenting_child_w_records(
+                world, parent, entities[k], cr, r);
+        }
+
+        ecs_record_t *spawn_r = flecs_entities_get_any(
+            world, spawn_child->child);
+        ecs_assert(spawn_r != NULL, ECS_INTERNAL_ERROR, NULL);
+
+        flecs_spawner_on_set_n(world, spawn_child->child, spawn_r->table, 
+            table, row, count);
+
+        if (spawn_r->row & EcsEntityHasDontFragment) {
+            for (k = 0; k < count; k ++) {
+                flecs_instantiate_dont_fragment(
+                    world, spawn_child->child, entities[k]);
+            }
+        }
+    }
+
+    if (vec == &tmp_vec) {
+        ecs_vec_fini_t(NULL, vec, ecs_tree_spawner_child_t);
+    }
+}
+
 void flecs_fini_tree_spawners(
     ecs_world_t *world)
 {
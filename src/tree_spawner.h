@@ -21,6 +21,15 @@ void flecs_spawner_instantiate(
     ecs_entity_t instance,
     const ecs_instantiate_ctx_t *ctx);
 
+/* Instantiate tree for multiple instances of the same prefab. Children are
+ * appended to each spawner table in a single operation. */
+void flecs_spawner_instantiate_n(
+    ecs_world_t *world,
+    EcsTreeSpawner *spawner,
+    ecs_entity_t base,
+    const ecs_entity_t *instances,
+    int32_t count);
+
 void flecs_fini_tree_spawners(
     ecs_world_t *world);
 
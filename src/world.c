@@ -184,6 +184,12 @@ const ecs_entity_t EcsDocUuid =                     FLECS_HI_COMPONENT_ID + 120;
 const ecs_entity_t ecs_id(EcsRest) =                FLECS_HI_COMPONENT_ID + 121;
 #endif
 
+/* Meta module member index */
+#ifdef FLECS_META
+const ecs_entity_t ecs_id(EcsMemberIndex) =         FLECS_HI_COMPONENT_ID + 122;
+const ecs_entity_t EcsIndexed =                     FLECS_HI_COMPONENT_ID + 123;
+#endif
+
 /* Max static id:
  * #define EcsFirstUserEntityId (FLECS_HI_COMPONENT_ID + 128) */
 
@@ -1033,6 +1039,7 @@ ecs_world_t *ecs_mini(void) {
     }
 
     ecs_map_init(&world->prefab_child_indices, a);
+    ecs_map_init(&world->query_caches, a);
 
     ecs_set_stage_count(world, 1);
     ecs_default_lookup_path[0] = EcsFlecsCore;
@@ -1340,6 +1347,7 @@ int ecs_fini(
     flecs_name_index_fini(&world->symbols);
     ecs_set_stage_count(world, 0);
     ecs_map_fini(&world->prefab_child_indices);
+    ecs_map_fini(&world->query_caches);
     ecs_vec_fini_t(&world->allocator, &world->component_ids, ecs_id_t);
     ecs_log_pop_1();
 
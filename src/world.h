@@ -153,6 +153,9 @@ struct ecs_world_t {
     /* Index of prefab children in ordered children vector. Used by ecs_get_target. */
     ecs_map_t prefab_child_indices;
 
+    /* Query caches that can be shared between queries with identical terms */
+    ecs_map_t query_caches;          /* map<hash, ecs_query_cache_t*> */
+
     /* Internal callback for command inspection. Only one callback can be set at
      * a time. After assignment, the action will become active at the start of
      * the next frame, set by ecs_frame_begin, and will be reset by
@@ -168,6 +171,8 @@ struct ecs_world_t {
     ecs_os_mutex_t sync_mutex;       /* Mutex for job_cond */
     int32_t workers_running;         /* Number of threads running */
     int32_t workers_waiting;         /* Number of workers waiting on sync */
+    int32_t workers_parked;          /* Number of workers blocked on worker_cond */
+    int32_t workers_sync_gen;        /* Incremented when workers can resume */
     ecs_pipeline_state_t* pq;        /* Pointer to the pipeline for the workers to execute */
     bool workers_use_task_api;       /* Workers are short-lived tasks, not long-running threads */
 
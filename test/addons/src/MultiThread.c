@@ -14,6 +14,9 @@ void set_worker_kind(ecs_world_t *world, int32_t thread_count) {
         ecs_set_threads(world, thread_count);
     } else if (!strcmp(worker_kind, "task")) {
         ecs_set_task_threads(world, thread_count);
+    } else if (!strcmp(worker_kind, "stealing")) {
+        ecs_set_threads(world, thread_count);
+        ecs_set_work_stealing(world, true);
     }
 }
 
@@ -1386,3 +1389,1225 @@ void MultiThread_run_single_thread_on_main(void) {
 
     ecs_fini(world);
 }
+
+void MultiThread_stealing_uneven_tables(void) {
+    ecs_world_t *world = init_world();
+
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+    ECS_TAG(world, TagC);
+
+    int i, ENTITIES = 5000, THREADS = 4;
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0}));
+        if (i < 10) {
+            ecs_add(world, handles[i], TagA);
+        } else if (i < 13) {
+            ecs_add(world, handles[i], TagB);
+        } else if (i < 14) {
+            ecs_add(world, handles[i], TagC);
+        }
+    }
+
+    set_worker_kind(world, THREADS);
+    ecs_set_work_stealing(world, true);
+
+    ecs_progress(world, 0);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 1);
+    }
+
+    ecs_progress(world, 0);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 2);
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+void MultiThread_stealing_many_small_tables(void) {
+    ecs_world_t *world = init_world();
+
+    int i, ENTITIES = 300, THREADS = 8;
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0}));
+        ecs_add_id(world, handles[i], ecs_new(world));
+    }
+
+    set_worker_kind(world, THREADS);
+    ecs_set_work_stealing(world, true);
+
+    int32_t frame;
+    for (frame = 1; frame <= 3; frame ++) {
+        ecs_progress(world, 0);
+
+        for (i = 0; i < ENTITIES; i ++) {
+            test_int(ecs_get(world, handles[i], Position)->x, frame);
+        }
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+static
+void ProgressRun(ecs_iter_t *it) {
+    while (ecs_iter_next(it)) {
+        Progress(it);
+    }
+}
+
+void MultiThread_stealing_w_run_callback(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_TAG_DEFINE(world, Tag);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position) }},
+        .multi_threaded = true,
+        .run = ProgressRun
+    });
+
+    int i, ENTITIES = 1000, THREADS = 4;
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0}));
+        if (i % 3) {
+            ecs_add(world, handles[i], Tag);
+        }
+    }
+
+    set_worker_kind(world, THREADS);
+    ecs_set_work_stealing(world, true);
+
+    ecs_progress(world, 0);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 1);
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+void MultiThread_chunk_size_uneven_tables(void) {
+    ecs_world_t *world = init_world();
+
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    ecs_entity_t system = ecs_lookup(world, "Progress");
+    test_assert(system != 0);
+    ecs_system_update(world, system, &(ecs_system_desc_t){
+        .chunk_size = 64
+    });
+
+    int i, ENTITIES = 5000, THREADS = 4;
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0}));
+        if (i < 10) {
+            ecs_add(world, handles[i], TagA);
+        } else if (i < 13) {
+            ecs_add(world, handles[i], TagB);
+        }
+    }
+
+    set_worker_kind(world, THREADS);
+
+    ecs_progress(world, 0);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 1);
+    }
+
+    ecs_progress(world, 0);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 2);
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+void MultiThread_chunk_size_1(void) {
+    ecs_world_t *world = init_world();
+
+    ecs_entity_t system = ecs_lookup(world, "Progress");
+    test_assert(system != 0);
+    ecs_system_update(world, system, &(ecs_system_desc_t){
+        .chunk_size = 1
+    });
+
+    int i, ENTITIES = 100, THREADS = 8;
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0}));
+        ecs_add_id(world, handles[i], ecs_new(world));
+    }
+
+    set_worker_kind(world, THREADS);
+
+    for (int f = 1; f <= 3; f ++) {
+        ecs_progress(world, 0);
+
+        for (i = 0; i < ENTITIES; i ++) {
+            test_int(ecs_get(world, handles[i], Position)->x, f);
+        }
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+void MultiThread_chunk_size_w_run_callback(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_TAG_DEFINE(world, Tag);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position) }},
+        .multi_threaded = true,
+        .chunk_size = 50,
+        .run = ProgressRun
+    });
+
+    int i, ENTITIES = 1000, THREADS = 4;
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0}));
+        if (!(i % 3)) {
+            ecs_add(world, handles[i], Tag);
+        }
+    }
+
+    set_worker_kind(world, THREADS);
+
+    ecs_progress(world, 0);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 1);
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+static ECS_COMPONENT_DECLARE(Velocity);
+static ECS_COMPONENT_DECLARE(Mass);
+
+static
+void ConcurrentIncPosition(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    for (int i = 0; i < it->count; i ++) {
+        p[i].x ++;
+    }
+    *(int32_t*)it->ctx = ecs_stage_get_id(it->world);
+}
+
+static
+void ConcurrentIncVelocity(ecs_iter_t *it) {
+    Velocity *v = ecs_field(it, Velocity, 0);
+    for (int i = 0; i < it->count; i ++) {
+        v[i].x ++;
+    }
+    *(int32_t*)it->ctx = ecs_stage_get_id(it->world);
+}
+
+static
+void ConcurrentIncMass(ecs_iter_t *it) {
+    Mass *m = ecs_field(it, Mass, 0);
+    for (int i = 0; i < it->count; i ++) {
+        m[i] ++;
+    }
+    *(int32_t*)it->ctx = ecs_stage_get_id(it->world);
+}
+
+static
+void ConcurrentCopyPosition(ecs_iter_t *it) {
+    const Position *p = ecs_field(it, Position, 0);
+    Velocity *v = ecs_field(it, Velocity, 1);
+    for (int i = 0; i < it->count; i ++) {
+        v[i].x = p[i].x;
+    }
+    *(int32_t*)it->ctx = ecs_stage_get_id(it->world);
+}
+
+static
+void ConcurrentTask(ecs_iter_t *it) {
+    *(int32_t*)it->ctx = ecs_stage_get_id(it->world);
+}
+
+static
+void ConcurrentAddTag(ecs_iter_t *it) {
+    for (int i = 0; i < it->count; i ++) {
+        ecs_add(it->world, it->entities[i], Tag);
+    }
+    *(int32_t*)it->ctx = ecs_stage_get_id(it->world);
+}
+
+static
+ecs_world_t* init_concurrent_world(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_COMPONENT_DEFINE(world, Velocity);
+    ECS_COMPONENT_DEFINE(world, Mass);
+    ECS_TAG_DEFINE(world, Tag);
+    return world;
+}
+
+void MultiThread_concurrent_systems_disjoint(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    int32_t stages[3] = {-1, -1, -1};
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position) }},
+        .concurrent = true,
+        .callback = ConcurrentIncPosition,
+        .ctx = &stages[0]
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Velocity) }},
+        .concurrent = true,
+        .callback = ConcurrentIncVelocity,
+        .ctx = &stages[1]
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Mass) }},
+        .concurrent = true,
+        .callback = ConcurrentIncMass,
+        .ctx = &stages[2]
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {0}), 
+        ecs_value(Velocity, {0}), ecs_value(Mass, {0}));
+
+    set_worker_kind(world, 3);
+    ecs_set_concurrent_systems(world, true);
+
+    ecs_progress(world, 0);
+
+    test_int(ecs_get(world, e, Position)->x, 1);
+    test_int(ecs_get(world, e, Velocity)->x, 1);
+    test_int(*ecs_get(world, e, Mass), 1);
+
+    test_assert(stages[0] != stages[1]);
+    test_assert(stages[0] != stages[2]);
+    test_assert(stages[1] != stages[2]);
+
+    ecs_progress(world, 0);
+
+    test_int(ecs_get(world, e, Position)->x, 2);
+    test_int(ecs_get(world, e, Velocity)->x, 2);
+    test_int(*ecs_get(world, e, Mass), 2);
+
+    ecs_fini(world);
+}
+
+void MultiThread_concurrent_systems_conflicting(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    int32_t stages[3] = {-1, -1, -1};
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position) }},
+        .concurrent = true,
+        .callback = ConcurrentIncPosition,
+        .ctx = &stages[0]
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Mass) }},
+        .concurrent = true,
+        .callback = ConcurrentIncMass,
+        .ctx = &stages[2]
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {
+            { ecs_id(Position), .inout = EcsIn },
+            { ecs_id(Velocity), .inout = EcsOut }
+        },
+        .concurrent = true,
+        .callback = ConcurrentCopyPosition,
+        .ctx = &stages[1]
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {0}), 
+        ecs_value(Velocity, {0}), ecs_value(Mass, {0}));
+
+    set_worker_kind(world, 2);
+    ecs_set_concurrent_systems(world, true);
+
+    for (int i = 1; i <= 3; i ++) {
+        ecs_progress(world, 0);
+
+        test_int(ecs_get(world, e, Position)->x, i);
+        test_int(ecs_get(world, e, Velocity)->x, i);
+        test_int(*ecs_get(world, e, Mass), i);
+
+        test_int(stages[0], stages[1]);
+        test_assert(stages[0] != stages[2]);
+    }
+
+    ecs_fini(world);
+}
+
+void MultiThread_concurrent_systems_w_task(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    int32_t stages[3] = {-1, -1, -1};
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position) }},
+        .concurrent = true,
+        .callback = ConcurrentIncPosition,
+        .ctx = &stages[0]
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .concurrent = true,
+        .callback = ConcurrentTask,
+        .ctx = &stages[1]
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Velocity) }},
+        .concurrent = true,
+        .callback = ConcurrentIncVelocity,
+        .ctx = &stages[2]
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {0}), 
+        ecs_value(Velocity, {0}));
+
+    set_worker_kind(world, 2);
+    ecs_set_concurrent_systems(world, true);
+
+    ecs_progress(world, 0);
+
+    test_int(ecs_get(world, e, Position)->x, 1);
+    test_int(ecs_get(world, e, Velocity)->x, 1);
+
+    /* A system without terms can access anything, so nothing runs 
+     * concurrently with it. */
+    test_int(stages[0], 0);
+    test_int(stages[1], 0);
+    test_int(stages[2], 0);
+
+    ecs_fini(world);
+}
+
+void MultiThread_concurrent_systems_w_commands(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    int32_t stages[2] = {-1, -1};
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position) }},
+        .concurrent = true,
+        .callback = ConcurrentAddTag,
+        .ctx = &stages[0]
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Velocity) }},
+        .concurrent = true,
+        .callback = ConcurrentAddTag,
+        .ctx = &stages[1]
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {0}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Velocity, {0}));
+
+    set_worker_kind(world, 2);
+    ecs_set_concurrent_systems(world, true);
+
+    ecs_progress(world, 0);
+
+    test_assert(stages[0] != stages[1]);
+    test_assert(ecs_has(world, e1, Tag));
+    test_assert(ecs_has(world, e2, Tag));
+
+    ecs_fini(world);
+}
+
+static
+void ConcurrentNew(ecs_iter_t *it) {
+    ecs_entity_t *e = it->ctx;
+    *e = ecs_new(it->world);
+}
+
+void MultiThread_concurrent_systems_w_new_excluded(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    int32_t stages[2] = {-1, -1};
+    ecs_entity_t created = 0;
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position) }},
+        .concurrent = true,
+        .callback = ConcurrentIncPosition,
+        .ctx = &stages[0]
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Velocity) }},
+        .callback = ConcurrentNew,
+        .ctx = &created
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Mass) }},
+        .concurrent = true,
+        .callback = ConcurrentIncMass,
+        .ctx = &stages[1]
+    });
+
+    ecs_insert(world, ecs_value(Position, {0}));
+    ecs_insert(world, ecs_value(Velocity, {0}));
+    ecs_insert(world, ecs_value(Mass, {0}));
+
+    set_worker_kind(world, 2);
+    ecs_set_concurrent_systems(world, true);
+
+    ecs_progress(world, 0);
+
+    test_assert(created != 0);
+    test_assert(ecs_is_alive(world, created));
+    test_int(stages[0], 0);
+    test_int(stages[1], 0);
+
+    ecs_fini(world);
+}
+
+void MultiThread_concurrent_systems_disabled(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    int32_t stages[2] = {-1, -1};
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = ConcurrentIncPosition,
+        .ctx = &stages[0]
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Velocity) }},
+        .callback = ConcurrentIncVelocity,
+        .ctx = &stages[1]
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {0}), 
+        ecs_value(Velocity, {0}));
+
+    set_worker_kind(world, 2);
+
+    ecs_progress(world, 0);
+
+    test_int(ecs_get(world, e, Position)->x, 1);
+    test_int(ecs_get(world, e, Velocity)->x, 1);
+    test_int(stages[0], 0);
+    test_int(stages[1], 0);
+
+    ecs_fini(world);
+}
+
+typedef struct {
+    uint64_t group;
+    float prev;
+    int32_t count;
+    bool sorted;
+    bool grouped;
+} sorted_query_ctx_t;
+
+static
+int compare_position_x(
+    ecs_entity_t e1,
+    const void *ptr1,
+    ecs_entity_t e2,
+    const void *ptr2)
+{
+    (void)e1; (void)e2;
+    const Position *p1 = ptr1;
+    const Position *p2 = ptr2;
+    return (p1->x > p2->x) - (p1->x < p2->x);
+}
+
+static
+void SortedScramble(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    for (int i = 0; i < it->count; i ++) {
+        p[i].x = (float)((it->entities[i] * 31 + (uint64_t)
+            ecs_get_world_info(it->real_world)->frame_count_total * 17) % 997);
+    }
+}
+
+static
+void SortedCheck(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    sorted_query_ctx_t *ctx = it->ctx;
+    uint64_t group = ctx->grouped ? ecs_field_id(it, 1) : 0;
+    if (ctx->group != group) {
+        ctx->group = group;
+        ctx->prev = -1;
+    }
+
+    for (int i = 0; i < it->count; i ++) {
+        if (p[i].x < ctx->prev) {
+            ctx->sorted = false;
+        }
+        ctx->prev = p[i].x;
+    }
+
+    ctx->count += it->count;
+}
+
+static
+void SortedCheckRows(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    sorted_query_ctx_t *ctx = it->ctx;
+    for (int i = 1; i < it->count; i ++) {
+        if (p[i].x < p[i - 1].x) {
+            ctx->sorted = false;
+        }
+    }
+
+    ecs_os_ainc(&ctx->count);
+}
+
+static
+ecs_entity_t* sorted_query_entities(
+    ecs_world_t *world,
+    int32_t count,
+    int32_t table_count)
+{
+    ecs_entity_t *tags = ecs_os_malloc_n(ecs_entity_t, table_count);
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, count);
+    for (int i = 0; i < table_count; i ++) {
+        tags[i] = ecs_new(world);
+    }
+
+    for (int i = 0; i < count; i ++) {
+        handles[i] = ecs_new_w_id(world, tags[i % table_count]);
+        ecs_set(world, handles[i], Position, {(float)(count - i), 0});
+    }
+
+    ecs_os_free(tags);
+    return handles;
+}
+
+void MultiThread_sorted_query(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    sorted_query_ctx_t ctx = {0};
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position), .inout = EcsOut }},
+        .multi_threaded = true,
+        .callback = SortedScramble
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnStore) )}),
+        .query.terms = {{ ecs_id(Position), .inout = EcsIn }},
+        .query.order_by = ecs_id(Position),
+        .query.order_by_callback = compare_position_x,
+        .callback = SortedCheck,
+        .ctx = &ctx
+    });
+
+    int ENTITIES = 2000, THREADS = 4;
+    ecs_entity_t *handles = sorted_query_entities(world, ENTITIES, 8);
+
+    set_worker_kind(world, THREADS);
+
+    for (int f = 0; f < 3; f ++) {
+        ctx.group = 0;
+        ctx.prev = -1;
+        ctx.count = 0;
+        ctx.sorted = true;
+
+        ecs_progress(world, 0);
+
+        test_int(ctx.count, ENTITIES);
+        test_bool(ctx.sorted, true);
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+void MultiThread_sorted_query_multi_threaded(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    sorted_query_ctx_t ctx = {0};
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position), .inout = EcsOut }},
+        .multi_threaded = true,
+        .callback = SortedScramble
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnStore) )}),
+        .query.terms = {{ ecs_id(Position), .inout = EcsIn }},
+        .query.order_by = ecs_id(Position),
+        .query.order_by_callback = compare_position_x,
+        .multi_threaded = true,
+        .callback = SortedCheckRows,
+        .ctx = &ctx
+    });
+
+    int ENTITIES = 2000, THREADS = 4;
+    ecs_entity_t *handles = sorted_query_entities(world, ENTITIES, 8);
+
+    set_worker_kind(world, THREADS);
+
+    for (int f = 0; f < 3; f ++) {
+        ctx.count = 0;
+        ctx.sorted = true;
+
+        ecs_progress(world, 0);
+
+        test_assert(ctx.count != 0);
+        test_bool(ctx.sorted, true);
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+void MultiThread_sorted_query_w_group_by(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    ECS_TAG(world, Rel);
+
+    sorted_query_ctx_t ctx = { .grouped = true };
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position), .inout = EcsOut }},
+        .multi_threaded = true,
+        .callback = SortedScramble
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnStore) )}),
+        .query.terms = {
+            { ecs_id(Position), .inout = EcsIn },
+            { ecs_pair(Rel, EcsWildcard) }
+        },
+        .query.order_by = ecs_id(Position),
+        .query.order_by_callback = compare_position_x,
+        .query.group_by = Rel,
+        .callback = SortedCheck,
+        .ctx = &ctx
+    });
+
+    int i, ENTITIES = 2000, THREADS = 4;
+    ecs_entity_t groups[] = {
+        ecs_new(world), ecs_new(world), ecs_new(world), ecs_new(world) };
+    ecs_entity_t *handles = sorted_query_entities(world, ENTITIES, 8);
+    for (i = 0; i < ENTITIES; i ++) {
+        ecs_add_pair(world, handles[i], Rel, groups[i % 4]);
+    }
+
+    set_worker_kind(world, THREADS);
+
+    for (int f = 0; f < 3; f ++) {
+        ctx.group = 0;
+        ctx.prev = -1;
+        ctx.count = 0;
+        ctx.sorted = true;
+
+        ecs_progress(world, 0);
+
+        test_int(ctx.count, ENTITIES);
+        test_bool(ctx.sorted, true);
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+static
+void LevelsIncPosition(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    for (int i = 0; i < it->count; i ++) {
+        p[i].x ++;
+    }
+}
+
+static
+void LevelsTransform(ecs_iter_t *it) {
+    const Position *p = ecs_field(it, Position, 0);
+    Velocity *v = ecs_field(it, Velocity, 1);
+    const Velocity *parent = ecs_field(it, Velocity, 2);
+    for (int i = 0; i < it->count; i ++) {
+        v[i].x = p[i].x;
+        if (parent) {
+            v[i].x += parent->x;
+        }
+    }
+}
+
+static
+ecs_entity_t parallel_levels_node(
+    ecs_world_t *world,
+    ecs_entity_t parent,
+    ecs_entity_t tag,
+    int32_t depth)
+{
+    ecs_entity_t e = ecs_new_w_id(world, tag);
+    if (parent) {
+        ecs_add_pair(world, e, EcsChildOf, parent);
+    }
+    ecs_set(world, e, Position, {(float)depth, 0});
+    ecs_set(world, e, Velocity, {0, 0});
+    return e;
+}
+
+void MultiThread_parallel_levels_cascade(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position), .inout = EcsInOut }},
+        .multi_threaded = true,
+        .callback = LevelsIncPosition
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {
+            { ecs_id(Position), .inout = EcsIn },
+            { ecs_id(Velocity), .inout = EcsOut },
+            { ecs_id(Velocity), .src.id = EcsCascade, .oper = EcsOptional, 
+                .inout = EcsIn }
+        },
+        .multi_threaded = true,
+        .parallel_levels = true,
+        .callback = LevelsTransform
+    });
+
+    ecs_entity_t tags[] = { ecs_new(world), ecs_new(world), ecs_new(world) };
+
+    int i, j, k, ROOTS = 4, CHILDREN = 20, GRAND_CHILDREN = 10, THREADS = 4;
+    int32_t count = ROOTS * (1 + CHILDREN * (1 + GRAND_CHILDREN));
+    ecs_entity_t *leafs = ecs_os_malloc_n(ecs_entity_t, count);
+    int32_t leaf_count = 0;
+
+    for (i = 0; i < ROOTS; i ++) {
+        ecs_entity_t root = parallel_levels_node(world, 0, tags[0], 0);
+        for (j = 0; j < CHILDREN; j ++) {
+            ecs_entity_t child = parallel_levels_node(
+                world, root, tags[j % 3], 1);
+            for (k = 0; k < GRAND_CHILDREN; k ++) {
+                leafs[leaf_count ++] = parallel_levels_node(
+                    world, child, tags[k % 3], 2);
+            }
+        }
+    }
+
+    set_worker_kind(world, THREADS);
+
+    for (int f = 1; f <= 3; f ++) {
+        ecs_progress(world, 0);
+
+        /* Leaf value is sum of positions of itself, its parent and its root */
+        for (i = 0; i < leaf_count; i ++) {
+            const Velocity *v = ecs_get(world, leafs[i], Velocity);
+            test_assert(v != NULL);
+            test_int(v->x, (0 + f) + (1 + f) + (2 + f));
+        }
+    }
+
+    ecs_os_free(leafs);
+
+    ecs_fini(world);
+}
+
+static
+void LevelsTransformSlow(ecs_iter_t *it) {
+    /* Make the other threads wait long enough to block on the barrier */
+    if (!ecs_stage_get_id(it->world)) {
+        ecs_os_sleep(0, 5 * 1000 * 1000);
+    }
+
+    LevelsTransform(it);
+}
+
+void MultiThread_parallel_levels_slow_thread(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {
+            { ecs_id(Position), .inout = EcsIn },
+            { ecs_id(Velocity), .inout = EcsOut },
+            { ecs_id(Velocity), .src.id = EcsCascade, .oper = EcsOptional, 
+                .inout = EcsIn }
+        },
+        .multi_threaded = true,
+        .parallel_levels = true,
+        .callback = LevelsTransformSlow
+    });
+
+    int i, j, ROOTS = 8, CHILDREN = 8, THREADS = 4;
+    ecs_entity_t *leafs = ecs_os_malloc_n(ecs_entity_t, ROOTS * CHILDREN);
+    int32_t leaf_count = 0;
+
+    for (i = 0; i < ROOTS; i ++) {
+        ecs_entity_t root = parallel_levels_node(world, 0, Tag, 1);
+        for (j = 0; j < CHILDREN; j ++) {
+            leafs[leaf_count ++] = parallel_levels_node(world, root, Tag, 2);
+        }
+    }
+
+    set_worker_kind(world, THREADS);
+
+    ecs_progress(world, 0);
+
+    for (i = 0; i < leaf_count; i ++) {
+        const Velocity *v = ecs_get(world, leafs[i], Velocity);
+        test_assert(v != NULL);
+        test_int(v->x, 3);
+    }
+
+    ecs_os_free(leafs);
+
+    ecs_fini(world);
+}
+
+void MultiThread_parallel_levels_update_disable(void) {
+    ecs_world_t *world = init_concurrent_world();
+
+    ecs_entity_t system = ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {
+            { ecs_id(Position), .inout = EcsIn },
+            { ecs_id(Velocity), .inout = EcsOut },
+            { ecs_id(Velocity), .src.id = EcsCascade, .oper = EcsOptional, 
+                .inout = EcsIn }
+        },
+        .multi_threaded = true,
+        .parallel_levels = true,
+        .callback = LevelsTransform
+    });
+
+    test_bool(ecs_system_get(world, system)->parallel_levels, true);
+
+    ecs_system_update(world, system, &(ecs_system_desc_t){
+        .parallel_levels = -1
+    });
+    test_bool(ecs_system_get(world, system)->parallel_levels, false);
+
+    ecs_system_update(world, system, &(ecs_system_desc_t){
+        .multi_threaded = true
+    });
+    test_bool(ecs_system_get(world, system)->parallel_levels, false);
+
+    ecs_system_update(world, system, &(ecs_system_desc_t){
+        .parallel_levels = true
+    });
+    test_bool(ecs_system_get(world, system)->parallel_levels, true);
+
+    ecs_entity_t root = parallel_levels_node(world, 0, Tag, 1);
+    ecs_entity_t leaf = parallel_levels_node(world, root, Tag, 2);
+
+    set_worker_kind(world, 4);
+
+    ecs_progress(world, 0);
+
+    const Velocity *v = ecs_get(world, leaf, Velocity);
+    test_assert(v != NULL);
+    test_int(v->x, 3);
+
+    ecs_fini(world);
+}
+
+static
+void SortedIterOther(ecs_iter_t *it) {
+    ecs_query_t *q = it->ctx;
+    ecs_iter_t qit = ecs_query_iter(it->world, q);
+    while (ecs_query_next(&qit)) { }
+}
+
+void MultiThread_sorted_query_not_presorted(void) {
+    install_test_abort();
+
+    ecs_world_t *world = init_concurrent_world();
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Position), .inout = EcsIn }},
+        .order_by = ecs_id(Position),
+        .order_by_callback = compare_position_x,
+        .cache_kind = EcsQueryCacheAuto
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Velocity) }},
+        .multi_threaded = true,
+        .callback = SortedIterOther,
+        .ctx = q
+    });
+
+    ecs_insert(world, ecs_value(Position, {2, 0}));
+    ecs_insert(world, ecs_value(Position, {1, 0}));
+    ecs_insert(world, ecs_value(Velocity, {0, 0}));
+
+    set_worker_kind(world, 4);
+
+    /* Query isn't sorted by the pipeline, and has tables that need sorting */
+    test_expect_abort();
+    ecs_progress(world, 0);
+}
+
+void MultiThread_stealing_w_empty_tables(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_COMPONENT_DEFINE(world, Position);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position) }},
+        .query.flags = EcsQueryMatchEmptyTables,
+        .multi_threaded = true,
+        .callback = Progress
+    });
+
+    /* More results than there are slots in the work stealing ring, where
+     * every third result is an empty table. */
+    int i, ENTITIES = 48, THREADS = 4;
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0}));
+        ecs_add_id(world, handles[i], ecs_new(world));
+        if ((i % 3) == 1) {
+            ecs_delete(world, handles[i]);
+        }
+    }
+
+    set_worker_kind(world, THREADS);
+    ecs_set_work_stealing(world, true);
+
+    int32_t frame;
+    for (frame = 1; frame <= 3; frame ++) {
+        ecs_progress(world, 0);
+
+        for (i = 0; i < ENTITIES; i ++) {
+            if ((i % 3) == 1) {
+                continue;
+            }
+            test_int(ecs_get(world, handles[i], Position)->x, frame);
+        }
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+typedef struct {
+    int32_t value;
+} Score;
+
+typedef struct {
+    ecs_entity_t member;
+    int32_t max;
+    int32_t expect;
+    int32_t matched;
+    int32_t calls;
+} range_lookup_ctx_t;
+
+static
+void MemberIndexRange(ecs_iter_t *it) {
+    range_lookup_ctx_t *ctx = it->ctx;
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_range(it->world, 
+        ctx->member, &(ecs_member_range_t){ .max = &ctx->max, 
+            .max_exclusive = true }, &count);
+    if (count == ctx->expect && entities) {
+        ecs_os_ainc(&ctx->matched);
+    }
+    ecs_os_ainc(&ctx->calls);
+}
+
+void MultiThread_member_index_range_from_system(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t score = ecs_struct(world, {
+        .entity = ecs_entity(world, { .name = "Score" }),
+        .members = {{ "value", ecs_id(ecs_i32_t) }},
+        .create_member_entities = true
+    });
+
+    ecs_entity_t member = ecs_lookup(world, "Score.value");
+    test_assert(member != 0);
+    ecs_add_id(world, member, EcsIndexed);
+
+    int i, ENTITIES = 100;
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, ENTITIES);
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_new(world);
+        ecs_set_id(world, handles[i], score, sizeof(Score), &(Score){ i });
+    }
+
+    range_lookup_ctx_t ctx = { .member = member, .max = 50, .expect = 50 };
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ score, .inout = EcsIn }},
+        .multi_threaded = true,
+        .callback = MemberIndexRange,
+        .ctx = &ctx
+    });
+
+    set_worker_kind(world, 4);
+
+    ecs_progress(world, 0);
+    test_assert(ctx.calls > 0);
+    test_int(ctx.matched, ctx.calls);
+
+    /* Changed values are merged by the first lookup of the next frame */
+    for (i = 0; i < 10; i ++) {
+        ecs_set_id(world, handles[i], score, sizeof(Score), &(Score){ 100 });
+    }
+
+    ctx.expect = 40;
+    ctx.matched = 0;
+    ctx.calls = 0;
+    ecs_progress(world, 0);
+    test_assert(ctx.calls > 0);
+    test_int(ctx.matched, ctx.calls);
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ .max = &ctx.max, .max_exclusive = true }, 
+            &count);
+    test_int(count, 40);
+    test_uint(entities[0], handles[10]);
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+void MultiThread_chunk_size_reset(void) {
+    ecs_world_t *world = init_world();
+
+    ecs_entity_t system = ecs_lookup(world, "Progress");
+    test_assert(system != 0);
+    ecs_system_update(world, system, &(ecs_system_desc_t){
+        .chunk_size = 1
+    });
+
+    test_int(ecs_system_get(world, system)->chunk_size, 1);
+
+    ecs_system_update(world, system, &(ecs_system_desc_t){
+        .chunk_size = -1
+    });
+
+    test_int(ecs_system_get(world, system)->chunk_size, 0);
+
+    int i, ENTITIES = 100, THREADS = 4;
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0}));
+    }
+
+    set_worker_kind(world, THREADS);
+
+    ecs_progress(world, 0);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 1);
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
+
+void MultiThread_chunk_size_run_worker(void) {
+    ecs_world_t *world = init_world();
+
+    ecs_entity_t system = ecs_lookup(world, "Progress");
+    test_assert(system != 0);
+    ecs_system_update(world, system, &(ecs_system_desc_t){
+        .chunk_size = 10
+    });
+
+    int i, ENTITIES = 100;
+    ecs_entity_t *handles = ecs_os_malloc_n(ecs_entity_t, ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0}));
+    }
+
+    /* Each stage gets an equal part of the table */
+    ecs_run_worker(world, system, 0, 2, 0, NULL);
+
+    int32_t count = 0;
+    for (i = 0; i < ENTITIES; i ++) {
+        count += ecs_get(world, handles[i], Position)->x;
+    }
+    test_int(count, ENTITIES / 2);
+
+    ecs_run_worker(world, system, 1, 2, 0, NULL);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 1);
+    }
+
+    ecs_os_free(handles);
+
+    ecs_fini(world);
+}
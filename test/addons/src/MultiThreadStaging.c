@@ -396,3 +396,119 @@ void MultiThreadStaging_set_pair_w_new_target_tgt_component_defer(void) {
 
     ecs_fini(world);
 }
+
+static int bulk_instantiate_count = 0;
+
+static
+void BulkInstantiate(ecs_iter_t *it) {
+    ecs_entity_t prefab = *(ecs_entity_t*)it->ctx;
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        const ecs_entity_t *ids = ecs_bulk_instantiate(
+            it->world, prefab, bulk_instantiate_count);
+        test_assert(ids == NULL);
+    }
+}
+
+void MultiThreadStaging_bulk_instantiate_from_worker(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Spawner);
+
+    ecs_entity_t prefab = ecs_new_w_id(world, EcsPrefab);
+    ecs_set(world, prefab, Position, {10, 20});
+    ecs_entity_t child = ecs_new_w_pair(world, EcsChildOf, prefab);
+    ecs_set(world, child, Position, {1, 2});
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ Spawner }},
+        .callback = BulkInstantiate,
+        .ctx = &prefab,
+        .multi_threaded = true
+    });
+
+    int i;
+    for (i = 0; i < 4; i ++) {
+        ecs_add(world, ecs_new(world), Spawner);
+    }
+
+    ecs_set_threads(world, 2);
+
+    bulk_instantiate_count = 10;
+    ecs_progress(world, 0);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Position) }, { ecs_isa(prefab) }}
+    });
+
+    int32_t count = 0;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        Position *p = ecs_field(&it, Position, 0);
+        for (i = 0; i < it.count; i ++) {
+            test_int(p[i].x, 10);
+            test_int(p[i].y, 20);
+
+            int32_t child_count = 0;
+            ecs_iter_t cit = ecs_children(world, it.entities[i]);
+            while (ecs_children_next(&cit)) {
+                int j;
+                for (j = 0; j < cit.count; j ++) {
+                    const Position *cp = ecs_get(world, cit.entities[j], Position);
+                    test_assert(cp != NULL);
+                    test_int(cp->x, 1);
+                    test_int(cp->y, 2);
+                    child_count ++;
+                }
+            }
+            test_int(child_count, 1);
+            count ++;
+        }
+    }
+
+    test_int(count, 40);
+
+    ecs_query_fini(q);
+    ecs_fini(world);
+}
+
+static
+void BulkNewPosition(ecs_iter_t *it) {
+    ecs_id_t id = *(ecs_id_t*)it->ctx;
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        ecs_bulk_new_w_id(it->world, id, 10);
+    }
+}
+
+void MultiThreadStaging_bulk_new_from_worker(void) {
+    install_test_abort();
+
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Spawner);
+
+    ecs_id_t id = ecs_id(Position);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ Spawner }},
+        .callback = BulkNewPosition,
+        .ctx = &id,
+        .multi_threaded = true
+    });
+
+    int i;
+    for (i = 0; i < 4; i ++) {
+        ecs_add(world, ecs_new(world), Spawner);
+    }
+
+    ecs_set_threads(world, 2);
+
+    /* Only prefab instances can be created from a multithreaded system */
+    test_expect_abort();
+    ecs_progress(world, 0);
+}
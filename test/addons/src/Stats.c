@@ -283,3 +283,59 @@ void Stats_progress_stats_systems_w_empty_table_flag(void) {
 
     ecs_fini(world);
 }
+
+static void MoveSys(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    for (int i = 0; i < it->count; i ++) {
+        p[i].x ++;
+    }
+}
+
+void Stats_get_pipeline_stats_w_work_stealing(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .name = "MoveSys", .add = ecs_ids( ecs_dependson(EcsOnUpdate) )}),
+        .query.terms = {{ ecs_id(Position) }},
+        .multi_threaded = true,
+        .callback = MoveSys
+    });
+
+    for (int i = 0; i < 1000; i ++) {
+        ecs_entity_t e = ecs_insert(world, ecs_value(Position, {0}));
+        if (!(i % 100)) {
+            ecs_add_id(world, e, ecs_new(world));
+        }
+    }
+
+    ecs_set_threads(world, 4);
+    ecs_set_work_stealing(world, true);
+    ecs_measure_system_time(world, true);
+
+    ecs_entity_t pipeline = ecs_get_pipeline(world);
+    test_assert(pipeline != 0);
+
+    ecs_pipeline_stats_t stats = {0};
+    test_bool(ecs_pipeline_stats_get(world, pipeline, &stats), true);
+
+    ecs_progress(world, 0);
+
+    test_bool(ecs_pipeline_stats_get(world, pipeline, &stats), true);
+    int32_t t = (stats.t + ECS_STAT_WINDOW - 1) % ECS_STAT_WINDOW;
+    test_assert(stats.frame_time.counter.value[t] > 0);
+    test_assert(stats.sync_time.counter.value[t] > 0);
+    test_assert(stats.sync_time.counter.value[t] <= 
+        stats.frame_time.counter.value[t]);
+
+    test_int(ecs_vec_count(&stats.sync_points), 1);
+    ecs_sync_stats_t *sync = ecs_vec_first(&stats.sync_points);
+    test_bool(sync->multi_threaded, true);
+    test_assert(sync->wait_time.counter.value[t] >= 0);
+    test_assert(sync->tasks_stolen.counter.value[t] >= 0);
+
+    ecs_pipeline_stats_fini(&stats);
+
+    ecs_fini(world);
+}
@@ -340,6 +340,7 @@ void Stats_get_pipeline_stats_w_task_system(void);
 void Stats_get_not_alive_entity_count(void);
 void Stats_progress_stats_systems(void);
 void Stats_progress_stats_systems_w_empty_table_flag(void);
+void Stats_get_pipeline_stats_w_work_stealing(void);
 
 // Testsuite 'Memory'
 void Memory_query_memory_no_cache(void);
@@ -413,6 +414,29 @@ void MultiThread_bulk_new_in_no_readonly_w_multithread(void);
 void MultiThread_bulk_new_in_no_readonly_w_multithread_2(void);
 void MultiThread_run_first_worker_on_main(void);
 void MultiThread_run_single_thread_on_main(void);
+void MultiThread_stealing_uneven_tables(void);
+void MultiThread_stealing_many_small_tables(void);
+void MultiThread_stealing_w_run_callback(void);
+void MultiThread_chunk_size_uneven_tables(void);
+void MultiThread_chunk_size_1(void);
+void MultiThread_chunk_size_w_run_callback(void);
+void MultiThread_concurrent_systems_disjoint(void);
+void MultiThread_concurrent_systems_conflicting(void);
+void MultiThread_concurrent_systems_w_task(void);
+void MultiThread_concurrent_systems_w_commands(void);
+void MultiThread_concurrent_systems_disabled(void);
+void MultiThread_sorted_query(void);
+void MultiThread_sorted_query_multi_threaded(void);
+void MultiThread_sorted_query_w_group_by(void);
+void MultiThread_parallel_levels_cascade(void);
+void MultiThread_concurrent_systems_w_new_excluded(void);
+void MultiThread_parallel_levels_slow_thread(void);
+void MultiThread_sorted_query_not_presorted(void);
+void MultiThread_stealing_w_empty_tables(void);
+void MultiThread_parallel_levels_update_disable(void);
+void MultiThread_member_index_range_from_system(void);
+void MultiThread_chunk_size_reset(void);
+void MultiThread_chunk_size_run_worker(void);
 
 // Testsuite 'MultiThreadStaging'
 void MultiThreadStaging_setup(void);
@@ -425,6 +449,8 @@ void MultiThreadStaging_2_threads_on_add(void);
 void MultiThreadStaging_custom_thread_auto_merge(void);
 void MultiThreadStaging_set_pair_w_new_target_defer(void);
 void MultiThreadStaging_set_pair_w_new_target_tgt_component_defer(void);
+void MultiThreadStaging_bulk_instantiate_from_worker(void);
+void MultiThreadStaging_bulk_new_from_worker(void);
 
 // Testsuite 'Modules'
 void Modules_setup(void);
@@ -1840,6 +1866,10 @@ bake_test_case Stats_testcases[] = {
     {
         "progress_stats_systems_w_empty_table_flag",
         Stats_progress_stats_systems_w_empty_table_flag
+    },
+    {
+        "get_pipeline_stats_w_work_stealing",
+        Stats_get_pipeline_stats_w_work_stealing
     }
 };
 
@@ -2109,6 +2139,98 @@ bake_test_case MultiThread_testcases[] = {
     {
         "run_single_thread_on_main",
         MultiThread_run_single_thread_on_main
+    },
+    {
+        "stealing_uneven_tables",
+        MultiThread_stealing_uneven_tables
+    },
+    {
+        "stealing_many_small_tables",
+        MultiThread_stealing_many_small_tables
+    },
+    {
+        "stealing_w_run_callback",
+        MultiThread_stealing_w_run_callback
+    },
+    {
+        "chunk_size_uneven_tables",
+        MultiThread_chunk_size_uneven_tables
+    },
+    {
+        "chunk_size_1",
+        MultiThread_chunk_size_1
+    },
+    {
+        "chunk_size_w_run_callback",
+        MultiThread_chunk_size_w_run_callback
+    },
+    {
+        "concurrent_systems_disjoint",
+        MultiThread_concurrent_systems_disjoint
+    },
+    {
+        "concurrent_systems_conflicting",
+        MultiThread_concurrent_systems_conflicting
+    },
+    {
+        "concurrent_systems_w_task",
+        MultiThread_concurrent_systems_w_task
+    },
+    {
+        "concurrent_systems_w_commands",
+        MultiThread_concurrent_systems_w_commands
+    },
+    {
+        "concurrent_systems_disabled",
+        MultiThread_concurrent_systems_disabled
+    },
+    {
+        "sorted_query",
+        MultiThread_sorted_query
+    },
+    {
+        "sorted_query_multi_threaded",
+        MultiThread_sorted_query_multi_threaded
+    },
+    {
+        "sorted_query_w_group_by",
+        MultiThread_sorted_query_w_group_by
+    },
+    {
+        "parallel_levels_cascade",
+        MultiThread_parallel_levels_cascade
+    },
+    {
+        "concurrent_systems_w_new_excluded",
+        MultiThread_concurrent_systems_w_new_excluded
+    },
+    {
+        "parallel_levels_slow_thread",
+        MultiThread_parallel_levels_slow_thread
+    },
+    {
+        "sorted_query_not_presorted",
+        MultiThread_sorted_query_not_presorted
+    },
+    {
+        "stealing_w_empty_tables",
+        MultiThread_stealing_w_empty_tables
+    },
+    {
+        "parallel_levels_update_disable",
+        MultiThread_parallel_levels_update_disable
+    },
+    {
+        "member_index_range_from_system",
+        MultiThread_member_index_range_from_system
+    },
+    {
+        "chunk_size_reset",
+        MultiThread_chunk_size_reset
+    },
+    {
+        "chunk_size_run_worker",
+        MultiThread_chunk_size_run_worker
     }
 };
 
@@ -2148,6 +2270,14 @@ bake_test_case MultiThreadStaging_testcases[] = {
     {
         "set_pair_w_new_target_tgt_component_defer",
         MultiThreadStaging_set_pair_w_new_target_tgt_component_defer
+    },
+    {
+        "bulk_instantiate_from_worker",
+        MultiThreadStaging_bulk_instantiate_from_worker
+    },
+    {
+        "bulk_new_from_worker",
+        MultiThreadStaging_bulk_new_from_worker
     }
 };
 
@@ -2749,9 +2879,9 @@ bake_test_case Alerts_testcases[] = {
     }
 };
 
-const char* MultiThread_worker_kind_param[] = {"thread", "task"};
+const char* MultiThread_worker_kind_param[] = {"thread", "task", "stealing"};
 bake_test_param MultiThread_params[] = {
-    {"worker_kind", (char**)MultiThread_worker_kind_param, 2}
+    {"worker_kind", (char**)MultiThread_worker_kind_param, 3}
 };
 
 const char* MultiThreadStaging_worker_kind_param[] = {"thread", "task"};
@@ -2848,7 +2978,7 @@ static bake_test_suite suites[] = {
         "Stats",
         NULL,
         NULL,
-        13,
+        14,
         Stats_testcases
     },
     {
@@ -2869,7 +2999,7 @@ static bake_test_suite suites[] = {
         "MultiThread",
         MultiThread_setup,
         NULL,
-        50,
+        73,
         MultiThread_testcases,
         1,
         MultiThread_params
@@ -2878,7 +3008,7 @@ static bake_test_suite suites[] = {
         "MultiThreadStaging",
         MultiThreadStaging_setup,
         NULL,
-        9,
+        11,
         MultiThreadStaging_testcases,
         1,
         MultiThreadStaging_params
@@ -5362,3 +5362,378 @@ void Commands_set_existing_after_remove_2_stages(void) {
     ecs_fini(world);
 }
 
+
+void Commands_coalesce_add_tag(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e[16];
+    int i;
+    for (i = 0; i < 16; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, i * 2}));
+    }
+
+    ecs_defer_begin(world);
+    for (i = 0; i < 16; i += 2) {
+        ecs_add(world, e[i], Foo);
+    }
+    ecs_defer_end(world);
+
+    for (i = 0; i < 16; i ++) {
+        test_bool(ecs_has(world, e[i], Foo), (i % 2) == 0);
+        const Position *p = ecs_get(world, e[i], Position);
+        test_assert(p != NULL);
+        test_int(p->x, i);
+        test_int(p->y, i * 2);
+    }
+
+    ecs_table_t *table = ecs_get_table(world, e[0]);
+    test_int(ecs_table_count(table), 8);
+    table = ecs_get_table(world, e[1]);
+    test_int(ecs_table_count(table), 8);
+
+    ecs_fini(world);
+}
+
+void Commands_coalesce_remove_component(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e[16];
+    int i;
+    for (i = 0; i < 16; i ++) {
+        e[i] = ecs_insert(world, 
+            ecs_value(Position, {i, i * 2}), ecs_value(Velocity, {i, 0}));
+    }
+
+    ecs_defer_begin(world);
+    for (i = 0; i < 16; i ++) {
+        if (i % 3) {
+            ecs_remove(world, e[i], Velocity);
+        }
+    }
+    ecs_defer_end(world);
+
+    for (i = 0; i < 16; i ++) {
+        test_bool(ecs_has(world, e[i], Velocity), (i % 3) == 0);
+        const Position *p = ecs_get(world, e[i], Position);
+        test_assert(p != NULL);
+        test_int(p->x, i);
+        test_int(p->y, i * 2);
+        if (!(i % 3)) {
+            const Velocity *v = ecs_get(world, e[i], Velocity);
+            test_assert(v != NULL);
+            test_int(v->x, i);
+        }
+    }
+
+    ecs_fini(world);
+}
+
+void Commands_coalesce_add_w_observer(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    Probe ctx = {0};
+    ecs_set_ctx(world, &ctx, NULL);
+
+    ecs_observer(world, {
+        .query.terms = {{ Foo }, { ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = probe_iter
+    });
+
+    ecs_entity_t e[8];
+    int i;
+    for (i = 0; i < 8; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+    }
+
+    ecs_defer_begin(world);
+    for (i = 0; i < 8; i ++) {
+        ecs_add(world, e[i], Foo);
+    }
+    ecs_defer_end(world);
+
+    test_int(ctx.invoked, 1);
+    test_int(ctx.count, 8);
+    for (i = 0; i < 8; i ++) {
+        probe_has_entity(&ctx, e[i]);
+        test_assert(ecs_has(world, e[i], Foo));
+    }
+
+    ecs_fini(world);
+}
+
+static int coalesce_add_hook_invoked = 0;
+static int coalesce_remove_hook_invoked = 0;
+
+static
+void coalesce_add_hook(ecs_iter_t *it) {
+    coalesce_add_hook_invoked += it->count;
+}
+
+static
+void coalesce_remove_hook(ecs_iter_t *it) {
+    coalesce_remove_hook_invoked += it->count;
+}
+
+void Commands_coalesce_w_hooks(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_set_hooks(world, Velocity, {
+        .ctor = dummy_xtor,
+        .dtor = dummy_xtor,
+        .on_add = coalesce_add_hook,
+        .on_remove = coalesce_remove_hook
+    });
+
+    ecs_entity_t e[8];
+    int i;
+    for (i = 0; i < 8; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+    }
+
+    ecs_defer_begin(world);
+    for (i = 0; i < 8; i ++) {
+        ecs_add(world, e[i], Velocity);
+    }
+    ecs_defer_end(world);
+
+    test_int(coalesce_add_hook_invoked, 8);
+    test_int(coalesce_remove_hook_invoked, 0);
+
+    ecs_defer_begin(world);
+    for (i = 0; i < 8; i ++) {
+        ecs_remove(world, e[i], Velocity);
+    }
+    ecs_defer_end(world);
+
+    test_int(coalesce_add_hook_invoked, 8);
+    test_int(coalesce_remove_hook_invoked, 8);
+
+    for (i = 0; i < 8; i ++) {
+        test_assert(!ecs_has(world, e[i], Velocity));
+        const Position *p = ecs_get(world, e[i], Position);
+        test_assert(p != NULL);
+        test_int(p->x, i);
+    }
+
+    ecs_fini(world);
+}
+
+void Commands_coalesce_different_tables(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e[8];
+    int i;
+    for (i = 0; i < 8; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+        if (i % 2) {
+            ecs_set(world, e[i], Velocity, {i, 0});
+        }
+    }
+
+    ecs_defer_begin(world);
+    for (i = 0; i < 8; i ++) {
+        ecs_add(world, e[i], Foo);
+    }
+    ecs_defer_end(world);
+
+    for (i = 0; i < 8; i ++) {
+        test_assert(ecs_has(world, e[i], Foo));
+        test_bool(ecs_has(world, e[i], Velocity), (i % 2) == 1);
+        const Position *p = ecs_get(world, e[i], Position);
+        test_assert(p != NULL);
+        test_int(p->x, i);
+        if (i % 2) {
+            const Velocity *v = ecs_get(world, e[i], Velocity);
+            test_assert(v != NULL);
+            test_int(v->x, i);
+        }
+    }
+
+    ecs_fini(world);
+}
+
+void Commands_coalesce_interleaved_w_delete(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e[8];
+    int i;
+    for (i = 0; i < 8; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+    }
+
+    ecs_defer_begin(world);
+    for (i = 0; i < 4; i ++) {
+        ecs_add(world, e[i], Foo);
+    }
+    ecs_delete(world, e[4]);
+    for (i = 4; i < 8; i ++) {
+        ecs_add(world, e[i], Foo);
+    }
+    ecs_defer_end(world);
+
+    test_assert(!ecs_is_alive(world, e[4]));
+
+    for (i = 0; i < 8; i ++) {
+        if (i == 4) {
+            continue;
+        }
+        test_assert(ecs_has(world, e[i], Foo));
+        const Position *p = ecs_get(world, e[i], Position);
+        test_assert(p != NULL);
+        test_int(p->x, i);
+    }
+
+    ecs_fini(world);
+}
+
+void Commands_coalesce_add_remove_same_id(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+
+    ecs_entity_t e[8];
+    int i;
+    for (i = 0; i < 8; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+    }
+
+    ecs_defer_begin(world);
+    for (i = 0; i < 8; i ++) {
+        ecs_add(world, e[i], Foo);
+        if (i % 2) {
+            ecs_remove(world, e[i], Foo);
+        }
+        ecs_add(world, e[i], Bar);
+    }
+    ecs_defer_end(world);
+
+    for (i = 0; i < 8; i ++) {
+        test_bool(ecs_has(world, e[i], Foo), (i % 2) == 0);
+        test_assert(ecs_has(world, e[i], Bar));
+        const Position *p = ecs_get(world, e[i], Position);
+        test_assert(p != NULL);
+        test_int(p->x, i);
+    }
+
+    ecs_fini(world);
+}
+
+static ecs_entity_t coalesce_order[16];
+static int32_t coalesce_order_count = 0;
+
+static
+void coalesce_order_observer(ecs_iter_t *it) {
+    int32_t i;
+    for (i = 0; i < it->count; i ++) {
+        test_assert(coalesce_order_count < 16);
+        coalesce_order[coalesce_order_count ++] = it->entities[i];
+    }
+}
+
+void Commands_coalesce_preserve_order(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+
+    ecs_observer(world, {
+        .query.terms = {{ Foo, .oper = EcsOr }, { Bar }},
+        .events = { EcsOnAdd },
+        .callback = coalesce_order_observer
+    });
+
+    ecs_entity_t e[6];
+    int i;
+    for (i = 0; i < 6; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+    }
+
+    coalesce_order_count = 0;
+
+    ecs_defer_begin(world);
+    ecs_add(world, e[0], Foo);
+    ecs_add(world, e[1], Bar);
+    ecs_add(world, e[2], Foo);
+    ecs_add(world, e[3], Foo);
+    ecs_add(world, e[4], Bar);
+    ecs_add(world, e[5], Bar);
+    ecs_defer_end(world);
+
+    test_int(coalesce_order_count, 6);
+    for (i = 0; i < 6; i ++) {
+        test_uint(coalesce_order[i], e[i]);
+    }
+
+    for (i = 0; i < 6; i ++) {
+        const Position *p = ecs_get(world, e[i], Position);
+        test_assert(p != NULL);
+        test_int(p->x, i);
+    }
+
+    ecs_fini(world);
+}
+
+void Commands_coalesce_traversable(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e[8];
+    int i;
+    for (i = 0; i < 8; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+        ecs_new_w_pair(world, EcsChildOf, e[i]);
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ Foo, .src.id = EcsUp, .trav = EcsChildOf }},
+        .cache_kind = EcsQueryCacheAuto
+    });
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_int(ecs_iter_count(&it), 0);
+
+    ecs_defer_begin(world);
+    for (i = 0; i < 8; i ++) {
+        ecs_add(world, e[i], Foo);
+    }
+    ecs_defer_end(world);
+
+    it = ecs_query_iter(world, q);
+    test_int(ecs_iter_count(&it), 8);
+
+    for (i = 0; i < 8; i ++) {
+        test_assert(ecs_has(world, e[i], Foo));
+        const Position *p = ecs_get(world, e[i], Position);
+        test_assert(p != NULL);
+        test_int(p->x, i);
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
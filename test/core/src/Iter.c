@@ -2991,3 +2991,198 @@ void Iter_to_str(void) {
 
     ecs_fini(world);
 }
+
+void Iter_worker_chunk_iter_1(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Self);
+
+    ecs_entity_t e[5];
+    for (int i = 0; i < 5; i ++) {
+        e[i] = ecs_new(world); ecs_set(world, e[i], Self, {e[i]});
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Self) }}
+    });
+
+    int32_t cursor = 0;
+    ecs_iter_t it_1 = ecs_query_iter(world, q);
+    ecs_iter_t pit_1 = ecs_worker_chunk_iter(&it_1, 0, 2, &cursor, 2);
+    ecs_iter_t it_2 = ecs_query_iter(world, q);
+    ecs_iter_t pit_2 = ecs_worker_chunk_iter(&it_2, 1, 2, &cursor, 2);
+
+    {
+        test_bool(ecs_worker_chunk_next(&pit_1), true);
+        test_int(pit_1.count, 2);
+        test_int(pit_1.entities[0], e[0]);
+        test_int(pit_1.entities[1], e[1]);
+
+        Self *ptr = ecs_field(&pit_1, Self, 0);
+        test_assert(ptr != NULL);
+        test_int(ptr[0].value, e[0]);
+        test_int(ptr[1].value, e[1]);
+    }
+
+    {
+        test_bool(ecs_worker_chunk_next(&pit_2), true);
+        test_int(pit_2.count, 2);
+        test_int(pit_2.entities[0], e[2]);
+        test_int(pit_2.entities[1], e[3]);
+
+        Self *ptr = ecs_field(&pit_2, Self, 0);
+        test_assert(ptr != NULL);
+        test_int(ptr[0].value, e[2]);
+        test_int(ptr[1].value, e[3]);
+    }
+
+    {
+        test_bool(ecs_worker_chunk_next(&pit_2), true);
+        test_int(pit_2.count, 1);
+        test_int(pit_2.entities[0], e[4]);
+
+        Self *ptr = ecs_field(&pit_2, Self, 0);
+        test_assert(ptr != NULL);
+        test_int(ptr[0].value, e[4]);
+    }
+
+    test_bool(ecs_worker_chunk_next(&pit_1), false);
+    test_bool(ecs_worker_chunk_next(&pit_2), false);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Iter_worker_chunk_iter_w_tables(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Self);
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    ecs_entity_t e1 = ecs_new(world); ecs_set(world, e1, Self, {e1});
+    ecs_entity_t e2 = ecs_new(world); ecs_set(world, e2, Self, {e2});
+    ecs_entity_t e3 = ecs_new(world); ecs_set(world, e3, Self, {e3});
+    ecs_entity_t e4 = ecs_new(world); ecs_set(world, e4, Self, {e4});
+    ecs_entity_t e5 = ecs_new(world); ecs_set(world, e5, Self, {e5});
+
+    ecs_add(world, e3, TagA);
+    ecs_add(world, e4, TagA);
+    ecs_add(world, e5, TagB);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Self) }}
+    });
+
+    int32_t cursor = 0;
+    ecs_iter_t it_1 = ecs_query_iter(world, q);
+    ecs_iter_t pit_1 = ecs_worker_chunk_iter(&it_1, 0, 2, &cursor, 3);
+    ecs_iter_t it_2 = ecs_query_iter(world, q);
+    ecs_iter_t pit_2 = ecs_worker_chunk_iter(&it_2, 1, 2, &cursor, 3);
+
+    /* Chunk 0 spans the first two tables */
+    {
+        test_bool(ecs_worker_chunk_next(&pit_1), true);
+        test_int(pit_1.count, 2);
+        test_int(pit_1.entities[0], e1);
+        test_int(pit_1.entities[1], e2);
+    }
+
+    /* Chunk 1 starts in the second table and continues in the third */
+    {
+        test_bool(ecs_worker_chunk_next(&pit_2), true);
+        test_int(pit_2.count, 1);
+        test_int(pit_2.entities[0], e4);
+
+        Self *ptr = ecs_field(&pit_2, Self, 0);
+        test_assert(ptr != NULL);
+        test_int(ptr[0].value, e4);
+    }
+
+    {
+        test_bool(ecs_worker_chunk_next(&pit_1), true);
+        test_int(pit_1.count, 1);
+        test_int(pit_1.entities[0], e3);
+    }
+
+    {
+        test_bool(ecs_worker_chunk_next(&pit_2), true);
+        test_int(pit_2.count, 1);
+        test_int(pit_2.entities[0], e5);
+
+        Self *ptr = ecs_field(&pit_2, Self, 0);
+        test_assert(ptr != NULL);
+        test_int(ptr[0].value, e5);
+    }
+
+    test_bool(ecs_worker_chunk_next(&pit_1), false);
+    test_bool(ecs_worker_chunk_next(&pit_2), false);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Iter_worker_chunk_iter_w_task_query(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Self);
+
+    ecs_entity_t foo = ecs_new(world); ecs_set(world, foo, Self, {foo});
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Self), .src.id = foo }}
+    });
+
+    int32_t cursor = 0;
+    ecs_iter_t it_1 = ecs_query_iter(world, q);
+    ecs_iter_t pit_1 = ecs_worker_chunk_iter(&it_1, 0, 2, &cursor, 16);
+    ecs_iter_t it_2 = ecs_query_iter(world, q);
+    ecs_iter_t pit_2 = ecs_worker_chunk_iter(&it_2, 1, 2, &cursor, 16);
+
+    {
+        test_bool(ecs_worker_chunk_next(&pit_1), true);
+        test_int(pit_1.count, 0);
+        test_int(pit_1.ids[0], ecs_id(Self));
+        test_int(pit_1.sources[0], foo);
+
+        Self *ptr = ecs_field(&pit_1, Self, 0);
+        test_assert(ptr != NULL);
+        test_int(ptr[0].value, foo);
+    }
+
+    test_bool(ecs_worker_chunk_next(&pit_1), false);
+    test_bool(ecs_worker_chunk_next(&pit_2), false);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Iter_worker_chunk_iter_w_fini(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_query_t *f = ecs_query(world, {
+        .terms = {{ ecs_id(Position) }}
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {20, 30}));
+    ecs_add(world, e2, Foo);
+
+    int32_t cursor = 0;
+    ecs_iter_t it = ecs_query_iter(world, f);
+    ecs_iter_t pit = ecs_worker_chunk_iter(&it, 0, 2, &cursor, 1);
+    test_bool(true, ecs_worker_chunk_next(&pit));
+    test_int(pit.count, 1);
+    test_int(pit.entities[0], e1);
+    ecs_iter_fini(&pit);
+
+    ecs_query_fini(f);
+
+    ecs_fini(world);
+}
@@ -6801,3 +6801,118 @@ void NonFragmentingChildOf_prefab_parent_w_mixed_childof(void) {
 
     ecs_fini(world);
 }
+
+static
+void BulkInstantiateOnSet(ecs_iter_t *it) {
+    int32_t *invoked = it->ctx;
+    invoked[0] ++;
+    invoked[1] += it->count;
+}
+
+void NonFragmentingChildOf_bulk_instantiate(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT_DEFINE(world, Position);
+    ecs_add_pair(world, ecs_id(Position), EcsOnInstantiate, EcsOverride);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t c1 = ecs_insert(world, ecs_value(EcsParent, {p}));
+    ecs_set(world, c1, Position, {10, 20});
+    ecs_entity_t c2 = ecs_insert(world, ecs_value(EcsParent, {p}));
+    ecs_entity_t gc = ecs_insert(world, ecs_value(EcsParent, {c1}));
+    ecs_set(world, gc, Position, {30, 40});
+
+    const ecs_entity_t *ids = ecs_bulk_instantiate(world, p, 10);
+    test_assert(ids != NULL);
+
+    ecs_entity_t instances[10];
+    ecs_os_memcpy_n(instances, ids, ecs_entity_t, 10);
+
+    for (int i = 0; i < 10; i ++) {
+        ecs_entity_t inst = instances[i];
+        test_assert(ecs_has_pair(world, inst, EcsIsA, p));
+
+        ecs_entities_t children = ecs_get_ordered_children(world, inst);
+        test_int(children.count, 2);
+
+        ecs_entity_t i_c1 = children.ids[0];
+        ecs_entity_t i_c2 = children.ids[1];
+        test_assert(ecs_get_target(world, inst, c1, 0) == i_c1);
+        test_assert(ecs_get_target(world, inst, c2, 0) == i_c2);
+        test_assert(ecs_get_parent(world, i_c1) == inst);
+        test_assert(ecs_get_parent(world, i_c2) == inst);
+        test_assert(ecs_has_pair(world, i_c1, EcsIsA, c1));
+        test_assert(ecs_has_pair(world, i_c2, EcsIsA, c2));
+
+        const Position *pos = ecs_get(world, i_c1, Position);
+        test_assert(pos != NULL);
+        test_int(pos->x, 10);
+        test_int(pos->y, 20);
+        test_assert(ecs_owns(world, i_c1, Position));
+
+        ecs_entities_t grandchildren = ecs_get_ordered_children(world, i_c1);
+        test_int(grandchildren.count, 1);
+        ecs_entity_t i_gc = grandchildren.ids[0];
+        test_assert(ecs_get_parent(world, i_gc) == i_c1);
+        test_assert(ecs_has_pair(world, i_gc, EcsIsA, gc));
+
+        pos = ecs_get(world, i_gc, Position);
+        test_assert(pos != NULL);
+        test_int(pos->x, 30);
+        test_int(pos->y, 40);
+    }
+
+    ecs_fini(world);
+}
+
+void NonFragmentingChildOf_bulk_instantiate_on_set(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT_DEFINE(world, Position);
+    ecs_add_pair(world, ecs_id(Position), EcsOnInstantiate, EcsOverride);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t c = ecs_insert(world, ecs_value(EcsParent, {p}));
+    ecs_set(world, c, Position, {10, 20});
+
+    int32_t invoked[2] = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = BulkInstantiateOnSet,
+        .ctx = invoked
+    });
+
+    const ecs_entity_t *ids = ecs_bulk_instantiate(world, p, 100);
+    test_assert(ids != NULL);
+
+    /* One notification for the range of 100 instance children */
+    test_int(invoked[0], 1);
+    test_int(invoked[1], 100);
+
+    ecs_fini(world);
+}
+
+void NonFragmentingChildOf_bulk_instantiate_deferred(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t c = ecs_insert(world, ecs_value(EcsParent, {p}));
+
+    ecs_defer_begin(world);
+    const ecs_entity_t *ids = ecs_bulk_instantiate(world, p, 3);
+    test_assert(ids != NULL);
+    ecs_entity_t instances[3];
+    ecs_os_memcpy_n(instances, ids, ecs_entity_t, 3);
+    ecs_defer_end(world);
+
+    for (int i = 0; i < 3; i ++) {
+        ecs_entity_t inst = instances[i];
+        test_assert(ecs_has_pair(world, inst, EcsIsA, p));
+        ecs_entities_t children = ecs_get_ordered_children(world, inst);
+        test_int(children.count, 1);
+        test_assert(ecs_get_target(world, inst, c, 0) == children.ids[0]);
+    }
+
+    ecs_fini(world);
+}
@@ -13645,3 +13645,475 @@ void Observer_multi_term_on_set_w_base_and_3_instances_in_different_tables(void)
 
     ecs_fini(world);
 }
+
+void Observer_batched_on_set_deferred(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    ecs_entity_t e3 = ecs_new_w(world, Position);
+
+    Probe ctx = {0};
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx,
+        .batched = true
+    });
+
+    ecs_defer_begin(world);
+    ecs_set(world, e3, Position, {30, 40});
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_set(world, e2, Position, {20, 30});
+    ecs_set(world, e1, Position, {11, 21});
+    test_int(ctx.invoked, 0);
+    ecs_defer_end(world);
+
+    test_int(ctx.invoked, 1);
+    test_int(ctx.count, 3);
+    test_int(ctx.system, o);
+    test_int(ctx.event, EcsOnSet);
+    test_int(ctx.event_id, ecs_id(Position));
+    test_int(ctx.e[0], e1);
+    test_int(ctx.e[1], e2);
+    test_int(ctx.e[2], e3);
+
+    ecs_fini(world);
+}
+
+void Observer_batched_on_add_2_terms(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_entity_t e2 = ecs_new(world);
+    ecs_entity_t e3 = ecs_new(world);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ TagA }, { TagB }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx,
+        .batched = true
+    });
+
+    ecs_defer_begin(world);
+    ecs_add(world, e1, TagA);
+    ecs_add(world, e1, TagB);
+    ecs_add(world, e2, TagA);
+    ecs_add(world, e2, TagB);
+    ecs_add(world, e3, TagA);
+    ecs_defer_end(world);
+
+    test_int(ctx.invoked, 1);
+    test_int(ctx.count, 2);
+    test_int(ctx.event, EcsOnAdd);
+    test_int(ctx.e[0], e1);
+    test_int(ctx.e[1], e2);
+    test_int(ctx.c[0][0], TagA);
+    test_int(ctx.c[0][1], TagB);
+
+    ecs_fini(world);
+}
+
+void Observer_batched_flush(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx,
+        .batched = true
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {20, 30}));
+    test_int(ctx.invoked, 0);
+
+    ecs_flush_observers(world);
+    test_int(ctx.invoked, 1);
+    test_int(ctx.count, 2);
+    test_int(ctx.e[0], e1);
+    test_int(ctx.e[1], e2);
+
+    ecs_flush_observers(world);
+    test_int(ctx.invoked, 1);
+
+    ecs_fini(world);
+}
+
+void Observer_batched_2_tables(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_entity_t e2 = ecs_new_w(world, TagA);
+    ecs_entity_t e3 = ecs_new(world);
+    ecs_entity_t e4 = ecs_new_w(world, TagA);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx,
+        .batched = true
+    });
+
+    ecs_defer_begin(world);
+    ecs_add(world, e1, Position);
+    ecs_add(world, e2, Position);
+    ecs_add(world, e3, Position);
+    ecs_add(world, e4, Position);
+    ecs_defer_end(world);
+
+    test_int(ctx.invoked, 2);
+    test_int(ctx.count, 4);
+
+    ecs_fini(world);
+}
+
+void Observer_batched_deleted_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx,
+        .batched = true
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {20, 30}));
+    ecs_delete(world, e1);
+
+    ecs_flush_observers(world);
+    test_int(ctx.invoked, 1);
+    test_int(ctx.count, 1);
+    test_int(ctx.e[0], e2);
+
+    ecs_fini(world);
+}
+
+static void Observer_batched_set_velocity(ecs_iter_t *it) {
+    Probe *ctx = it->ctx;
+    ecs_entity_t velocity = *(ecs_entity_t*)ctx->param;
+    ctx->invoked ++;
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        ecs_set_id(it->world, it->entities[i], velocity, 
+            sizeof(Velocity), &(Velocity){1, 2});
+    }
+}
+
+void Observer_batched_chained(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    Probe ctx_p = { .param = &ecs_id(Velocity) };
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer_batched_set_velocity,
+        .ctx = &ctx_p,
+        .batched = true
+    });
+
+    Probe ctx_v = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Velocity) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_v,
+        .batched = true
+    });
+
+    ecs_defer_begin(world);
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {20, 30}));
+    ecs_defer_end(world);
+
+    test_int(ctx_p.invoked, 1);
+    test_int(ctx_v.invoked, 1);
+    test_int(ctx_v.count, 2);
+    test_assert(ecs_has(world, e1, Velocity));
+    test_assert(ecs_has(world, e2, Velocity));
+
+    ecs_fini(world);
+}
+
+void Observer_batched_disabled(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx,
+        .batched = true
+    });
+
+    ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_enable(world, o, false);
+
+    ecs_flush_observers(world);
+    test_int(ctx.invoked, 0);
+
+    ecs_fini(world);
+}
+
+void Observer_batched_delete_observer(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx,
+        .batched = true
+    });
+
+    ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_delete(world, o);
+
+    ecs_flush_observers(world);
+    test_int(ctx.invoked, 0);
+
+    ecs_fini(world);
+}
+
+void Observer_batched_on_remove(void) {
+    install_test_abort();
+
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    test_expect_abort();
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnRemove },
+        .callback = Observer,
+        .ctx = &ctx,
+        .batched = true
+    });
+}
+
+void Observer_create_observer_after_emit_unobserved(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx
+    });
+
+    ecs_entity_t e = ecs_insert(world, 
+        ecs_value(Position, {10, 20}), ecs_value(Velocity, {1, 2}));
+    test_int(ctx.invoked, 1);
+
+    /* Emit for component without observers */
+    ecs_set(world, e, Velocity, {1, 2});
+    test_int(ctx.invoked, 1);
+
+    Probe ctx_v = {0};
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Velocity) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_v
+    });
+
+    ecs_set(world, e, Velocity, {2, 3});
+    test_int(ctx_v.invoked, 1);
+    test_int(ctx_v.e[0], e);
+
+    ecs_delete(world, o);
+
+    ecs_set(world, e, Velocity, {3, 4});
+    test_int(ctx_v.invoked, 1);
+    test_int(ctx.invoked, 1);
+
+    ecs_fini(world);
+}
+
+void Observer_create_wildcard_observer_after_emit_unobserved(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Rel);
+    ECS_TAG(world, TgtA);
+    ECS_TAG(world, TgtB);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx
+    });
+
+    ecs_entity_t e = ecs_new_w(world, Position);
+    test_int(ctx.invoked, 1);
+
+    /* Emit for pair without observers */
+    ecs_add_pair(world, e, Rel, TgtA);
+    test_int(ctx.invoked, 1);
+
+    Probe ctx_w = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_pair(Rel, EcsWildcard) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx_w
+    });
+
+    ecs_remove_pair(world, e, Rel, TgtA);
+    ecs_add_pair(world, e, Rel, TgtA);
+    test_int(ctx_w.invoked, 1);
+    test_int(ctx_w.e[0], e);
+
+    ecs_add_pair(world, e, Rel, TgtB);
+    test_int(ctx_w.invoked, 2);
+
+    ecs_fini(world);
+}
+
+void Observer_create_wildcard_event_observer_after_emit_unobserved(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx
+    });
+
+    ecs_entity_t e = ecs_insert(world, 
+        ecs_value(Position, {10, 20}), ecs_value(Velocity, {1, 2}));
+    ecs_set(world, e, Velocity, {1, 2});
+    test_int(ctx.invoked, 1);
+
+    Probe ctx_v = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Velocity) }},
+        .events = { EcsWildcard },
+        .callback = Observer,
+        .ctx = &ctx_v
+    });
+
+    ecs_set(world, e, Velocity, {2, 3});
+    test_int(ctx_v.invoked, 1);
+    test_int(ctx_v.event, EcsOnSet);
+
+    ecs_fini(world);
+}
+
+void Observer_create_up_observer_after_emit_self_observed(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx
+    });
+
+    ecs_entity_t parent = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t child = ecs_new_w_pair(world, EcsChildOf, parent);
+    test_int(ctx.invoked, 1);
+
+    /* Emit for component with only self observers */
+    ecs_set(world, parent, Position, {20, 30});
+    test_int(ctx.invoked, 2);
+
+    Probe ctx_up = {0};
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position), .src.id = EcsUp, .trav = EcsChildOf }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_up
+    });
+
+    ecs_set(world, parent, Position, {30, 40});
+    test_int(ctx.invoked, 3);
+    test_int(ctx_up.invoked, 1);
+    test_int(ctx_up.e[0], child);
+    test_int(ctx_up.s[0][0], parent);
+
+    ecs_delete(world, o);
+
+    ecs_set(world, parent, Position, {40, 50});
+    test_int(ctx.invoked, 4);
+    test_int(ctx_up.invoked, 1);
+
+    ecs_fini(world);
+}
+
+void Observer_propagate_set_to_non_fragmenting_children(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position), .src.id = EcsUp, .trav = EcsChildOf }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx
+    });
+
+    ecs_entity_t parent = ecs_new(world);
+    ecs_entity_t child_1 = ecs_insert(world, ecs_value(EcsParent, {parent}));
+    ecs_entity_t child_2 = ecs_insert(world, ecs_value(EcsParent, {parent}));
+    ecs_entity_t child_3 = ecs_insert(world, ecs_value(EcsParent, {parent}));
+    ecs_add(world, child_3, Position);
+
+    ecs_set(world, parent, Position, {10, 20});
+    test_int(ctx.invoked, 2);
+    test_int(ctx.count, 3);
+    test_int(ctx.e[0], child_1);
+    test_int(ctx.e[1], child_2);
+    test_int(ctx.e[2], child_3);
+    test_int(ctx.s[0][0], parent);
+    test_int(ctx.s[1][0], parent);
+
+    ecs_fini(world);
+}
@@ -6503,3 +6503,43 @@ void Prefab_delete_component_used_by_prefab(void) {
 
     ecs_fini(world);
 }
+
+void Prefab_bulk_instantiate_w_childof(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_set(world, p, Position, {10, 20});
+    ecs_entity_t c = ecs_new_w_pair(world, EcsChildOf, p);
+    ecs_set(world, c, Position, {30, 40});
+
+    const ecs_entity_t *ids = ecs_bulk_instantiate(world, p, 10);
+    test_assert(ids != NULL);
+
+    ecs_entity_t instances[10];
+    ecs_os_memcpy_n(instances, ids, ecs_entity_t, 10);
+
+    for (int i = 0; i < 10; i ++) {
+        ecs_entity_t inst = instances[i];
+        test_assert(ecs_has_pair(world, inst, EcsIsA, p));
+
+        const Position *pos = ecs_get(world, inst, Position);
+        test_assert(pos != NULL);
+        test_int(pos->x, 10);
+        test_int(pos->y, 20);
+
+        ecs_iter_t it = ecs_children(world, inst);
+        test_bool(true, ecs_children_next(&it));
+        test_int(1, it.count);
+        ecs_entity_t i_c = it.entities[0];
+        test_bool(false, ecs_children_next(&it));
+
+        pos = ecs_get(world, i_c, Position);
+        test_assert(pos != NULL);
+        test_int(pos->x, 30);
+        test_int(pos->y, 40);
+    }
+
+    ecs_fini(world);
+}
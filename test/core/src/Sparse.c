@@ -1505,6 +1505,45 @@ void Sparse_test_stable_ptr(void) {
     ecs_fini(world);
 }
 
+static int position_move_invoked = 0;
+
+static ECS_MOVE(Position, dst, src, {
+    position_move_invoked ++;
+    *dst = *src;
+})
+
+void Sparse_no_move_on_table_change(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Foo);
+
+    ecs_set_hooks(world, Position, {
+        .move = ecs_move(Position)
+    });
+
+    ecs_add_id(world, ecs_id(Position), EcsSparse);
+    if (!fragment) ecs_add_id(world, ecs_id(Position), EcsDontFragment);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+
+    ecs_set(world, e1, Velocity, {1, 2});
+    ecs_add(world, e1, Foo);
+    ecs_add(world, e2, Foo);
+    ecs_remove(world, e1, Velocity);
+    ecs_delete(world, e2);
+    test_int(position_move_invoked, 0);
+
+    const Position *p = ecs_get(world, e1, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_fini(world);
+}
+
 void Sparse_has_after_remove(void) {
     ecs_world_t *world = ecs_mini();
 
@@ -868,3 +868,243 @@ void Table_65_records_w_tgt(void) {
 
     ecs_fini(world);
 }
+
+static
+bool is_column_aligned(const void *ptr) {
+    return ((uintptr_t)ptr % FLECS_COLUMN_ALIGNMENT) == 0;
+}
+
+void Table_column_alignment(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Mass);
+
+    int32_t i;
+    for (i = 0; i < 100; i ++) {
+        ecs_entity_t e = ecs_insert(world, 
+            ecs_value(Position, {i, i}), ecs_value(Mass, {i}));
+        ecs_table_t *table = ecs_get_table(world, e);
+        test_assert(is_column_aligned(ecs_table_get_id(
+            world, table, ecs_id(Position), 0)));
+        test_assert(is_column_aligned(ecs_table_get_id(
+            world, table, ecs_id(Mass), 0)));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Position) }, { ecs_id(Mass) }}
+    });
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, 100);
+    test_int(it.offset, 0);
+    test_assert(is_column_aligned(ecs_field(&it, Position, 0)));
+    test_assert(is_column_aligned(ecs_field(&it, Mass, 1)));
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+static ECS_CTOR(Position, ptr, {
+    ptr->x = 0;
+    ptr->y = 0;
+})
+
+static ECS_MOVE(Position, dst, src, {
+    *dst = *src;
+})
+
+void Table_column_alignment_w_ctor(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_set_hooks(world, Position, {
+        .ctor = ecs_ctor(Position),
+        .move = ecs_move(Position)
+    });
+
+    int32_t i;
+    for (i = 0; i < 100; i ++) {
+        ecs_entity_t e = ecs_insert(world, ecs_value(Position, {i, i}));
+        ecs_table_t *table = ecs_get_table(world, e);
+        test_assert(is_column_aligned(ecs_table_get_id(
+            world, table, ecs_id(Position), 0)));
+        const Position *p = ecs_get(world, e, Position);
+        test_int(p->x, i);
+    }
+
+    ecs_fini(world);
+}
+
+void Table_column_alignment_after_shrink(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e[10];
+    int32_t i;
+    for (i = 0; i < 10; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, i}));
+    }
+
+    for (i = 0; i < 7; i ++) {
+        ecs_delete(world, e[i]);
+    }
+
+    ecs_shrink(world);
+
+    ecs_table_t *table = ecs_get_table(world, e[9]);
+    test_int(ecs_table_count(table), 3);
+    const Position *p = ecs_table_get_id(world, table, ecs_id(Position), 0);
+    test_assert(is_column_aligned(p));
+
+    for (i = 7; i < 10; i ++) {
+        p = ecs_get(world, e[i], Position);
+        test_assert(p != NULL);
+        test_int(p->x, i);
+    }
+
+    ecs_fini(world);
+}
+
+void Table_column_alignment_bulk_new(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    const ecs_entity_t *ids = ecs_bulk_new(world, Position, 1000);
+    test_assert(ids != NULL);
+
+    ecs_table_t *table = ecs_get_table(world, ids[0]);
+    test_int(ecs_table_count(table), 1000);
+    test_assert(is_column_aligned(ecs_table_get_id(
+        world, table, ecs_id(Position), 0)));
+
+    ecs_fini(world);
+}
+
+void Table_reserve(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_table_t *table = ecs_get_table(world, e);
+
+    ecs_table_reserve(world, table, 1000);
+    test_int(ecs_table_size(table), 1024);
+    test_int(ecs_table_count(table), 1);
+
+    const Position *p = ecs_get(world, e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    void *column = ecs_table_get_id(world, table, ecs_id(Position), 0);
+    test_assert(is_column_aligned(column));
+
+    int32_t i;
+    for (i = 1; i < 1024; i ++) {
+        ecs_insert(world, ecs_value(Position, {i, i}));
+    }
+
+    test_int(ecs_table_size(table), 1024);
+    test_int(ecs_table_count(table), 1024);
+    test_assert(column == ecs_table_get_id(world, table, ecs_id(Position), 0));
+
+    ecs_fini(world);
+}
+
+void Table_reserve_empty(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_id_t ids[] = { ecs_id(Position), ecs_id(Velocity) };
+    ecs_table_t *table = ecs_table_find(world, ids, 2);
+    test_assert(table != NULL);
+    test_int(ecs_table_size(table), 0);
+
+    ecs_table_reserve(world, table, 100);
+    test_int(ecs_table_size(table), 128);
+    test_int(ecs_table_count(table), 0);
+
+    ecs_entity_t e = ecs_insert(world, 
+        ecs_value(Position, {10, 20}), ecs_value(Velocity, {1, 2}));
+    test_assert(ecs_get_table(world, e) == table);
+    test_int(ecs_table_size(table), 128);
+
+    const Velocity *v = ecs_get(world, e, Velocity);
+    test_assert(v != NULL);
+    test_int(v->x, 1);
+    test_int(v->y, 2);
+
+    ecs_fini(world);
+}
+
+void Table_reserve_smaller(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_table_t *table = ecs_get_table(world, e);
+
+    ecs_table_reserve(world, table, 100);
+    test_int(ecs_table_size(table), 128);
+
+    ecs_table_reserve(world, table, 10);
+    test_int(ecs_table_size(table), 128);
+
+    const Position *p = ecs_get(world, e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_fini(world);
+}
+
+static int reserve_move_invoked = 0;
+
+static ECS_MOVE(Velocity, dst, src, {
+    reserve_move_invoked ++;
+    *dst = *src;
+})
+
+void Table_reserve_w_move_hook(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_set_hooks(world, Velocity, {
+        .move = ecs_move(Velocity)
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Velocity, {1, 2}));
+    ecs_table_t *table = ecs_get_table(world, e);
+
+    ecs_table_reserve(world, table, 1000);
+    test_int(ecs_table_size(table), 1024);
+
+    int32_t moved = reserve_move_invoked;
+
+    int32_t i;
+    for (i = 1; i < 1024; i ++) {
+        ecs_insert(world, ecs_value(Velocity, {i, i}));
+    }
+
+    /* No elements are moved while the table grows into reserved storage */
+    test_int(reserve_move_invoked, moved);
+
+    const Velocity *v = ecs_get(world, e, Velocity);
+    test_assert(v != NULL);
+    test_int(v->x, 1);
+    test_int(v->y, 2);
+
+    ecs_fini(world);
+}
@@ -314,6 +314,10 @@ void Iter_rule_page_iter_w_fini(void);
 void Iter_rule_worker_iter_w_fini(void);
 void Iter_to_str_before_next(void);
 void Iter_to_str(void);
+void Iter_worker_chunk_iter_1(void);
+void Iter_worker_chunk_iter_w_tables(void);
+void Iter_worker_chunk_iter_w_task_query(void);
+void Iter_worker_chunk_iter_w_fini(void);
 
 // Testsuite 'Search'
 void Search_search(void);
@@ -724,6 +728,7 @@ void Sparse_defer_remove_override(void);
 void Sparse_defer_remove_add_override(void);
 void Sparse_fini_w_dont_fragment_pair_prefab_exclusive_delete_with(void);
 void Sparse_remove_childof_pair_w_dont_fragment_component(void);
+void Sparse_no_move_on_table_change(void);
 
 // Testsuite 'NonFragmentingChildOf'
 void NonFragmentingChildOf_set_parent_no_ordered_children(void);
@@ -982,6 +987,9 @@ void NonFragmentingChildOf_fini_w_mixed_childof_different_parents(void);
 void NonFragmentingChildOf_fini_w_ordered_child_w_up_traversable(void);
 void NonFragmentingChildOf_defer_reparent_mixed_childof(void);
 void NonFragmentingChildOf_prefab_parent_w_mixed_childof(void);
+void NonFragmentingChildOf_bulk_instantiate(void);
+void NonFragmentingChildOf_bulk_instantiate_on_set(void);
+void NonFragmentingChildOf_bulk_instantiate_deferred(void);
 
 // Testsuite 'Hierarchies'
 void Hierarchies_setup(void);
@@ -2320,6 +2328,20 @@ void Observer_cache_test_15(void);
 void Observer_cache_test_16(void);
 void Observer_cache_test_17(void);
 void Observer_multi_term_on_set_w_base_and_3_instances_in_different_tables(void);
+void Observer_batched_on_set_deferred(void);
+void Observer_batched_on_add_2_terms(void);
+void Observer_batched_flush(void);
+void Observer_batched_2_tables(void);
+void Observer_batched_deleted_entity(void);
+void Observer_batched_chained(void);
+void Observer_batched_disabled(void);
+void Observer_batched_delete_observer(void);
+void Observer_batched_on_remove(void);
+void Observer_create_observer_after_emit_unobserved(void);
+void Observer_create_wildcard_observer_after_emit_unobserved(void);
+void Observer_create_wildcard_event_observer_after_emit_unobserved(void);
+void Observer_create_up_observer_after_emit_self_observed(void);
+void Observer_propagate_set_to_non_fragmenting_children(void);
 
 // Testsuite 'ObserverOnSet'
 void ObserverOnSet_set_1_of_1(void);
@@ -2637,6 +2659,7 @@ void Prefab_add_base_w_exclusive_override(void);
 void Prefab_fini_w_prefab_child_exclusive_pair_delete_with(void);
 void Prefab_delete_with_component_used_by_prefab(void);
 void Prefab_delete_component_used_by_prefab(void);
+void Prefab_bulk_instantiate_w_childof(void);
 
 // Testsuite 'World'
 void World_setup(void);
@@ -3144,6 +3167,15 @@ void Commands_set_existing_after_remove_move_table(void);
 void Commands_set_existing_after_remove_w_is_a(void);
 void Commands_set_existing_after_remove_w_is_a_move_table(void);
 void Commands_set_existing_after_remove_2_stages(void);
+void Commands_coalesce_add_tag(void);
+void Commands_coalesce_remove_component(void);
+void Commands_coalesce_add_w_observer(void);
+void Commands_coalesce_w_hooks(void);
+void Commands_coalesce_different_tables(void);
+void Commands_coalesce_interleaved_w_delete(void);
+void Commands_coalesce_add_remove_same_id(void);
+void Commands_coalesce_preserve_order(void);
+void Commands_coalesce_traversable(void);
 
 // Testsuite 'SingleThreadStaging'
 void SingleThreadStaging_setup(void);
@@ -3266,6 +3298,14 @@ void Table_clear_table_on_remove_hooks(void);
 void Table_clear_table_on_remove_observer(void);
 void Table_65_records_w_tgt(void);
 void Table_find_w_dont_fragment(void);
+void Table_column_alignment(void);
+void Table_column_alignment_w_ctor(void);
+void Table_column_alignment_after_shrink(void);
+void Table_column_alignment_bulk_new(void);
+void Table_reserve(void);
+void Table_reserve_empty(void);
+void Table_reserve_smaller(void);
+void Table_reserve_w_move_hook(void);
 
 // Testsuite 'Poly'
 void Poly_on_set_poly_observer(void);
@@ -4545,6 +4585,22 @@ bake_test_case Iter_testcases[] = {
     {
         "to_str",
         Iter_to_str
+    },
+    {
+        "worker_chunk_iter_1",
+        Iter_worker_chunk_iter_1
+    },
+    {
+        "worker_chunk_iter_w_tables",
+        Iter_worker_chunk_iter_w_tables
+    },
+    {
+        "worker_chunk_iter_w_task_query",
+        Iter_worker_chunk_iter_w_task_query
+    },
+    {
+        "worker_chunk_iter_w_fini",
+        Iter_worker_chunk_iter_w_fini
     }
 };
 
@@ -6137,6 +6193,10 @@ bake_test_case Sparse_testcases[] = {
     {
         "remove_childof_pair_w_dont_fragment_component",
         Sparse_remove_childof_pair_w_dont_fragment_component
+    },
+    {
+        "no_move_on_table_change",
+        Sparse_no_move_on_table_change
     }
 };
 
@@ -7164,6 +7224,18 @@ bake_test_case NonFragmentingChildOf_testcases[] = {
     {
         "prefab_parent_w_mixed_childof",
         NonFragmentingChildOf_prefab_parent_w_mixed_childof
+    },
+    {
+        "bulk_instantiate",
+        NonFragmentingChildOf_bulk_instantiate
+    },
+    {
+        "bulk_instantiate_on_set",
+        NonFragmentingChildOf_bulk_instantiate_on_set
+    },
+    {
+        "bulk_instantiate_deferred",
+        NonFragmentingChildOf_bulk_instantiate_deferred
     }
 };
 
@@ -12407,6 +12479,62 @@ bake_test_case Observer_testcases[] = {
     {
         "multi_term_on_set_w_base_and_3_instances_in_different_tables",
         Observer_multi_term_on_set_w_base_and_3_instances_in_different_tables
+    },
+    {
+        "batched_on_set_deferred",
+        Observer_batched_on_set_deferred
+    },
+    {
+        "batched_on_add_2_terms",
+        Observer_batched_on_add_2_terms
+    },
+    {
+        "batched_flush",
+        Observer_batched_flush
+    },
+    {
+        "batched_2_tables",
+        Observer_batched_2_tables
+    },
+    {
+        "batched_deleted_entity",
+        Observer_batched_deleted_entity
+    },
+    {
+        "batched_chained",
+        Observer_batched_chained
+    },
+    {
+        "batched_disabled",
+        Observer_batched_disabled
+    },
+    {
+        "batched_delete_observer",
+        Observer_batched_delete_observer
+    },
+    {
+        "batched_on_remove",
+        Observer_batched_on_remove
+    },
+    {
+        "create_observer_after_emit_unobserved",
+        Observer_create_observer_after_emit_unobserved
+    },
+    {
+        "create_wildcard_observer_after_emit_unobserved",
+        Observer_create_wildcard_observer_after_emit_unobserved
+    },
+    {
+        "create_wildcard_event_observer_after_emit_unobserved",
+        Observer_create_wildcard_event_observer_after_emit_unobserved
+    },
+    {
+        "create_up_observer_after_emit_self_observed",
+        Observer_create_up_observer_after_emit_self_observed
+    },
+    {
+        "propagate_set_to_non_fragmenting_children",
+        Observer_propagate_set_to_non_fragmenting_children
     }
 };
 
@@ -13637,6 +13765,10 @@ bake_test_case Prefab_testcases[] = {
     {
         "delete_component_used_by_prefab",
         Prefab_delete_component_used_by_prefab
+    },
+    {
+        "bulk_instantiate_w_childof",
+        Prefab_bulk_instantiate_w_childof
     }
 };
 
@@ -15632,6 +15764,42 @@ bake_test_case Commands_testcases[] = {
     {
         "set_existing_after_remove_2_stages",
         Commands_set_existing_after_remove_2_stages
+    },
+    {
+        "coalesce_add_tag",
+        Commands_coalesce_add_tag
+    },
+    {
+        "coalesce_remove_component",
+        Commands_coalesce_remove_component
+    },
+    {
+        "coalesce_add_w_observer",
+        Commands_coalesce_add_w_observer
+    },
+    {
+        "coalesce_w_hooks",
+        Commands_coalesce_w_hooks
+    },
+    {
+        "coalesce_different_tables",
+        Commands_coalesce_different_tables
+    },
+    {
+        "coalesce_interleaved_w_delete",
+        Commands_coalesce_interleaved_w_delete
+    },
+    {
+        "coalesce_add_remove_same_id",
+        Commands_coalesce_add_remove_same_id
+    },
+    {
+        "coalesce_preserve_order",
+        Commands_coalesce_preserve_order
+    },
+    {
+        "coalesce_traversable",
+        Commands_coalesce_traversable
     }
 };
 
@@ -16097,6 +16265,38 @@ bake_test_case Table_testcases[] = {
     {
         "find_w_dont_fragment",
         Table_find_w_dont_fragment
+    },
+    {
+        "column_alignment",
+        Table_column_alignment
+    },
+    {
+        "column_alignment_w_ctor",
+        Table_column_alignment_w_ctor
+    },
+    {
+        "column_alignment_after_shrink",
+        Table_column_alignment_after_shrink
+    },
+    {
+        "column_alignment_bulk_new",
+        Table_column_alignment_bulk_new
+    },
+    {
+        "reserve",
+        Table_reserve
+    },
+    {
+        "reserve_empty",
+        Table_reserve_empty
+    },
+    {
+        "reserve_smaller",
+        Table_reserve_smaller
+    },
+    {
+        "reserve_w_move_hook",
+        Table_reserve_w_move_hook
     }
 };
 
@@ -16395,7 +16595,7 @@ static bake_test_suite suites[] = {
         "Iter",
         NULL,
         NULL,
-        62,
+        66,
         Iter_testcases
     },
     {
@@ -16451,7 +16651,7 @@ static bake_test_suite suites[] = {
         "Sparse",
         Sparse_setup,
         NULL,
-        230,
+        231,
         Sparse_testcases,
         1,
         Sparse_params
@@ -16460,7 +16660,7 @@ static bake_test_suite suites[] = {
         "NonFragmentingChildOf",
         NULL,
         NULL,
-        256,
+        259,
         NonFragmentingChildOf_testcases
     },
     {
@@ -16579,7 +16779,7 @@ static bake_test_suite suites[] = {
         "Observer",
         NULL,
         NULL,
-        340,
+        354,
         Observer_testcases
     },
     {
@@ -16621,7 +16821,7 @@ static bake_test_suite suites[] = {
         "Prefab",
         Prefab_setup,
         NULL,
-        201,
+        202,
         Prefab_testcases
     },
     {
@@ -16656,7 +16856,7 @@ static bake_test_suite suites[] = {
         "Commands",
         NULL,
         NULL,
-        175,
+        184,
         Commands_testcases
     },
     {
@@ -16677,7 +16877,7 @@ static bake_test_suite suites[] = {
         "Table",
         NULL,
         NULL,
-        33,
+        41,
         Table_testcases
     },
     {
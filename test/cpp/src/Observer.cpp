@@ -1838,3 +1838,40 @@ void Observer_untyped_field(void) {
     test_int(invoked, 1);
     test_int(count, 1);
 }
+
+void Observer_batched(void) {
+    flecs::world world;
+
+    int invoked = 0, count = 0;
+
+    world.observer<Position>()
+        .event(flecs::OnSet)
+        .batched()
+        .run([&](flecs::iter& it) {
+            invoked ++;
+            while (it.next()) {
+                count += it.count();
+                auto p = it.field<Position>(0);
+                for (auto i : it) {
+                    test_int(p[i].x, 10);
+                    test_int(p[i].y, 20);
+                }
+            }
+        });
+
+    world.defer_begin();
+    world.entity().set(Position{10, 20});
+    world.entity().set(Position{10, 20});
+    world.entity().set(Position{10, 20});
+    world.defer_end();
+
+    test_int(invoked, 1);
+    test_int(count, 3);
+
+    world.entity().set(Position{10, 20});
+    test_int(invoked, 1);
+
+    world.flush_observers();
+    test_int(invoked, 2);
+    test_int(count, 4);
+}
@@ -3971,3 +3971,97 @@ void Query_has_range(void) {
     test_bool(q.has(e1.range()), true);
     test_bool(q.has(e2.range()), false);
 }
+
+void Query_changed_rows(void) {
+    flecs::world ecs;
+
+    const int32_t chunk_size = 1 << FLECS_CHANGE_CHUNK_BITS;
+
+    auto q = ecs.query_builder<const Position>()
+        .cached()
+        .detect_changes()
+        .build();
+
+    flecs::entity e;
+    for (int32_t i = 0; i < chunk_size * 2; i ++) {
+        flecs::entity cur = ecs.entity().set<Position>({0, 0});
+        if (i == chunk_size + 1) {
+            e = cur;
+        }
+    }
+
+    test_bool(q.changed(), true);
+    q.run([](flecs::iter& it) { while (it.next()) { } });
+    test_bool(q.changed(), false);
+
+    e.set<Position>({10, 20});
+    test_bool(q.changed(), true);
+
+    int32_t count = 0;
+    q.run([&](flecs::iter& it) {
+        while (it.next()) {
+            int32_t row = 0, changed;
+            while ((changed = it.changed_rows(row))) {
+                test_int(row, chunk_size);
+                test_int(changed, chunk_size);
+                row += changed;
+                count ++;
+            }
+        }
+    });
+
+    test_int(count, 1);
+}
+
+void Query_sort_by_primitive_component(void) {
+    flecs::world world;
+
+    world.entity().set<int32_t>(3);
+    world.entity().set<int32_t>(-1);
+    world.entity().set<int32_t>(2);
+
+    auto q = world.query_builder<const int32_t>()
+        .order_by<int32_t>()
+        .build();
+
+    int32_t count = 0;
+    q.run([&](flecs::iter it) {
+        while (it.next()) {
+            auto v = it.field<const int32_t>(0);
+            test_int(it.count(), 3);
+            test_int(v[0], -1);
+            test_int(v[1], 2);
+            test_int(v[2], 3);
+            count += it.count();
+        }
+    });
+
+    test_int(count, 3);
+}
+
+void Query_iter_partition(void) {
+    flecs::world world;
+
+    struct TagA { };
+    struct TagB { };
+
+    world.entity().set<Position>({1, 2});
+    world.entity().set<Position>({3, 4}).add<TagA>();
+    world.entity().set<Position>({5, 6}).add<TagB>();
+
+    auto q = world.query_builder<const Position>()
+        .cache_kind(flecs::QueryCacheNone)
+        .build();
+
+    int32_t count_0 = 0, count_1 = 0;
+    q.set_partition(0, 2).each([&](const Position&) {
+        count_0 ++;
+    });
+
+    q.iter().set_partition(1, 2).each([&](const Position&) {
+        count_1 ++;
+    });
+
+    test_int(count_0, 2);
+    test_int(count_1, 1);
+}
@@ -2496,3 +2496,38 @@ void System_run_w_0_src_query(void) {
     world.progress();
     test_int(count, 1);
 }
+
+void System_multithread_system_parallel_levels(void) {
+    flecs::world world;
+
+    world.set_threads(2);
+
+    flecs::entity root = world.entity()
+        .set<Position>({1, 0})
+        .set<Velocity>({0, 0});
+
+    flecs::entity child = world.entity().child_of(root)
+        .set<Position>({2, 0})
+        .set<Velocity>({0, 0});
+
+    flecs::entity grand_child = world.entity().child_of(child)
+        .set<Position>({3, 0})
+        .set<Velocity>({0, 0});
+
+    world.system<const Position, Velocity, const Velocity*>()
+        .term_at(2).parent().cascade()
+        .multi_threaded()
+        .parallel_levels()
+        .each([](const Position& p, Velocity& v, const Velocity *parent) {
+            v.x = p.x;
+            if (parent) {
+                v.x += parent->x;
+            }
+        });
+
+    world.progress();
+
+    test_int(root.get<Velocity>().x, 1);
+    test_int(child.get<Velocity>().x, 3);
+    test_int(grand_child.get<Velocity>().x, 6);
+}
@@ -816,3 +816,21 @@ void Table_clear_entities(void) {
     test_int(table.count(), 0);
     test_int(table.size(), 2);
 }
+
+void Table_reserve(void) {
+    flecs::world ecs;
+
+    flecs::entity e = ecs.entity().set<Position>({10, 20});
+
+    flecs::table table = e.table();
+    test_int(table.count(), 1);
+
+    table.reserve(100);
+    test_int(table.size(), 128);
+    test_int(table.count(), 1);
+
+    const Position *p = e.try_get<Position>();
+    test_assert(p != nullptr);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+}
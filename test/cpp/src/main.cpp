@@ -660,6 +660,7 @@ void System_lookup_and_update_run(void);
 void System_lookup_and_update_ctx(void);
 void System_set_group(void);
 void System_run_w_0_src_query(void);
+void System_multithread_system_parallel_levels(void);
 
 // Testsuite 'Event'
 void Event_evt_1_id_entity(void);
@@ -842,6 +843,9 @@ void Query_optional_module(void);
 void Query_has_entity(void);
 void Query_has_table(void);
 void Query_has_range(void);
+void Query_changed_rows(void);
+void Query_sort_by_primitive_component(void);
+void Query_iter_partition(void);
 
 // Testsuite 'QueryBuilder'
 void QueryBuilder_setup(void);
@@ -1138,6 +1142,7 @@ void Observer_query_eval_w_pair_both_vars_that_triggered_observer(void);
 void Observer_fixed_src_w_each(void);
 void Observer_fixed_src_w_run(void);
 void Observer_untyped_field(void);
+void Observer_batched(void);
 
 // Testsuite 'ComponentLifecycle'
 void ComponentLifecycle_ctor_on_add(void);
@@ -1647,6 +1652,7 @@ void Table_lock(void);
 void Table_unlock(void);
 void Table_has_flags(void);
 void Table_clear_entities(void);
+void Table_reserve(void);
 
 bake_test_case PrettyFunction_testcases[] = {
     {
@@ -4217,6 +4223,10 @@ bake_test_case System_testcases[] = {
     {
         "run_w_0_src_query",
         System_run_w_0_src_query
+    },
+    {
+        "multithread_system_parallel_levels",
+        System_multithread_system_parallel_levels
     }
 };
 
@@ -4930,6 +4940,18 @@ bake_test_case Query_testcases[] = {
     {
         "has_range",
         Query_has_range
+    },
+    {
+        "changed_rows",
+        Query_changed_rows
+    },
+    {
+        "sort_by_primitive_component",
+        Query_sort_by_primitive_component
+    },
+    {
+        "iter_partition",
+        Query_iter_partition
     }
 };
 
@@ -6095,6 +6117,10 @@ bake_test_case Observer_testcases[] = {
     {
         "untyped_field",
         Observer_untyped_field
+    },
+    {
+        "batched",
+        Observer_batched
     }
 };
 
@@ -8086,6 +8112,10 @@ bake_test_case Table_testcases[] = {
     {
         "clear_entities",
         Table_clear_entities
+    },
+    {
+        "reserve",
+        Table_reserve
     }
 };
 
@@ -8148,7 +8178,7 @@ static bake_test_suite suites[] = {
         "System",
         NULL,
         NULL,
-        78,
+        79,
         System_testcases
     },
     {
@@ -8169,7 +8199,7 @@ static bake_test_suite suites[] = {
         "Query",
         NULL,
         NULL,
-        141,
+        144,
         Query_testcases
     },
     {
@@ -8192,7 +8222,7 @@ static bake_test_suite suites[] = {
         "Observer",
         NULL,
         NULL,
-        72,
+        73,
         Observer_testcases
     },
     {
@@ -8255,7 +8285,7 @@ static bake_test_suite suites[] = {
         "Table",
         NULL,
         NULL,
-        40,
+        41,
         Table_testcases
     }
 };
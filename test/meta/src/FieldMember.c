@@ -0,0 +1,325 @@
+#include <meta.h>
+
+typedef struct {
+    float x;
+    float y;
+    float z;
+} Vec3f;
+
+typedef struct {
+    Vec3f position;
+    Vec3f velocity;
+} Particle;
+
+static
+void register_particle(ecs_world_t *world, ecs_entity_t *vec3_out, 
+    ecs_entity_t *particle_out) 
+{
+    ecs_entity_t vec3 = ecs_struct(world, {
+        .entity = ecs_entity(world, {.name = "Vec3f"}),
+        .members = {
+            {"x", ecs_id(ecs_f32_t)},
+            {"y", ecs_id(ecs_f32_t)},
+            {"z", ecs_id(ecs_f32_t)}
+        }
+    });
+
+    ecs_entity_t particle = ecs_struct(world, {
+        .entity = ecs_entity(world, {.name = "Particle"}),
+        .members = {
+            {"position", vec3},
+            {"velocity", vec3}
+        }
+    });
+
+    *vec3_out = vec3;
+    *particle_out = particle;
+}
+
+void FieldMember_member(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t vec3, particle;
+    register_particle(world, &vec3, &particle);
+
+    int i;
+    for (i = 0; i < 4; i ++) {
+        ecs_entity_t e = ecs_new(world);
+        Vec3f v = {(float)i, (float)i * 2, (float)i * 3};
+        ecs_set_id(world, e, vec3, sizeof(Vec3f), &v);
+    }
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ vec3 }} });
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, 4);
+
+    ecs_member_field_t y = ecs_field_member(&it, 0, "y");
+    test_assert(y.ptr != NULL);
+    test_uint(y.type, ecs_id(ecs_f32_t));
+    test_int(y.stride, ECS_SIZEOF(Vec3f));
+    test_assert(y.ptr == &((Vec3f*)ecs_field_w_size(&it, sizeof(Vec3f), 0))[0].y);
+
+    for (i = 0; i < 4; i ++) {
+        test_flt(*ecs_member_at(y, float, i), (float)i * 2);
+    }
+
+    test_bool(false, ecs_query_next(&it));
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void FieldMember_nested_member(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t vec3, particle;
+    register_particle(world, &vec3, &particle);
+
+    int i;
+    for (i = 0; i < 4; i ++) {
+        ecs_entity_t e = ecs_new(world);
+        Particle p = {{(float)i, 0, 0}, {0, 0, (float)i * 10}};
+        ecs_set_id(world, e, particle, sizeof(Particle), &p);
+    }
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ particle }} });
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, 4);
+
+    ecs_member_field_t vz = ecs_field_member(&it, 0, "velocity.z");
+    test_assert(vz.ptr != NULL);
+    test_uint(vz.type, ecs_id(ecs_f32_t));
+    test_int(vz.stride, ECS_SIZEOF(Particle));
+
+    ecs_member_field_t p = ecs_field_member(&it, 0, "position");
+    test_assert(p.ptr != NULL);
+    test_uint(p.type, vec3);
+    test_int(p.stride, ECS_SIZEOF(Particle));
+
+    for (i = 0; i < 4; i ++) {
+        test_flt(*ecs_member_at(vz, float, i), (float)i * 10);
+        test_flt(ecs_member_at(p, Vec3f, i)->x, (float)i);
+    }
+
+    test_bool(false, ecs_query_next(&it));
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void FieldMember_shared_field(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t vec3, particle;
+    register_particle(world, &vec3, &particle);
+    ecs_add_pair(world, vec3, EcsOnInstantiate, EcsInherit);
+
+    ecs_entity_t base = ecs_new(world);
+    Vec3f v = {1, 2, 3};
+    ecs_set_id(world, base, vec3, sizeof(Vec3f), &v);
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsIsA, base);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsIsA, base);
+
+    ecs_query_t *q = ecs_query(world, { 
+        .terms = {{ vec3, .src.id = EcsUp, .trav = EcsIsA }} 
+    });
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, 2);
+    test_uint(it.entities[0], e1);
+    test_uint(it.entities[1], e2);
+
+    ecs_member_field_t z = ecs_field_member(&it, 0, "z");
+    test_assert(z.ptr != NULL);
+    test_int(z.stride, 0);
+    test_flt(*ecs_member_at(z, float, 0), 3);
+    test_flt(*ecs_member_at(z, float, 1), 3);
+
+    test_bool(false, ecs_query_next(&it));
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void FieldMember_member_not_found(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t vec3, particle;
+    register_particle(world, &vec3, &particle);
+
+    ecs_entity_t e = ecs_new(world);
+    Vec3f v = {1, 2, 3};
+    ecs_set_id(world, e, vec3, sizeof(Vec3f), &v);
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ vec3 }} });
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+
+    ecs_member_field_t w = ecs_field_member(&it, 0, "w");
+    test_assert(w.ptr == NULL);
+    test_uint(w.type, 0);
+    test_int(w.stride, 0);
+
+    test_bool(false, ecs_query_next(&it));
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void FieldMember_not_a_struct(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t e = ecs_new(world);
+    ecs_i32_t value = 10;
+    ecs_set_id(world, e, ecs_id(ecs_i32_t), sizeof(ecs_i32_t), &value);
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ ecs_id(ecs_i32_t) }} });
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+
+    ecs_member_field_t m = ecs_field_member(&it, 0, "x");
+    test_assert(m.ptr == NULL);
+
+    test_bool(false, ecs_query_next(&it));
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void FieldMember_tag_field(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_TAG(world, Foo);
+
+    ecs_new_w(world, Foo);
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ Foo }} });
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+
+    ecs_member_field_t m = ecs_field_member(&it, 0, "x");
+    test_assert(m.ptr == NULL);
+
+    test_bool(false, ecs_query_next(&it));
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void FieldMember_member_ref(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t vec3, particle;
+    register_particle(world, &vec3, &particle);
+
+    int i;
+    for (i = 0; i < 4; i ++) {
+        ecs_entity_t e = ecs_new(world);
+        Vec3f v = {(float)i, (float)i * 2, (float)i * 3};
+        ecs_set_id(world, e, vec3, sizeof(Vec3f), &v);
+    }
+
+    ecs_member_ref_t ref = ecs_member_ref_init(world, vec3, "z");
+    test_uint(ref.component, vec3);
+    test_uint(ref.type, ecs_id(ecs_f32_t));
+    test_int(ref.offset, offsetof(Vec3f, z));
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ vec3 }} });
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, 4);
+
+    ecs_member_field_t z = ecs_field_member_ref(&it, 0, &ref);
+    test_assert(z.ptr != NULL);
+    test_uint(z.type, ecs_id(ecs_f32_t));
+    test_int(z.stride, ECS_SIZEOF(Vec3f));
+    test_assert(z.ptr == &((Vec3f*)ecs_field_w_size(&it, sizeof(Vec3f), 0))[0].z);
+
+    for (i = 0; i < 4; i ++) {
+        test_flt(*ecs_member_at(z, float, i), (float)i * 3);
+    }
+
+    test_bool(false, ecs_query_next(&it));
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void FieldMember_nested_member_ref(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t vec3, particle;
+    register_particle(world, &vec3, &particle);
+
+    int i;
+    for (i = 0; i < 4; i ++) {
+        ecs_entity_t e = ecs_new(world);
+        Particle p = {{(float)i, 0, 0}, {0, (float)i * 10, 0}};
+        ecs_set_id(world, e, particle, sizeof(Particle), &p);
+    }
+
+    ecs_member_ref_t ref = ecs_member_ref_init(world, particle, "velocity.y");
+    test_uint(ref.component, particle);
+    test_uint(ref.type, ecs_id(ecs_f32_t));
+    test_int(ref.offset, offsetof(Particle, velocity.y));
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ particle }} });
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, 4);
+
+    ecs_member_field_t vy = ecs_field_member_ref(&it, 0, &ref);
+    test_assert(vy.ptr != NULL);
+    test_int(vy.stride, ECS_SIZEOF(Particle));
+
+    for (i = 0; i < 4; i ++) {
+        test_flt(*ecs_member_at(vy, float, i), (float)i * 10);
+    }
+
+    test_bool(false, ecs_query_next(&it));
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void FieldMember_member_ref_not_found(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t vec3, particle;
+    register_particle(world, &vec3, &particle);
+
+    ecs_member_ref_t ref = ecs_member_ref_init(world, vec3, "w");
+    test_uint(ref.type, 0);
+
+    ref = ecs_member_ref_init(world, particle, "velocity.w");
+    test_uint(ref.type, 0);
+
+    ref = ecs_member_ref_init(world, particle, "velocity.x.y");
+    test_uint(ref.type, 0);
+
+    ref = ecs_member_ref_init(world, ecs_id(ecs_i32_t), "x");
+    test_uint(ref.type, 0);
+
+    ecs_entity_t e = ecs_new(world);
+    Vec3f v = {1, 2, 3};
+    ecs_set_id(world, e, vec3, sizeof(Vec3f), &v);
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ vec3 }} });
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+
+    ref = ecs_member_ref_init(world, vec3, "w");
+    ecs_member_field_t w = ecs_field_member_ref(&it, 0, &ref);
+    test_assert(w.ptr == NULL);
+    test_uint(w.type, 0);
+    test_int(w.stride, 0);
+
+    test_bool(false, ecs_query_next(&it));
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
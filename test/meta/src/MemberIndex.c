@@ -0,0 +1,967 @@
+#include <meta.h>
+
+typedef struct {
+    ecs_entity_t value;
+} Movement;
+
+typedef struct {
+    float x;
+    int32_t id;
+} Player;
+
+typedef struct {
+    float value;
+} Health;
+
+static ecs_entity_t ecs_id(Movement) = 0;
+static ecs_entity_t ecs_id(Player) = 0;
+static ecs_entity_t ecs_id(Health) = 0;
+static ecs_entity_t Running = 0;
+static ecs_entity_t Walking = 0;
+
+static
+ecs_entity_t register_types(
+    ecs_world_t *world)
+{
+    ecs_id(Movement) = ecs_struct(world, {
+        .entity = ecs_entity(world, { .name = "Movement" }),
+        .members = {
+            { "value", ecs_id(ecs_entity_t) }
+        },
+        .create_member_entities = true
+    });
+
+    ecs_id(Player) = ecs_struct(world, {
+        .entity = ecs_entity(world, { .name = "Player" }),
+        .members = {
+            { "x", ecs_id(ecs_f32_t) },
+            { "id", ecs_id(ecs_i32_t) }
+        },
+        .create_member_entities = true
+    });
+
+    Running = ecs_entity(world, { .name = "Running" });
+    Walking = ecs_entity(world, { .name = "Walking" });
+
+    ecs_entity_t member = ecs_lookup(world, "Movement.value");
+    test_assert(member != 0);
+    return member;
+}
+
+static
+bool find_has(
+    const ecs_entity_t *entities,
+    int32_t count,
+    ecs_entity_t e)
+{
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        if (entities[i] == e) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void MemberIndex_find_after_set(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+    test_assert(ecs_has(world, member, EcsMemberIndex));
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Walking }));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Movement, { Running }));
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_find(
+        world, member, Running, &count);
+    test_int(count, 2);
+    test_assert(find_has(entities, count, e1));
+    test_assert(find_has(entities, count, e3));
+
+    entities = ecs_member_index_find(world, member, Walking, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e2);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_find_existing(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Walking }));
+
+    ecs_add_id(world, member, EcsIndexed);
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_find(
+        world, member, Running, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e1);
+
+    entities = ecs_member_index_find(world, member, Walking, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e2);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_find_after_update(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_set(world, e, Movement, { Walking });
+
+    int32_t count;
+    test_assert(NULL == ecs_member_index_find(world, member, Running, &count));
+    test_int(count, 0);
+
+    const ecs_entity_t *entities = ecs_member_index_find(
+        world, member, Walking, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_find_after_remove(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_remove(world, e1, Movement);
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_find(
+        world, member, Running, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e2);
+
+    ecs_remove(world, e2, Movement);
+    test_assert(NULL == ecs_member_index_find(world, member, Running, &count));
+    test_int(count, 0);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_find_after_delete(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_delete(world, e2);
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_find(
+        world, member, Running, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e1);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_find_deferred(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_defer_begin(world);
+    ecs_entity_t e = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_defer_end(world);
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_find(
+        world, member, Running, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_find_int_member(void) {
+    ecs_world_t *world = ecs_init();
+
+    register_types(world);
+    ecs_entity_t member = ecs_lookup(world, "Player.id");
+    test_assert(member != 0);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Player, { 1.0f, 10 }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Player, { 2.0f, -10 }));
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_find(
+        world, member, 10, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e1);
+
+    entities = ecs_member_index_find(world, member, (uint64_t)-10, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e2);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_remove_indexed(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_insert(world, ecs_value(Movement, { Running }));
+
+    ecs_remove_id(world, member, EcsIndexed);
+    test_assert(!ecs_has(world, member, EcsMemberIndex));
+
+    int32_t count;
+    test_assert(NULL == ecs_member_index_find(world, member, Running, &count));
+    test_int(count, 0);
+
+    /* Index observer is deleted, setting values should not crash */
+    ecs_insert(world, ecs_value(Movement, { Running }));
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_eq(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ECS_TAG(world, Tag);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Running }));
+    /* ecs_entity_t e2 = */ ecs_insert(world, ecs_value(Movement, { Walking }));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_entity_t e4 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_add(world, e4, Tag);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement.value, Running)"
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(ecs_pair(member, Running), ecs_field_id(&it, 0));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e3, it.entities[0]);
+    test_uint(ecs_pair(member, Running), ecs_field_id(&it, 0));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e4, it.entities[0]);
+    test_uint(ecs_pair(member, Running), ecs_field_id(&it, 0));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_eq_no_match(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_insert(world, ecs_value(Movement, { Walking }));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement.value, Running)"
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_eq_after_update(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Walking }));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement.value, Running)"
+    });
+    test_assert(q != NULL);
+
+    ecs_set(world, e1, Movement, { Walking });
+    ecs_set(world, e2, Movement, { Running });
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e2, it.entities[0]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_eq_w_other_term(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ECS_TAG(world, Tag);
+
+    /* ecs_entity_t e1 = */ ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_add(world, e2, Tag);
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Movement, { Walking }));
+    ecs_add(world, e3, Tag);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Tag, (Movement.value, Running)"
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e2, it.entities[0]);
+    test_uint(Tag, ecs_field_id(&it, 0));
+    test_uint(ecs_pair(member, Running), ecs_field_id(&it, 1));
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_neq(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    /* ecs_entity_t e1 = */ ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Walking }));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "!(Movement.value, Running)"
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    bool found = false;
+    while (ecs_query_next(&it)) {
+        int32_t i;
+        for (i = 0; i < it.count; i ++) {
+            if (it.entities[i] == e2) {
+                found = true;
+                test_uint(ecs_pair(member, Walking), ecs_field_id(&it, 0));
+            }
+        }
+    }
+    test_bool(true, found);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_wildcard(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Walking }));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement.value, *)"
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(ecs_pair(member, Running), ecs_field_id(&it, 0));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e2, it.entities[0]);
+    test_uint(ecs_pair(member, Walking), ecs_field_id(&it, 0));
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+static
+ecs_entity_t register_health(
+    ecs_world_t *world)
+{
+    ecs_id(Health) = ecs_struct(world, {
+        .entity = ecs_entity(world, { .name = "Health" }),
+        .members = {
+            { "value", ecs_id(ecs_f32_t) }
+        },
+        .create_member_entities = true
+    });
+
+    ecs_entity_t member = ecs_lookup(world, "Health.value");
+    test_assert(member != 0);
+    ecs_add_id(world, member, EcsIndexed);
+    return member;
+}
+
+void MemberIndex_range_int(void) {
+    ecs_world_t *world = ecs_init();
+
+    register_types(world);
+    ecs_entity_t member = ecs_lookup(world, "Player.id");
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Player, { 0, 30 }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Player, { 0, -10 }));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Player, { 0, 20 }));
+    /* ecs_entity_t e4 = */ ecs_insert(world, ecs_value(Player, { 0, 50 }));
+
+    int32_t min = -10, max = 30, count;
+    const ecs_entity_t *entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ .min = &min, .max = &max }, &count);
+    test_int(count, 3);
+    test_uint(entities[0], e2);
+    test_uint(entities[1], e3);
+    test_uint(entities[2], e1);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_range_exclusive(void) {
+    ecs_world_t *world = ecs_init();
+
+    register_types(world);
+    ecs_entity_t member = ecs_lookup(world, "Player.id");
+    ecs_add_id(world, member, EcsIndexed);
+
+    /* ecs_entity_t e1 = */ ecs_insert(world, ecs_value(Player, { 0, 10 }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Player, { 0, 20 }));
+    /* ecs_entity_t e3 = */ ecs_insert(world, ecs_value(Player, { 0, 30 }));
+
+    int32_t min = 10, max = 30, count;
+    const ecs_entity_t *entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ 
+            .min = &min, .max = &max, 
+            .min_exclusive = true, .max_exclusive = true 
+        }, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e2);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_range_unbounded(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_health(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Health, { 50 }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Health, { 10 }));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Health, { -5 }));
+
+    float value = 20;
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ .max = &value, .max_exclusive = true }, &count);
+    test_int(count, 2);
+    test_uint(entities[0], e3);
+    test_uint(entities[1], e2);
+
+    entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ .min = &value }, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e1);
+
+    entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ 0 }, &count);
+    test_int(count, 3);
+    test_uint(entities[0], e3);
+    test_uint(entities[1], e2);
+    test_uint(entities[2], e1);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_range_empty(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_health(world);
+
+    ecs_insert(world, ecs_value(Health, { 50 }));
+
+    float min = 10, max = 20;
+    int32_t count;
+    test_assert(NULL == ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ .min = &min, .max = &max }, &count));
+    test_int(count, 0);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_range_after_set(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_health(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Health, { 50 }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Health, { 10 }));
+
+    float max = 20;
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ .max = &max }, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e2);
+
+    ecs_set(world, e1, Health, { 5 });
+    ecs_set(world, e2, Health, { 30 });
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Health, { 15 }));
+
+    entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ .max = &max }, &count);
+    test_int(count, 2);
+    test_uint(entities[0], e1);
+    test_uint(entities[1], e3);
+
+    entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ 0 }, &count);
+    test_int(count, 3);
+    test_uint(entities[0], e1);
+    test_uint(entities[1], e3);
+    test_uint(entities[2], e2);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_range_after_remove(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_health(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Health, { 10 }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Health, { 20 }));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Health, { 30 }));
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ 0 }, &count);
+    test_int(count, 3);
+
+    ecs_remove(world, e2, Health);
+    ecs_delete(world, e3);
+
+    entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ 0 }, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e1);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_range_after_table_move(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_health(world);
+
+    ECS_TAG(world, Tag);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Health, { 10 }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Health, { 20 }));
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ 0 }, &count);
+    test_int(count, 2);
+
+    ecs_add(world, e1, Tag);
+
+    entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ 0 }, &count);
+    test_int(count, 2);
+    test_uint(entities[0], e1);
+    test_uint(entities[1], e2);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_find_after_add(void) {
+    ecs_world_t *world = ecs_init();
+
+    register_types(world);
+    ecs_entity_t member = ecs_lookup(world, "Player.id");
+    test_assert(member != 0);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_new_w(world, Player);
+    ecs_entity_t e2 = ecs_new_w(world, Player);
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_find(
+        world, member, 0, &count);
+    test_int(count, 2);
+    test_assert(find_has(entities, count, e1));
+    test_assert(find_has(entities, count, e2));
+
+    ecs_set(world, e1, Player, { 1.0f, 10 });
+
+    entities = ecs_member_index_find(world, member, 0, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e2);
+
+    entities = ecs_member_index_find(world, member, 10, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e1);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_eq_multiple_tables(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_add(world, e1, TagA);
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_add(world, e2, TagB);
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Movement, { Walking }));
+    ecs_add(world, e3, TagA);
+    ecs_entity_t e4 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_add(world, e4, TagA);
+    ecs_entity_t e5 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_add(world, e5, TagB);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement.value, Running), TagA || TagB"
+    });
+    test_assert(q != NULL);
+
+    int32_t a_count = 0, b_count = 0;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        test_int(1, it.count);
+        test_uint(ecs_pair(member, Running), ecs_field_id(&it, 0));
+        if (ecs_field_id(&it, 1) == TagA) {
+            test_uint(it.entities[0], a_count ? e4 : e1);
+            a_count ++;
+        } else {
+            test_uint(TagB, ecs_field_id(&it, 1));
+            test_uint(it.entities[0], b_count ? e5 : e2);
+            b_count ++;
+        }
+    }
+
+    test_int(a_count, 2);
+    test_int(b_count, 2);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_range_readonly(void) {
+    ecs_world_t *world = ecs_init();
+
+    register_types(world);
+    ecs_entity_t member = ecs_lookup(world, "Player.id");
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Player, { 0, 30 }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Player, { 0, 10 }));
+
+    int32_t max = 30, count;
+    const ecs_entity_t *entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ .max = &max }, &count);
+    test_int(count, 2);
+
+    ecs_set(world, e1, Player, { 0, 5 });
+
+    /* Changed values are merged into the sorted array while readonly */
+    ecs_readonly_begin(world, false);
+    ecs_world_t *stage = ecs_get_stage(world, 0);
+
+    entities = ecs_member_index_range(stage, member, 
+        &(ecs_member_range_t){ .max = &max }, &count);
+    test_int(count, 2);
+    test_uint(entities[0], e1);
+    test_uint(entities[1], e2);
+
+    ecs_readonly_end(world);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_find_after_get_mut(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_health(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Health, { 10 }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Health, { 20 }));
+
+    int32_t count;
+    ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ 0 }, &count);
+    test_int(count, 2);
+
+    ecs_get_mut(world, e1, Health)->value = 30;
+
+    float min = 25;
+    const ecs_entity_t *entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ .min = &min }, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e1);
+
+    ecs_ensure(world, e2, Health)->value = 40;
+
+    entities = ecs_member_index_range(world, member, 
+        &(ecs_member_range_t){ .min = &min }, &count);
+    test_int(count, 2);
+    test_uint(entities[0], e1);
+    test_uint(entities[1], e2);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_eq_after_get_mut(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Running }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Walking }));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement.value, Running)"
+    });
+    test_assert(q != NULL);
+
+    ecs_get_mut(world, e1, Movement)->value = Walking;
+    ecs_ensure(world, e2, Movement)->value = Running;
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e2, it.entities[0]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_eq_after_query_write(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Walking }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Walking }));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement.value, Running)"
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_t *w = ecs_query(world, {
+        .terms = {{ .id = ecs_id(Movement), .inout = EcsOut }}
+    });
+
+    it = ecs_query_iter(world, w);
+    while (ecs_query_next(&it)) {
+        Movement *m = ecs_field(&it, Movement, 0);
+        int32_t i;
+        for (i = 0; i < it.count; i ++) {
+            if (it.entities[i] == e2) {
+                m[i].value = Running;
+            }
+        }
+    }
+
+    it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e2, it.entities[0]);
+    test_bool(false, ecs_query_next(&it));
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_find(
+        world, member, Walking, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e1);
+
+    ecs_query_fini(w);
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_eq_after_get_mut_and_move(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ECS_TAG(world, Tag);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Walking }));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Movement, { Walking }));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Movement, { Walking }));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement.value, Running)"
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(false, ecs_query_next(&it));
+
+    /* Write values and move entities before the index is used */
+    ecs_get_mut(world, e2, Movement)->value = Running;
+    ecs_get_mut(world, e3, Movement)->value = Running;
+    ecs_add(world, e2, Tag);
+    ecs_delete(world, e1);
+
+    int32_t count = 0;
+    it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        test_int(1, it.count);
+        test_assert(it.entities[0] == e2 || it.entities[0] == e3);
+        count ++;
+    }
+    test_int(count, 2);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_query_eq_multithreaded(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t member = register_types(world);
+    ecs_add_id(world, member, EcsIndexed);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Movement, { Running }));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement.value, Running)"
+    });
+    test_assert(q != NULL);
+
+    ecs_get_mut(world, e1, Movement)->value = Walking;
+
+    /* Index isn't updated in multithreaded mode, table is scanned instead */
+    ecs_readonly_begin(world, true);
+    ecs_world_t *stage = ecs_get_stage(world, 0);
+    ecs_iter_t it = ecs_query_iter(stage, q);
+    test_bool(false, ecs_query_next(&it));
+    ecs_readonly_end(world);
+
+    it = ecs_query_iter(world, q);
+    test_bool(false, ecs_query_next(&it));
+
+    int32_t count;
+    ecs_member_index_find(world, member, Running, &count);
+    test_int(count, 0);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void MemberIndex_find_nested_member(void) {
+    typedef struct {
+        int32_t a;
+        struct {
+            int32_t x;
+            int32_t y;
+        } inner;
+    } Outer;
+
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t outer = ecs_entity(world, { .name = "Outer" });
+    ecs_entity_t a = ecs_entity(world, { .name = "a", .parent = outer });
+    ecs_set(world, a, EcsMember, { .type = ecs_id(ecs_i32_t) });
+    ecs_entity_t inner = ecs_entity(world, { .name = "inner", .parent = outer });
+    ecs_entity_t x = ecs_entity(world, { .name = "x", .parent = inner });
+    ecs_set(world, x, EcsMember, { .type = ecs_id(ecs_i32_t) });
+    ecs_entity_t y = ecs_entity(world, { .name = "y", .parent = inner });
+    ecs_set(world, y, EcsMember, { .type = ecs_id(ecs_i32_t) });
+    ecs_set(world, inner, EcsMember, { .type = inner });
+
+    const EcsComponent *c = ecs_get(world, outer, EcsComponent);
+    test_assert(c != NULL);
+    test_int(c->size, sizeof(Outer));
+
+    ecs_add_id(world, y, EcsIndexed);
+    const EcsMemberIndex *index = ecs_get(world, y, EcsMemberIndex);
+    test_assert(index != NULL);
+    test_uint(index->component, outer);
+    test_int(index->offset, offsetof(Outer, inner.y));
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_set_id(world, e1, outer, sizeof(Outer), &(Outer){ 1, { 2, 3 } });
+    ecs_entity_t e2 = ecs_new(world);
+    ecs_set_id(world, e2, outer, sizeof(Outer), &(Outer){ 3, { 4, 1 } });
+
+    int32_t count;
+    const ecs_entity_t *entities = ecs_member_index_find(
+        world, y, 3, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e1);
+
+    entities = ecs_member_index_find(world, y, 1, &count);
+    test_int(count, 1);
+    test_uint(entities[0], e2);
+
+    ecs_fini(world);
+}
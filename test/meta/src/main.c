@@ -1193,6 +1193,49 @@ void RttCompare_vector_of_struct_with_strings(void);
 void RttCompare_vector_of_arrays_of_strings(void);
 void RttCompare_vector_of_opaque(void);
 
+// Testsuite 'FieldMember'
+void FieldMember_member(void);
+void FieldMember_nested_member(void);
+void FieldMember_shared_field(void);
+void FieldMember_member_not_found(void);
+void FieldMember_not_a_struct(void);
+void FieldMember_tag_field(void);
+void FieldMember_member_ref(void);
+void FieldMember_nested_member_ref(void);
+void FieldMember_member_ref_not_found(void);
+
+// Testsuite 'MemberIndex'
+void MemberIndex_find_after_set(void);
+void MemberIndex_find_existing(void);
+void MemberIndex_find_after_update(void);
+void MemberIndex_find_after_remove(void);
+void MemberIndex_find_after_delete(void);
+void MemberIndex_find_deferred(void);
+void MemberIndex_find_int_member(void);
+void MemberIndex_remove_indexed(void);
+void MemberIndex_query_eq(void);
+void MemberIndex_query_eq_no_match(void);
+void MemberIndex_query_eq_after_update(void);
+void MemberIndex_query_eq_w_other_term(void);
+void MemberIndex_query_neq(void);
+void MemberIndex_query_wildcard(void);
+void MemberIndex_range_int(void);
+void MemberIndex_range_exclusive(void);
+void MemberIndex_range_unbounded(void);
+void MemberIndex_range_empty(void);
+void MemberIndex_range_after_set(void);
+void MemberIndex_range_after_remove(void);
+void MemberIndex_range_after_table_move(void);
+void MemberIndex_find_after_add(void);
+void MemberIndex_query_eq_multiple_tables(void);
+void MemberIndex_range_readonly(void);
+void MemberIndex_find_after_get_mut(void);
+void MemberIndex_query_eq_after_get_mut(void);
+void MemberIndex_query_eq_after_query_write(void);
+void MemberIndex_query_eq_after_get_mut_and_move(void);
+void MemberIndex_query_eq_multithreaded(void);
+void MemberIndex_find_nested_member(void);
+
 bake_test_case PrimitiveTypes_testcases[] = {
     {
         "bool",
@@ -5818,6 +5861,168 @@ bake_test_case RttCompare_testcases[] = {
     }
 };
 
+bake_test_case FieldMember_testcases[] = {
+    {
+        "member",
+        FieldMember_member
+    },
+    {
+        "nested_member",
+        FieldMember_nested_member
+    },
+    {
+        "shared_field",
+        FieldMember_shared_field
+    },
+    {
+        "member_not_found",
+        FieldMember_member_not_found
+    },
+    {
+        "not_a_struct",
+        FieldMember_not_a_struct
+    },
+    {
+        "tag_field",
+        FieldMember_tag_field
+    },
+    {
+        "member_ref",
+        FieldMember_member_ref
+    },
+    {
+        "nested_member_ref",
+        FieldMember_nested_member_ref
+    },
+    {
+        "member_ref_not_found",
+        FieldMember_member_ref_not_found
+    }
+};
+
+bake_test_case MemberIndex_testcases[] = {
+    {
+        "find_after_set",
+        MemberIndex_find_after_set
+    },
+    {
+        "find_existing",
+        MemberIndex_find_existing
+    },
+    {
+        "find_after_update",
+        MemberIndex_find_after_update
+    },
+    {
+        "find_after_remove",
+        MemberIndex_find_after_remove
+    },
+    {
+        "find_after_delete",
+        MemberIndex_find_after_delete
+    },
+    {
+        "find_deferred",
+        MemberIndex_find_deferred
+    },
+    {
+        "find_int_member",
+        MemberIndex_find_int_member
+    },
+    {
+        "remove_indexed",
+        MemberIndex_remove_indexed
+    },
+    {
+        "query_eq",
+        MemberIndex_query_eq
+    },
+    {
+        "query_eq_no_match",
+        MemberIndex_query_eq_no_match
+    },
+    {
+        "query_eq_after_update",
+        MemberIndex_query_eq_after_update
+    },
+    {
+        "query_eq_w_other_term",
+        MemberIndex_query_eq_w_other_term
+    },
+    {
+        "query_neq",
+        MemberIndex_query_neq
+    },
+    {
+        "query_wildcard",
+        MemberIndex_query_wildcard
+    },
+    {
+        "range_int",
+        MemberIndex_range_int
+    },
+    {
+        "range_exclusive",
+        MemberIndex_range_exclusive
+    },
+    {
+        "range_unbounded",
+        MemberIndex_range_unbounded
+    },
+    {
+        "range_empty",
+        MemberIndex_range_empty
+    },
+    {
+        "range_after_set",
+        MemberIndex_range_after_set
+    },
+    {
+        "range_after_remove",
+        MemberIndex_range_after_remove
+    },
+    {
+        "range_after_table_move",
+        MemberIndex_range_after_table_move
+    },
+    {
+        "find_after_add",
+        MemberIndex_find_after_add
+    },
+    {
+        "query_eq_multiple_tables",
+        MemberIndex_query_eq_multiple_tables
+    },
+    {
+        "range_readonly",
+        MemberIndex_range_readonly
+    },
+    {
+        "find_after_get_mut",
+        MemberIndex_find_after_get_mut
+    },
+    {
+        "query_eq_after_get_mut",
+        MemberIndex_query_eq_after_get_mut
+    },
+    {
+        "query_eq_after_query_write",
+        MemberIndex_query_eq_after_query_write
+    },
+    {
+        "query_eq_after_get_mut_and_move",
+        MemberIndex_query_eq_after_get_mut_and_move
+    },
+    {
+        "query_eq_multithreaded",
+        MemberIndex_query_eq_multithreaded
+    },
+    {
+        "find_nested_member",
+        MemberIndex_find_nested_member
+    }
+};
+
 static bake_test_suite suites[] = {
     {
         "PrimitiveTypes",
@@ -5979,9 +6184,23 @@ static bake_test_suite suites[] = {
         NULL,
         26,
         RttCompare_testcases
+    },
+    {
+        "FieldMember",
+        NULL,
+        NULL,
+        9,
+        FieldMember_testcases
+    },
+    {
+        "MemberIndex",
+        NULL,
+        NULL,
+        30,
+        MemberIndex_testcases
     }
 };
 
 int main(int argc, char *argv[]) {
-    return bake_test_run("meta", argc, argv, suites, 23);
+    return bake_test_run("meta", argc, argv, suites, 25);
 }
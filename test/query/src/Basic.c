@@ -11841,3 +11841,440 @@ void Basic_update_query_replaces_existing(void) {
 
     ecs_fini(world);
 }
+
+void Basic_2_terms_most_selective_second(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {3, 4}));
+    ecs_add(world, e1, TagA);
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {5, 6}));
+    ecs_add(world, e2, TagB);
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_set(world, e3, Velocity, {1, 2});
+    ecs_insert(world, ecs_value(Velocity, {3, 4}));
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Position) }, { ecs_id(Velocity) }},
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e3, it.entities[0]);
+    test_uint(ecs_id(Position), ecs_field_id(&it, 0));
+    test_uint(ecs_id(Velocity), ecs_field_id(&it, 1));
+    {
+        Position *p = ecs_field(&it, Position, 0);
+        Velocity *v = ecs_field(&it, Velocity, 1);
+        test_int(p->x, 10); test_int(p->y, 20);
+        test_int(v->x, 1); test_int(v->y, 2);
+    }
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Basic_3_terms_most_selective_last(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+    ECS_TAG(world, Rare);
+
+    ecs_entity_t e1 = ecs_insert(world, 
+        ecs_value(Position, {1, 2}), ecs_value(Velocity, {3, 4}));
+    ecs_entity_t e2 = ecs_insert(world, 
+        ecs_value(Position, {5, 6}), ecs_value(Velocity, {7, 8}));
+    ecs_add(world, e2, TagA);
+    ecs_entity_t e3 = ecs_insert(world, 
+        ecs_value(Position, {10, 20}), ecs_value(Velocity, {30, 40}));
+    ecs_add(world, e3, TagB);
+    ecs_add(world, e3, Rare);
+    ecs_add(world, e1, TagB);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Position) }, { ecs_id(Velocity) }, { Rare }},
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e3, it.entities[0]);
+    test_uint(ecs_id(Position), ecs_field_id(&it, 0));
+    test_uint(ecs_id(Velocity), ecs_field_id(&it, 1));
+    test_uint(Rare, ecs_field_id(&it, 2));
+    {
+        Position *p = ecs_field(&it, Position, 0);
+        Velocity *v = ecs_field(&it, Velocity, 1);
+        test_int(p->x, 10); test_int(p->y, 20);
+        test_int(v->x, 30); test_int(v->y, 40);
+    }
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Basic_most_selective_term_changes(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+    ECS_TAG(world, TagC);
+    ECS_TAG(world, TagD);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ TagA }, { TagB }},
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    /* TagB has fewer tables than TagA */
+    ecs_entity_t e1 = ecs_new_w(world, TagA);
+    ecs_add(world, e1, TagB);
+    ecs_entity_t e2 = ecs_new_w(world, TagA);
+    ecs_add(world, e2, TagC);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(TagA, ecs_field_id(&it, 0));
+    test_uint(TagB, ecs_field_id(&it, 1));
+    test_bool(false, ecs_query_next(&it));
+
+    /* TagA has fewer tables than TagB */
+    ecs_entity_t e3 = ecs_new_w(world, TagB);
+    ecs_add(world, e3, TagC);
+    ecs_entity_t e4 = ecs_new_w(world, TagB);
+    ecs_add(world, e4, TagD);
+    ecs_new_w(world, TagB);
+
+    it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(TagA, ecs_field_id(&it, 0));
+    test_uint(TagB, ecs_field_id(&it, 1));
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+static
+int32_t partition_collect(
+    ecs_world_t *world,
+    ecs_query_t *q,
+    int32_t index,
+    int32_t count,
+    ecs_entity_t *entities)
+{
+    int32_t result = 0;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    ecs_iter_set_partition(&it, index, count);
+    while (ecs_query_next(&it)) {
+        for (int i = 0; i < it.count; i ++) {
+            entities[result ++] = it.entities[i];
+        }
+    }
+    return result;
+}
+
+static
+bool partition_contains(
+    const ecs_entity_t *entities,
+    int32_t count,
+    ecs_entity_t e)
+{
+    for (int i = 0; i < count; i ++) {
+        if (entities[i] == e) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Basic_partition_2_terms(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+    ECS_TAG(world, TagC);
+
+    ecs_entity_t e1 = ecs_insert(world, 
+        ecs_value(Position, {1, 2}), ecs_value(Velocity, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, 
+        ecs_value(Position, {1, 2}), ecs_value(Velocity, {1, 2}));
+    ecs_add(world, e2, TagA);
+    ecs_entity_t e3 = ecs_insert(world, 
+        ecs_value(Position, {1, 2}), ecs_value(Velocity, {1, 2}));
+    ecs_add(world, e3, TagB);
+    ecs_entity_t e4 = ecs_insert(world, 
+        ecs_value(Position, {1, 2}), ecs_value(Velocity, {1, 2}));
+    ecs_add(world, e4, TagC);
+    ecs_entity_t e5 = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_add(world, e5, TagA);
+    ecs_insert(world, ecs_value(Velocity, {1, 2}));
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Position) }, { ecs_id(Velocity) }},
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_entity_t p0[8], p1[8];
+    int32_t c0 = partition_collect(world, q, 0, 2, p0);
+    int32_t c1 = partition_collect(world, q, 1, 2, p1);
+    test_int(c0, 2);
+    test_int(c1, 2);
+
+    ecs_entity_t expect[] = {e1, e2, e3, e4};
+    for (int i = 0; i < 4; i ++) {
+        test_assert(partition_contains(p0, c0, expect[i]) != 
+            partition_contains(p1, c1, expect[i]));
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Basic_partition_wildcard(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Rel);
+    ECS_TAG(world, TgtA);
+    ECS_TAG(world, TgtB);
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, Rel, TgtA);
+    ecs_add_pair(world, e1, Rel, TgtB);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Rel, TgtA);
+    ecs_add(world, e2, TagA);
+    ecs_entity_t e3 = ecs_new_w_pair(world, Rel, TgtB);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_pair(Rel, EcsWildcard) }},
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_entity_t p[3][8];
+    int32_t c[3], total = 0;
+    for (int i = 0; i < 3; i ++) {
+        c[i] = partition_collect(world, q, i, 3, p[i]);
+        total += c[i];
+    }
+
+    /* e1 is matched once for each target */
+    test_int(total, 4);
+    for (int i = 0; i < 3; i ++) {
+        test_int(c[i], 1 + (i == 0));
+    }
+
+    test_assert(partition_contains(p[0], c[0], e1) || 
+        partition_contains(p[1], c[1], e1));
+    test_assert(partition_contains(p[0], c[0], e2) || 
+        partition_contains(p[1], c[1], e2) ||
+        partition_contains(p[2], c[2], e2));
+    test_assert(partition_contains(p[0], c[0], e3) || 
+        partition_contains(p[1], c[1], e3) ||
+        partition_contains(p[2], c[2], e3));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Basic_partition_or(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+    ECS_TAG(world, TagC);
+
+    ecs_entity_t e1 = ecs_new_w(world, TagA);
+    ecs_entity_t e2 = ecs_new_w(world, TagB);
+    ecs_entity_t e3 = ecs_new_w(world, TagA);
+    ecs_add(world, e3, TagC);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ TagA, .oper = EcsOr }, { TagB }},
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_entity_t p0[8], p1[8];
+    int32_t c0 = partition_collect(world, q, 0, 2, p0);
+    int32_t c1 = partition_collect(world, q, 1, 2, p1);
+    test_int(c0 + c1, 3);
+
+    ecs_entity_t expect[] = {e1, e2, e3};
+    for (int i = 0; i < 3; i ++) {
+        test_assert(partition_contains(p0, c0, expect[i]) != 
+            partition_contains(p1, c1, expect[i]));
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Basic_partition_1(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    ecs_entity_t e1 = ecs_new_w(world, TagA);
+    ecs_entity_t e2 = ecs_new_w(world, TagA);
+    ecs_add(world, e2, TagB);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ TagA }},
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_entity_t p[8];
+    int32_t c = partition_collect(world, q, 0, 1, p);
+    test_int(c, 2);
+    test_assert(partition_contains(p, c, e1));
+    test_assert(partition_contains(p, c, e2));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Basic_partition_empty(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    ecs_entity_t e1 = ecs_new_w(world, TagA);
+    ecs_entity_t e2 = ecs_new_w(world, TagA);
+    ecs_add(world, e2, TagB);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ TagA }},
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_entity_t p[4][8];
+    int32_t c[4];
+    for (int i = 0; i < 4; i ++) {
+        c[i] = partition_collect(world, q, i, 4, p[i]);
+    }
+
+    test_int(c[0], 1);
+    test_int(c[1], 1);
+    test_int(c[2], 0);
+    test_int(c[3], 0);
+    test_assert(partition_contains(p[0], c[0], e1) != 
+        partition_contains(p[1], c[1], e1));
+    test_assert(partition_contains(p[0], c[0], e2) != 
+        partition_contains(p[1], c[1], e2));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Basic_3_terms_many_tables(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+    ECS_TAG(world, TagC);
+
+    /* Enough tables per component to create table id sets */
+    ecs_entity_t matched[64];
+    int32_t i, matched_count = 0;
+    for (i = 0; i < 256; i ++) {
+        ecs_entity_t e = ecs_new(world);
+        ecs_add_id(world, e, ecs_new(world));
+        if (i & 1) ecs_add(world, e, TagA);
+        if (i & 2) ecs_add(world, e, TagB);
+        if (i & 4) ecs_add(world, e, TagC);
+        if ((i & 7) == 7) {
+            matched[matched_count ++] = e;
+        }
+    }
+
+    test_int(matched_count, 32);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ TagA }, { TagB }, { TagC }},
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    int32_t count = 0;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        test_int(it.count, 1);
+        test_uint(it.entities[0], matched[count]);
+        count ++;
+    }
+    test_int(count, 32);
+
+    /* Delete half of the matched tables */
+    for (i = 0; i < 32; i += 2) {
+        ecs_delete(world, matched[i]);
+    }
+    ecs_delete_empty_tables(world, &(ecs_delete_empty_tables_desc_t){
+        .delete_generation = 1
+    });
+    ecs_delete_empty_tables(world, &(ecs_delete_empty_tables_desc_t){
+        .delete_generation = 1
+    });
+
+    /* New tables can reuse ids of deleted tables */
+    for (i = 0; i < 16; i ++) {
+        ecs_entity_t e = ecs_new_w(world, TagA);
+        ecs_add_id(world, e, ecs_new(world));
+        ecs_add(world, e, TagB);
+    }
+
+    count = 0;
+    it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        for (i = 0; i < it.count; i ++) {
+            int32_t m;
+            for (m = 1; m < 32; m += 2) {
+                if (matched[m] == it.entities[i]) {
+                    break;
+                }
+            }
+            test_assert(m < 32);
+            count ++;
+        }
+    }
+    test_int(count, 16);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
@@ -7685,3 +7685,221 @@ void Cached_filter_term_not_term_table_recycle(void) {
 
     ecs_fini(world);
 }
+
+void Cached_share_cache_same_terms(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e = ecs_new_w(world, Position);
+    ecs_add(world, e, Velocity);
+
+    ecs_query_t *q_1 = ecs_query(world, {
+        .expr = "Position, Velocity",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_1 != NULL);
+
+    ecs_query_t *q_2 = ecs_query(world, {
+        .expr = "Position, Velocity",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_2 != NULL);
+
+    ecs_query_t *q_3 = ecs_query(world, {
+        .expr = "Position",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_3 != NULL);
+
+    test_assert(ecs_query_get_cache_query(q_1) != NULL);
+    test_assert(ecs_query_get_cache_query(q_1) == 
+        ecs_query_get_cache_query(q_2));
+    test_assert(ecs_query_get_cache_query(q_1) != 
+        ecs_query_get_cache_query(q_3));
+
+    ecs_iter_t it = ecs_query_iter(world, q_2);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e, it.entities[0]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q_1);
+    ecs_query_fini(q_2);
+    ecs_query_fini(q_3);
+
+    ecs_fini(world);
+}
+
+void Cached_share_cache_fini_first(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_add(world, e1, Velocity);
+
+    ecs_query_t *q_1 = ecs_query(world, {
+        .expr = "Position, Velocity",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_1 != NULL);
+
+    ecs_query_t *q_2 = ecs_query(world, {
+        .expr = "Position, Velocity",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_2 != NULL);
+    test_assert(ecs_query_get_cache_query(q_1) == 
+        ecs_query_get_cache_query(q_2));
+
+    ecs_query_fini(q_1);
+
+    /* Cache must still be updated with new tables */
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    ecs_add(world, e2, Velocity);
+    ecs_add(world, e2, Foo);
+
+    ecs_iter_t it = ecs_query_iter(world, q_2);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e2, it.entities[0]);
+    test_bool(false, ecs_query_next(&it));
+
+    /* New query with same terms shares cache of remaining query */
+    ecs_query_t *q_3 = ecs_query(world, {
+        .expr = "Position, Velocity",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_3 != NULL);
+    test_assert(ecs_query_get_cache_query(q_2) == 
+        ecs_query_get_cache_query(q_3));
+    test_int(2, ecs_query_count(q_3).entities);
+
+    ecs_query_fini(q_2);
+    ecs_query_fini(q_3);
+
+    ecs_fini(world);
+}
+
+void Cached_share_cache_empty(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_query_t *q_1 = ecs_query(world, {
+        .expr = "Position, Velocity",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_1 != NULL);
+
+    ecs_query_t *q_2 = ecs_query(world, {
+        .expr = "Position, Velocity",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_2 != NULL);
+    test_assert(ecs_query_get_cache_query(q_1) == 
+        ecs_query_get_cache_query(q_2));
+
+    test_assert(ecs_has_id(world, q_1->entity, EcsEmpty));
+    test_assert(ecs_has_id(world, q_2->entity, EcsEmpty));
+
+    ecs_entity_t e = ecs_new_w(world, Position);
+    ecs_add(world, e, Velocity);
+
+    test_assert(!ecs_has_id(world, q_1->entity, EcsEmpty));
+    test_assert(!ecs_has_id(world, q_2->entity, EcsEmpty));
+
+    ecs_query_fini(q_1);
+    ecs_query_fini(q_2);
+
+    ecs_fini(world);
+}
+
+void Cached_no_share_cache_order_by(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_query_t *q_1 = ecs_query(world, {
+        .expr = "Position",
+        .order_by = ecs_id(Position),
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_1 != NULL);
+
+    ecs_query_t *q_2 = ecs_query(world, {
+        .expr = "Position",
+        .order_by = ecs_id(Position),
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_2 != NULL);
+    test_assert(ecs_query_get_cache_query(q_1) != 
+        ecs_query_get_cache_query(q_2));
+
+    ecs_query_fini(q_1);
+    ecs_query_fini(q_2);
+
+    ecs_fini(world);
+}
+
+void Cached_no_share_cache_query_changed(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Likes);
+    ECS_TAG(world, Apples);
+
+    ecs_entity_t e = ecs_new_w(world, Position);
+    ecs_add_pair(world, e, Likes, Apples);
+
+    ecs_query_t *q_1 = ecs_query(world, {
+        .expr = "[in] Position, (Likes, *)",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_1 != NULL);
+
+    ecs_query_t *q_2 = ecs_query(world, {
+        .expr = "[in] Position, (Likes, *)",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_2 != NULL);
+    test_assert(ecs_query_get_cache_query(q_1) != 
+        ecs_query_get_cache_query(q_2));
+
+    test_bool(true, ecs_query_changed(q_1));
+    test_bool(true, ecs_query_changed(q_2));
+
+    /* Iterating one query must not reset the changed state of the other */
+    ecs_iter_t it = ecs_query_iter(world, q_1);
+    while (ecs_query_next(&it)) { }
+    test_bool(false, ecs_query_changed(q_1));
+    test_bool(true, ecs_query_changed(q_2));
+
+    it = ecs_query_iter(world, q_2);
+    while (ecs_query_next(&it)) { }
+    test_bool(false, ecs_query_changed(q_1));
+    test_bool(false, ecs_query_changed(q_2));
+
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    ecs_add_pair(world, e2, Likes, Apples);
+    test_bool(true, ecs_query_changed(q_1));
+    test_bool(true, ecs_query_changed(q_2));
+
+    it = ecs_query_iter(world, q_2);
+    while (ecs_query_next(&it)) { }
+    test_bool(true, ecs_query_changed(q_1));
+    test_bool(false, ecs_query_changed(q_2));
+
+    ecs_query_fini(q_1);
+    ecs_query_fini(q_2);
+
+    ecs_fini(world);
+}
@@ -3905,3 +3905,293 @@ void ChangeDetection_mark_fixed_fields_dirty_w_tag_before(void) {
 
     ecs_fini(world);
 }
+
+#define CHUNK_SIZE (1 << FLECS_CHANGE_CHUNK_BITS)
+
+static
+ecs_query_t* changed_rows_query(
+    ecs_world_t *world,
+    ecs_entity_t component)
+{
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ component, .inout = EcsIn }},
+        .cache_kind = EcsQueryCacheAuto,
+        .flags = EcsQueryDetectChanges
+    });
+    test_assert(q != NULL);
+
+    /* Synchronize monitor */
+    test_bool(true, ecs_query_changed(q));
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) { }
+    test_bool(false, ecs_query_changed(q));
+
+    return q;
+}
+
+void ChangeDetection_changed_rows_after_new(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_bulk_new(world, Position, CHUNK_SIZE * 3);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .cache_kind = EcsQueryCacheAuto,
+        .flags = EcsQueryDetectChanges
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, CHUNK_SIZE * 3);
+
+    int32_t row = 0;
+    test_int(CHUNK_SIZE * 3, ecs_iter_changed_rows(&it, &row));
+    test_int(row, 0);
+    row += CHUNK_SIZE * 3;
+    test_int(0, ecs_iter_changed_rows(&it, &row));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_no_change(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_bulk_new(world, Position, CHUNK_SIZE * 3);
+
+    ecs_query_t *q = changed_rows_query(world, ecs_id(Position));
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+
+    int32_t row = 0;
+    test_int(0, ecs_iter_changed_rows(&it, &row));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_after_set(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    const ecs_entity_t *entities = ecs_bulk_new(
+        world, Position, CHUNK_SIZE * 3);
+    ecs_entity_t e = entities[CHUNK_SIZE + 5];
+
+    ecs_query_t *q = changed_rows_query(world, ecs_id(Position));
+
+    ecs_set(world, e, Position, {10, 20});
+    test_bool(true, ecs_query_changed(q));
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, CHUNK_SIZE * 3);
+
+    int32_t row = 0;
+    test_int(CHUNK_SIZE, ecs_iter_changed_rows(&it, &row));
+    test_int(row, CHUNK_SIZE);
+    test_uint(it.entities[CHUNK_SIZE + 5], e);
+    row += CHUNK_SIZE;
+    test_int(0, ecs_iter_changed_rows(&it, &row));
+
+    test_bool(false, ecs_query_next(&it));
+    test_bool(false, ecs_query_changed(q));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_after_modified(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    const ecs_entity_t *entities = ecs_bulk_new(
+        world, Position, CHUNK_SIZE * 3);
+    ecs_entity_t e = entities[CHUNK_SIZE * 2];
+
+    ecs_query_t *q = changed_rows_query(world, ecs_id(Position));
+
+    ecs_modified(world, e, Position);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+
+    int32_t row = 0;
+    test_int(CHUNK_SIZE, ecs_iter_changed_rows(&it, &row));
+    test_int(row, CHUNK_SIZE * 2);
+    row += CHUNK_SIZE;
+    test_int(0, ecs_iter_changed_rows(&it, &row));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_2_ranges(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    const ecs_entity_t *entities = ecs_bulk_new(
+        world, Position, CHUNK_SIZE * 3);
+    ecs_entity_t e1 = entities[1];
+    ecs_entity_t e2 = entities[CHUNK_SIZE * 2 + 1];
+
+    ecs_query_t *q = changed_rows_query(world, ecs_id(Position));
+
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_set(world, e2, Position, {30, 40});
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+
+    int32_t row = 0;
+    test_int(CHUNK_SIZE, ecs_iter_changed_rows(&it, &row));
+    test_int(row, 0);
+    row += CHUNK_SIZE;
+    test_int(CHUNK_SIZE, ecs_iter_changed_rows(&it, &row));
+    test_int(row, CHUNK_SIZE * 2);
+    row += CHUNK_SIZE;
+    test_int(0, ecs_iter_changed_rows(&it, &row));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_adjacent_chunks(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    const ecs_entity_t *entities = ecs_bulk_new(
+        world, Position, CHUNK_SIZE * 3);
+    ecs_entity_t e1 = entities[CHUNK_SIZE - 1];
+    ecs_entity_t e2 = entities[CHUNK_SIZE];
+
+    ecs_query_t *q = changed_rows_query(world, ecs_id(Position));
+
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_set(world, e2, Position, {30, 40});
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+
+    int32_t row = 0;
+    test_int(CHUNK_SIZE * 2, ecs_iter_changed_rows(&it, &row));
+    test_int(row, 0);
+    row += CHUNK_SIZE * 2;
+    test_int(0, ecs_iter_changed_rows(&it, &row));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_start_in_chunk(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    const ecs_entity_t *entities = ecs_bulk_new(
+        world, Position, CHUNK_SIZE * 3);
+    ecs_entity_t e = entities[CHUNK_SIZE];
+
+    ecs_query_t *q = changed_rows_query(world, ecs_id(Position));
+
+    ecs_set(world, e, Position, {10, 20});
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+
+    int32_t row = CHUNK_SIZE + 10;
+    test_int(CHUNK_SIZE - 10, ecs_iter_changed_rows(&it, &row));
+    test_int(row, CHUNK_SIZE + 10);
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_after_delete(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    const ecs_entity_t *entities = ecs_bulk_new(
+        world, Position, CHUNK_SIZE * 3);
+    ecs_entity_t e = entities[0];
+
+    ecs_query_t *q = changed_rows_query(world, ecs_id(Position));
+
+    ecs_delete(world, e);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, CHUNK_SIZE * 3 - 1);
+
+    int32_t row = 0;
+    test_int(CHUNK_SIZE * 3 - 1, ecs_iter_changed_rows(&it, &row));
+    test_int(row, 0);
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_after_out_query(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_bulk_new(world, Position, CHUNK_SIZE * 3);
+
+    ecs_query_t *q = changed_rows_query(world, ecs_id(Position));
+
+    ecs_query_t *q_out = ecs_query(world, {
+        .expr = "[out] Position"
+    });
+    test_assert(q_out != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q_out);
+    while (ecs_query_next(&it)) { }
+
+    it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+
+    int32_t row = 0;
+    test_int(CHUNK_SIZE * 3, ecs_iter_changed_rows(&it, &row));
+    test_int(row, 0);
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q_out);
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
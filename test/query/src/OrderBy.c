@@ -1,5 +1,6 @@
 #include <query.h>
 #include <stdlib.h>
+#include <math.h>
 
 static
 int compare_position(
@@ -81,10 +82,10 @@ void OrderBy_sort_by_component_same_value_1(void) {
     
 
     test_assert(it.entities[0] == e5);
-    test_assert(it.entities[1] == e4);
-    test_assert(it.entities[2] == e3);
-    test_assert(it.entities[3] == e2);
-    test_assert(it.entities[4] == e1);
+    test_assert(it.entities[1] == e3);
+    test_assert(it.entities[2] == e4);
+    test_assert(it.entities[3] == e1);
+    test_assert(it.entities[4] == e2);
 
     test_assert(!ecs_query_next(&it));
 
@@ -116,12 +117,12 @@ void OrderBy_sort_by_component_same_value_2(void) {
     test_assert(ecs_query_next(&it));
 
     test_int(it.count, 6);
-    test_assert(it.entities[0] == e4);
-    test_assert(it.entities[1] == e6);
-    test_assert(it.entities[2] == e2);
-    test_assert(it.entities[3] == e1);
-    test_assert(it.entities[4] == e3);
-    test_assert(it.entities[5] == e5);
+    test_assert(it.entities[0] == e2);
+    test_assert(it.entities[1] == e4);
+    test_assert(it.entities[2] == e6);
+    test_assert(it.entities[3] == e5);
+    test_assert(it.entities[4] == e1);
+    test_assert(it.entities[5] == e3);
 
     test_assert(!ecs_query_next(&it));
 
@@ -2264,3 +2265,571 @@ void OrderBy_order_empty_table_only_2_tables(void) {
 
     ecs_fini(world);
 }
+
+static
+int32_t verify_sorted_by_position(
+    ecs_world_t *world,
+    ecs_query_t *q)
+{
+    int32_t count = 0;
+    float prev = -1;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        Position *p = ecs_field(&it, Position, 0);
+        int32_t i;
+        for (i = 0; i < it.count; i ++) {
+            test_assert(p[i].x >= prev);
+            test_assert(ecs_get_id(world, it.entities[i], 
+                ecs_field_id(&it, 0)) == &p[i]);
+            prev = p[i].x;
+        }
+        count += it.count;
+    }
+    return count;
+}
+
+void OrderBy_sort_changed_rows(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e[4096];
+    for (int i = 0; i < 4096; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {(float)i, 0}));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .order_by = ecs_id(Position),
+        .order_by_callback = compare_position,
+        .cache_kind = EcsQueryCacheAuto
+    });
+
+    test_int(verify_sorted_by_position(world, q), 4096);
+
+    ecs_set(world, e[10], Position, {3000.5, 0});
+    ecs_set(world, e[3500], Position, {20.5, 0});
+    ecs_set(world, e[2000], Position, {2000.5, 0});
+
+    test_int(verify_sorted_by_position(world, q), 4096);
+    test_assert(ecs_get(world, e[10], Position)->x == 3000.5);
+    test_assert(ecs_get(world, e[3500], Position)->x == 20.5);
+    test_assert(ecs_get(world, e[2000], Position)->x == 2000.5);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_changed_rows_to_front_and_back(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e[4096];
+    for (int i = 0; i < 4096; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {(float)i, 0}));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .order_by = ecs_id(Position),
+        .order_by_callback = compare_position,
+        .cache_kind = EcsQueryCacheAuto
+    });
+
+    test_int(verify_sorted_by_position(world, q), 4096);
+
+    ecs_set(world, e[0], Position, {5000, 0});
+    ecs_set(world, e[4095], Position, {-1, 0});
+
+    test_int(verify_sorted_by_position(world, q), 4096);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_assert(it.entities[0] == e[4095]);
+    ecs_iter_fini(&it);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_changed_rows_no_move(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e[4096];
+    for (int i = 0; i < 4096; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {(float)i, 0}));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .order_by = ecs_id(Position),
+        .order_by_callback = compare_position,
+        .cache_kind = EcsQueryCacheAuto
+    });
+
+    test_int(verify_sorted_by_position(world, q), 4096);
+
+    ecs_set(world, e[100], Position, {100.5, 0});
+    ecs_set(world, e[3000], Position, {2999.5, 0});
+
+    const Position *p = ecs_get(world, e[100], Position);
+    test_int(verify_sorted_by_position(world, q), 4096);
+    test_assert(p == ecs_get(world, e[100], Position));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_changed_rows_many_changes(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e[4096];
+    for (int i = 0; i < 4096; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {(float)i, 0}));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .order_by = ecs_id(Position),
+        .order_by_callback = compare_position,
+        .cache_kind = EcsQueryCacheAuto
+    });
+
+    test_int(verify_sorted_by_position(world, q), 4096);
+
+    for (int i = 0; i < 4096; i += 3) {
+        ecs_set(world, e[i], Position, {(float)(4096 - i), 0});
+    }
+
+    test_int(verify_sorted_by_position(world, q), 4096);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_changed_rows_2_tables(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e[4096];
+    for (int i = 0; i < 4096; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {(float)i, 0}));
+        if (i % 2) {
+            ecs_add(world, e[i], Foo);
+        }
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .order_by = ecs_id(Position),
+        .order_by_callback = compare_position,
+        .cache_kind = EcsQueryCacheAuto
+    });
+
+    test_int(verify_sorted_by_position(world, q), 4096);
+
+    ecs_set(world, e[1], Position, {4000.5, 0});
+    ecs_set(world, e[4000], Position, {0.5, 0});
+    ecs_set(world, e[2048], Position, {10.5, 0});
+
+    test_int(verify_sorted_by_position(world, q), 4096);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_changed_rows_random(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e[8192];
+    for (int i = 0; i < 8192; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {(float)(rand() % 8192), 0}));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .order_by = ecs_id(Position),
+        .order_by_callback = compare_position,
+        .cache_kind = EcsQueryCacheAuto
+    });
+
+    test_int(verify_sorted_by_position(world, q), 8192);
+
+    for (int r = 0; r < 10; r ++) {
+        for (int i = 0; i < 20; i ++) {
+            ecs_set(world, e[rand() % 8192], Position, 
+                {(float)(rand() % 8192), 0});
+        }
+
+        test_int(verify_sorted_by_position(world, q), 8192);
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+typedef struct {
+    int8_t small;
+    int32_t value;
+    double real;
+} Values;
+
+static ecs_entity_t ecs_id(Values) = 0;
+
+static
+void register_values(
+    ecs_world_t *world)
+{
+    ECS_IMPORT(world, FlecsMeta);
+
+    ecs_id(Values) = ecs_struct(world, {
+        .entity = ecs_entity(world, { .name = "Values" }),
+        .members = {
+            { "small", ecs_id(ecs_i8_t) },
+            { "value", ecs_id(ecs_i32_t) },
+            { "real", ecs_id(ecs_f64_t) }
+        },
+        .create_member_entities = true
+    });
+}
+
+void OrderBy_sort_by_primitive_component(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsMeta);
+
+    for (int i = 0; i < 1000; i ++) {
+        int32_t v = (rand() % 2000) - 1000;
+        ecs_entity_t e = ecs_new(world);
+        ecs_set_id(world, e, ecs_id(ecs_i32_t), sizeof(int32_t), &v);
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(ecs_i32_t), .inout = EcsIn }},
+        .order_by = ecs_id(ecs_i32_t)
+    });
+
+    test_assert(q != NULL);
+
+    int32_t count = 0, prev = INT32_MIN;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        int32_t *v = ecs_field(&it, ecs_i32_t, 0);
+        for (int i = 0; i < it.count; i ++) {
+            test_assert(v[i] >= prev);
+            prev = v[i];
+        }
+        count += it.count;
+    }
+    test_int(count, 1000);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+static
+int32_t verify_sorted_by_member(
+    ecs_world_t *world,
+    ecs_query_t *q,
+    const char *member)
+{
+    int32_t count = 0;
+    Values prev = { INT8_MIN, INT32_MIN, -1e300 };
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        Values *v = ecs_field(&it, Values, 0);
+        for (int i = 0; i < it.count; i ++) {
+            if (!strcmp(member, "small")) {
+                test_assert(v[i].small >= prev.small);
+            } else if (!strcmp(member, "value")) {
+                test_assert(v[i].value >= prev.value);
+            } else {
+                test_assert(v[i].real >= prev.real);
+            }
+            prev = v[i];
+        }
+        count += it.count;
+    }
+    return count;
+}
+
+static
+ecs_query_t* values_query(
+    ecs_world_t *world,
+    const char *member)
+{
+    char path[64];
+    ecs_os_snprintf(path, 64, "Values.%s", member);
+    ecs_entity_t m = ecs_lookup(world, path);
+    test_assert(m != 0);
+
+    return ecs_query(world, {
+        .terms = {{ ecs_id(Values), .inout = EcsIn }},
+        .order_by = m
+    });
+}
+
+void OrderBy_sort_by_member_i32(void) {
+    ecs_world_t *world = ecs_mini();
+
+    register_values(world);
+
+    for (int i = 0; i < 1000; i ++) {
+        ecs_insert(world, ecs_value(Values, {0, (rand() % 2000) - 1000, 0}));
+    }
+
+    ecs_query_t *q = values_query(world, "value");
+    test_assert(q != NULL);
+    test_int(verify_sorted_by_member(world, q, "value"), 1000);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_by_member_i8(void) {
+    ecs_world_t *world = ecs_mini();
+
+    register_values(world);
+
+    for (int i = 0; i < 1000; i ++) {
+        ecs_insert(world, ecs_value(Values, {(int8_t)(rand() % 256), 0, 0}));
+    }
+
+    ecs_query_t *q = values_query(world, "small");
+    test_assert(q != NULL);
+    test_int(verify_sorted_by_member(world, q, "small"), 1000);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_by_member_f64(void) {
+    ecs_world_t *world = ecs_mini();
+
+    register_values(world);
+
+    for (int i = 0; i < 1000; i ++) {
+        double v = ((double)(rand() % 20000) - 10000) / 7.0;
+        ecs_insert(world, ecs_value(Values, {0, 0, v}));
+    }
+
+    ecs_query_t *q = values_query(world, "real");
+    test_assert(q != NULL);
+    test_int(verify_sorted_by_member(world, q, "real"), 1000);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_by_member_small_table(void) {
+    ecs_world_t *world = ecs_mini();
+
+    register_values(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Values, {0, 30, 0}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Values, {0, -10, 0}));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Values, {0, 20, 0}));
+
+    ecs_query_t *q = values_query(world, "value");
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, 3);
+    test_uint(it.entities[0], e2);
+    test_uint(it.entities[1], e3);
+    test_uint(it.entities[2], e1);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_by_member_2_tables(void) {
+    ecs_world_t *world = ecs_mini();
+
+    register_values(world);
+
+    ECS_TAG(world, Foo);
+
+    for (int i = 0; i < 1000; i ++) {
+        ecs_entity_t e = ecs_insert(world, 
+            ecs_value(Values, {0, (rand() % 2000) - 1000, 0}));
+        if (i % 3) {
+            ecs_add(world, e, Foo);
+        }
+    }
+
+    ecs_query_t *q = values_query(world, "value");
+    test_assert(q != NULL);
+    test_int(verify_sorted_by_member(world, q, "value"), 1000);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_by_member_after_set(void) {
+    ecs_world_t *world = ecs_mini();
+
+    register_values(world);
+
+    ecs_entity_t e[4096];
+    for (int i = 0; i < 4096; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Values, {0, (rand() % 8192), 0}));
+    }
+
+    ecs_query_t *q = values_query(world, "value");
+    test_assert(q != NULL);
+    test_int(verify_sorted_by_member(world, q, "value"), 4096);
+
+    for (int i = 0; i < 10; i ++) {
+        ecs_set(world, e[rand() % 4096], Values, {0, (rand() % 8192), 0});
+    }
+
+    test_int(verify_sorted_by_member(world, q, "value"), 4096);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void OrderBy_sort_by_char_component(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsMeta);
+
+    ECS_TAG(world, Foo);
+
+    for (int i = 0; i < 1000; i ++) {
+        ecs_char_t v = (ecs_char_t)(int8_t)((rand() % 256) - 128);
+        ecs_entity_t e = ecs_new(world);
+        ecs_set_id(world, e, ecs_id(ecs_char_t), sizeof(ecs_char_t), &v);
+        if (i % 3) {
+            ecs_add(world, e, Foo);
+        }
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(ecs_char_t), .inout = EcsIn }},
+        .order_by = ecs_id(ecs_char_t)
+    });
+
+    test_assert(q != NULL);
+
+    int32_t count = 0, negative = 0;
+    int8_t prev = INT8_MIN;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        ecs_char_t *v = ecs_field(&it, ecs_char_t, 0);
+        for (int i = 0; i < it.count; i ++) {
+            int8_t cur = (int8_t)v[i];
+            test_assert(cur >= prev);
+            negative += cur < 0;
+            prev = cur;
+        }
+        count += it.count;
+    }
+    test_int(count, 1000);
+    test_assert(negative != 0);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+/* -NaN, values, NaN */
+static
+int real_rank(
+    double v)
+{
+    if (isnan(v)) {
+        return signbit(v) ? 0 : 2;
+    }
+    return 1;
+}
+
+static
+bool real_ordered(
+    double v1,
+    double v2)
+{
+    int r1 = real_rank(v1), r2 = real_rank(v2);
+    if (r1 != r2) {
+        return r1 < r2;
+    }
+    if (r1 != 1) {
+        return true;
+    }
+    if (v1 == v2) {
+        /* -0.0 is ordered before 0.0 */
+        return signbit(v1) || !signbit(v2);
+    }
+    return v1 < v2;
+}
+
+void OrderBy_sort_by_member_f64_nan(void) {
+    ecs_world_t *world = ecs_mini();
+
+    register_values(world);
+
+    ECS_TAG(world, Foo);
+
+    double special[] = { NAN, -NAN, INFINITY, -INFINITY, 0.0, -0.0 };
+
+    for (int i = 0; i < 1000; i ++) {
+        double v;
+        if (!(i % 7)) {
+            v = special[(i / 7) % 6];
+        } else {
+            v = ((double)(rand() % 20000) - 10000) / 7.0;
+        }
+
+        ecs_entity_t e = ecs_insert(world, ecs_value(Values, {0, 0, v}));
+        if (i % 3) {
+            ecs_add(world, e, Foo);
+        }
+    }
+
+    ecs_query_t *q = values_query(world, "real");
+    test_assert(q != NULL);
+
+    int32_t count = 0, nan_count = 0;
+    double prev = -NAN;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        Values *v = ecs_field(&it, Values, 0);
+        for (int i = 0; i < it.count; i ++) {
+            test_assert(real_ordered(prev, v[i].real));
+            nan_count += isnan(v[i].real);
+            prev = v[i].real;
+        }
+        count += it.count;
+    }
+    test_int(count, 1000);
+    test_assert(nan_count != 0);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
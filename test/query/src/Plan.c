@@ -3795,3 +3795,83 @@ void Plan_self_up_w_custom_rel_cached(void) {
 
     ecs_fini(world);
 }
+
+void Plan_most_selective_term_first(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    ecs_new_w(world, Foo);
+    ecs_entity_t e1 = ecs_new_w(world, Foo);
+    ecs_add(world, e1, TagA);
+    ecs_entity_t e2 = ecs_new_w(world, Foo);
+    ecs_add(world, e2, TagB);
+    ecs_entity_t e3 = ecs_new_w(world, Foo);
+    ecs_add(world, e3, Bar);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Foo, Bar",
+        .flags = EcsQueryMatchPrefab
+    });
+
+    test_assert(q != NULL);
+
+    ecs_log_enable_colors(false);
+
+    const char *expect = 
+    HEAD " 0. [-1,  1]  setids       "
+    LINE " 1. [ 0,  2]  and          $[this]          (Bar) tables: 1"
+    LINE " 2. [ 1,  3]  and          $[this]          (Foo)"
+    LINE " 3. [ 2,  4]  yield        "
+    LINE "";
+
+    char *plan = ecs_query_plan(q);
+    test_str(expect, plan);
+    ecs_os_free(plan);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Plan_most_selective_term_first_trivial(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+    ECS_TAG(world, TagA);
+
+    ecs_new_w(world, Foo);
+    ecs_entity_t e1 = ecs_new_w(world, Foo);
+    ecs_add(world, e1, TagA);
+    ecs_entity_t e2 = ecs_new_w(world, Foo);
+    ecs_add(world, e2, Bar);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Foo, Bar, ?TagA"
+    });
+
+    test_assert(q != NULL);
+
+    ecs_log_enable_colors(false);
+
+    const char *expect = 
+    HEAD " 0. [-1,  1]  setids       "
+    LINE " 1. [ 0,  2]  triv         {0,1} tables: {3,1}"
+    LINE " 2. [ 1,  4]  option       "
+    LINE " 3. [ 2,  4]   and          $[this]         (TagA)"
+    LINE " 4. [ 2,  5]  end          $[this]          (TagA)"
+    LINE " 5. [ 4,  6]  yield        "
+    LINE "";
+
+    char *plan = ecs_query_plan(q);
+    test_str(expect, plan);
+    ecs_os_free(plan);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
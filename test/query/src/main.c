@@ -734,6 +734,15 @@ void Basic_query_has_and_optional_and(void);
 void Basic_recycled_pair(void);
 void Basic_recycled_component_id(void);
 void Basic_update_query_replaces_existing(void);
+void Basic_2_terms_most_selective_second(void);
+void Basic_3_terms_most_selective_last(void);
+void Basic_most_selective_term_changes(void);
+void Basic_partition_2_terms(void);
+void Basic_partition_wildcard(void);
+void Basic_partition_or(void);
+void Basic_partition_1(void);
+void Basic_partition_empty(void);
+void Basic_3_terms_many_tables(void);
 
 // Testsuite 'Combinations'
 void Combinations_setup(void);
@@ -862,6 +871,8 @@ void Plan_up_w_custom_rel(void);
 void Plan_up_w_custom_rel_cached(void);
 void Plan_self_up_w_custom_rel(void);
 void Plan_self_up_w_custom_rel_cached(void);
+void Plan_most_selective_term_first(void);
+void Plan_most_selective_term_first_trivial(void);
 
 // Testsuite 'Variables'
 void Variables_setup(void);
@@ -1854,6 +1865,11 @@ void Cached_this_self_up_w_3_levels_ppp_after_query(void);
 void Cached_rematch_after_reparent_parent(void);
 void Cached_no_rematch_after_reparent_child(void);
 void Cached_filter_term_not_term_table_recycle(void);
+void Cached_share_cache_same_terms(void);
+void Cached_share_cache_fini_first(void);
+void Cached_share_cache_empty(void);
+void Cached_no_share_cache_order_by(void);
+void Cached_no_share_cache_query_changed(void);
 
 // Testsuite 'ChangeDetection'
 void ChangeDetection_query_changed_after_new(void);
@@ -1931,6 +1947,15 @@ void ChangeDetection_detect_w_cascade_desc(void);
 void ChangeDetection_detect_partially_cached(void);
 void ChangeDetection_mark_fixed_fields_dirty_after_remove(void);
 void ChangeDetection_mark_fixed_fields_dirty_w_tag_before(void);
+void ChangeDetection_changed_rows_after_new(void);
+void ChangeDetection_changed_rows_no_change(void);
+void ChangeDetection_changed_rows_after_set(void);
+void ChangeDetection_changed_rows_after_modified(void);
+void ChangeDetection_changed_rows_2_ranges(void);
+void ChangeDetection_changed_rows_adjacent_chunks(void);
+void ChangeDetection_changed_rows_start_in_chunk(void);
+void ChangeDetection_changed_rows_after_delete(void);
+void ChangeDetection_changed_rows_after_out_query(void);
 
 // Testsuite 'GroupBy'
 void GroupBy_group_by(void);
@@ -2734,6 +2759,21 @@ void OrderBy_sort_optional_term(void);
 void OrderBy_order_empty_table(void);
 void OrderBy_order_empty_table_only(void);
 void OrderBy_order_empty_table_only_2_tables(void);
+void OrderBy_sort_changed_rows(void);
+void OrderBy_sort_changed_rows_to_front_and_back(void);
+void OrderBy_sort_changed_rows_no_move(void);
+void OrderBy_sort_changed_rows_many_changes(void);
+void OrderBy_sort_changed_rows_2_tables(void);
+void OrderBy_sort_changed_rows_random(void);
+void OrderBy_sort_by_primitive_component(void);
+void OrderBy_sort_by_member_i32(void);
+void OrderBy_sort_by_member_i8(void);
+void OrderBy_sort_by_member_f64(void);
+void OrderBy_sort_by_member_small_table(void);
+void OrderBy_sort_by_member_2_tables(void);
+void OrderBy_sort_by_member_after_set(void);
+void OrderBy_sort_by_char_component(void);
+void OrderBy_sort_by_member_f64_nan(void);
 
 // Testsuite 'OrderByEntireTable'
 void OrderByEntireTable_sort_by_component(void);
@@ -5710,6 +5750,42 @@ bake_test_case Basic_testcases[] = {
     {
         "update_query_replaces_existing",
         Basic_update_query_replaces_existing
+    },
+    {
+        "2_terms_most_selective_second",
+        Basic_2_terms_most_selective_second
+    },
+    {
+        "3_terms_most_selective_last",
+        Basic_3_terms_most_selective_last
+    },
+    {
+        "most_selective_term_changes",
+        Basic_most_selective_term_changes
+    },
+    {
+        "partition_2_terms",
+        Basic_partition_2_terms
+    },
+    {
+        "partition_wildcard",
+        Basic_partition_wildcard
+    },
+    {
+        "partition_or",
+        Basic_partition_or
+    },
+    {
+        "partition_1",
+        Basic_partition_1
+    },
+    {
+        "partition_empty",
+        Basic_partition_empty
+    },
+    {
+        "3_terms_many_tables",
+        Basic_3_terms_many_tables
     }
 };
 
@@ -6208,6 +6284,14 @@ bake_test_case Plan_testcases[] = {
     {
         "self_up_w_custom_rel_cached",
         Plan_self_up_w_custom_rel_cached
+    },
+    {
+        "most_selective_term_first",
+        Plan_most_selective_term_first
+    },
+    {
+        "most_selective_term_first_trivial",
+        Plan_most_selective_term_first_trivial
     }
 };
 
@@ -10111,6 +10195,26 @@ bake_test_case Cached_testcases[] = {
     {
         "filter_term_not_term_table_recycle",
         Cached_filter_term_not_term_table_recycle
+    },
+    {
+        "share_cache_same_terms",
+        Cached_share_cache_same_terms
+    },
+    {
+        "share_cache_fini_first",
+        Cached_share_cache_fini_first
+    },
+    {
+        "share_cache_empty",
+        Cached_share_cache_empty
+    },
+    {
+        "no_share_cache_order_by",
+        Cached_no_share_cache_order_by
+    },
+    {
+        "no_share_cache_query_changed",
+        Cached_no_share_cache_query_changed
     }
 };
 
@@ -10414,6 +10518,42 @@ bake_test_case ChangeDetection_testcases[] = {
     {
         "mark_fixed_fields_dirty_w_tag_before",
         ChangeDetection_mark_fixed_fields_dirty_w_tag_before
+    },
+    {
+        "changed_rows_after_new",
+        ChangeDetection_changed_rows_after_new
+    },
+    {
+        "changed_rows_no_change",
+        ChangeDetection_changed_rows_no_change
+    },
+    {
+        "changed_rows_after_set",
+        ChangeDetection_changed_rows_after_set
+    },
+    {
+        "changed_rows_after_modified",
+        ChangeDetection_changed_rows_after_modified
+    },
+    {
+        "changed_rows_2_ranges",
+        ChangeDetection_changed_rows_2_ranges
+    },
+    {
+        "changed_rows_adjacent_chunks",
+        ChangeDetection_changed_rows_adjacent_chunks
+    },
+    {
+        "changed_rows_start_in_chunk",
+        ChangeDetection_changed_rows_start_in_chunk
+    },
+    {
+        "changed_rows_after_delete",
+        ChangeDetection_changed_rows_after_delete
+    },
+    {
+        "changed_rows_after_out_query",
+        ChangeDetection_changed_rows_after_out_query
     }
 };
 
@@ -13571,6 +13711,66 @@ bake_test_case OrderBy_testcases[] = {
     {
         "order_empty_table_only_2_tables",
         OrderBy_order_empty_table_only_2_tables
+    },
+    {
+        "sort_changed_rows",
+        OrderBy_sort_changed_rows
+    },
+    {
+        "sort_changed_rows_to_front_and_back",
+        OrderBy_sort_changed_rows_to_front_and_back
+    },
+    {
+        "sort_changed_rows_no_move",
+        OrderBy_sort_changed_rows_no_move
+    },
+    {
+        "sort_changed_rows_many_changes",
+        OrderBy_sort_changed_rows_many_changes
+    },
+    {
+        "sort_changed_rows_2_tables",
+        OrderBy_sort_changed_rows_2_tables
+    },
+    {
+        "sort_changed_rows_random",
+        OrderBy_sort_changed_rows_random
+    },
+    {
+        "sort_by_primitive_component",
+        OrderBy_sort_by_primitive_component
+    },
+    {
+        "sort_by_member_i32",
+        OrderBy_sort_by_member_i32
+    },
+    {
+        "sort_by_member_i8",
+        OrderBy_sort_by_member_i8
+    },
+    {
+        "sort_by_member_f64",
+        OrderBy_sort_by_member_f64
+    },
+    {
+        "sort_by_member_small_table",
+        OrderBy_sort_by_member_small_table
+    },
+    {
+        "sort_by_member_2_tables",
+        OrderBy_sort_by_member_2_tables
+    },
+    {
+        "sort_by_member_after_set",
+        OrderBy_sort_by_member_after_set
+    },
+    {
+        "sort_by_char_component",
+        OrderBy_sort_by_char_component
+    },
+    {
+        "sort_by_member_f64_nan",
+        OrderBy_sort_by_member_f64_nan
     }
 };
 
@@ -14048,7 +14248,7 @@ static bake_test_suite suites[] = {
         "Basic",
         Basic_setup,
         NULL,
-        241,
+        250,
         Basic_testcases,
         1,
         Basic_params
@@ -14066,7 +14266,7 @@ static bake_test_suite suites[] = {
         "Plan",
         NULL,
         NULL,
-        114,
+        116,
         Plan_testcases
     },
     {
@@ -14139,14 +14339,14 @@ static bake_test_suite suites[] = {
         "Cached",
         NULL,
         NULL,
-        153,
+        158,
         Cached_testcases
     },
     {
         "ChangeDetection",
         NULL,
         NULL,
-        75,
+        85,
         ChangeDetection_testcases
     },
     {
@@ -14205,7 +14405,7 @@ static bake_test_suite suites[] = {
         "OrderBy",
         NULL,
         NULL,
-        45,
+        60,
         OrderBy_testcases
     },
     {